@@ -0,0 +1,72 @@
+// Headers/AdmissionControl.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ContainerProbe.h"
+
+// Video yüklenmeden önce bellek ayak izini tahmin eder ve bütçeye sığan bir
+// yapılandırma seçer. Tahmin probe sonucundan (çözünürlük, bit derinliği,
+// codec'e göre referans kare sayısı) ve kuyruk derinliğinden çıkar; 4 monitörde
+// 8K 10-bit bir klip 200 MB'lık sınırı graph kurulmadan önce aşabiliyor.
+class AdmissionControl {
+public:
+    enum class Outcome : uint8_t {
+        Accept,     // İstenen yapılandırma sığıyor
+        Degrade,    // Paylaşımlı çözme / sığ kuyruk / küçültülmüş çözme ile sığıyor
+        Reject      // Hiçbir yapılandırma sığmıyor
+    };
+
+    struct Request {
+        ContainerProbe::Result probe;
+        int monitorCount;
+        int outputWidth;            // Hedef monitör çözünürlüğü (0 = video çözünürlüğü)
+        int outputHeight;
+        size_t availableBytes;
+        int desiredDepth;           // Kare kuyruğu derinliği
+        bool allowSharedDecode;     // Monitörler tek çözücüyü paylaşabilir mi
+
+        Request()
+            : monitorCount(1), outputWidth(0), outputHeight(0), availableBytes(0),
+              desiredDepth(0), allowSharedDecode(false) {}
+    };
+
+    struct Footprint {
+        size_t decoderBytes;        // Referans + çıkış yüzeyleri (tam çözünürlük, YUV)
+        size_t queueBytes;          // Kuyruktaki BGRA kareler
+        size_t totalBytes;
+
+        Footprint() : decoderBytes(0), queueBytes(0), totalBytes(0) {}
+    };
+
+    struct Plan {
+        Outcome outcome;
+        int decodeScale;            // 1, 2, 4: kareler bu oranda küçültülerek tutulur
+        int bufferDepth;
+        bool sharedDecode;
+        int decodeWidth;
+        int decodeHeight;
+        size_t estimatedBytes;
+        std::string reason;
+
+        Plan()
+            : outcome(Outcome::Reject), decodeScale(1), bufferDepth(0), sharedDecode(false),
+              decodeWidth(0), decodeHeight(0), estimatedBytes(0) {}
+    };
+
+    // Çözücünün referans ve çıkış kuyruğu için fazladan tuttuğu yüzeyler
+    static constexpr int DECODER_EXTRA_SURFACES = 4;
+    static constexpr int MAX_DECODE_SCALE = 4;
+
+    // NV12 (8 bit) veya P010 (10/12 bit) yüzey boyutu
+    static size_t DecodedFrameBytes(int width, int height, int bitDepth);
+    // Codec seviyesinin izin verdiği en büyük DPB (Decoded Picture Buffer)
+    static int ReferenceFrames(const std::string& codec, int width, int height);
+
+    static Footprint Estimate(const Request& request, int decodeScale, int bufferDepth, bool sharedDecode);
+    static Plan Decide(const Request& request);
+
+    static const char* GetOutcomeName(Outcome outcome);
+};
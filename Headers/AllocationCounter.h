@@ -0,0 +1,44 @@
+// Headers/AllocationCounter.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Kapsam süresince bu thread'in yaptığı heap ayırmalarını sayar. Isınmış
+// oynatma döngüsü gibi ayırma yapmaması gereken yolları doğrulamak için
+// (testler ve debug build'leri). İlk ayırmanın stack'i saklanır, böylece
+// hata mesajı suçlu çağrı yerini gösterir. İç içe kullanılabilir: içteki
+// sayaçların gördüğü ayırmalar dıştakilere de sayılır.
+class AllocationCounter {
+public:
+    static constexpr int MAX_STACK_DEPTH = 16;
+
+    AllocationCounter();
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    uint64_t GetCount() const { return count; }
+    uint64_t GetBytes() const { return bytes; }
+
+    // İlk ayırmanın çağrı yeri, ayırmayı yapan fonksiyon önce; ayırma yoksa boş
+    std::vector<std::string> GetFirstAllocationSite() const;
+    // "N ayırma (B bayt), ilki S bayt:\n  çerçeve\n  ..." biçiminde özet
+    std::string Describe() const;
+
+    // Sayaçları ve saklanan çağrı yerini sıfırlar
+    void Reset();
+
+private:
+    friend struct AllocationCounterHook;
+
+    AllocationCounter* parent;
+    uint64_t count;
+    uint64_t bytes;
+    size_t firstSize;
+    void* firstFrames[MAX_STACK_DEPTH];
+    int firstDepth;
+};
@@ -0,0 +1,34 @@
+// Headers/AllocationHooks.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Global operator new/delete ailesinin yerine geçer ve ayırmaları kayıtlı
+// kancalara (HeapProfiler, AllocationCounter) iletir. Bu dosyanın .cpp'si
+// sadece kancalardan biri kullanıldığında programa bağlanır. Hiçbir kanca
+// açık değilken ayırma / serbest bırakma başına ek maliyet bir atomik okumadır.
+class AllocationHooks {
+public:
+    enum class Hook : uint8_t {
+        HeapProfiler,
+        AllocationCounter,
+        Count
+    };
+
+    using AllocationCallback = void (*)(void* pointer, size_t size);
+    using FreeCallback = void (*)(void* pointer);
+
+    // onFree boş olabilir. Kanca kapatıldıktan sonra callback'ler hâlâ
+    // çalışmakta olan bir ayırmadan çağrılabilir: statik yaşam süreli olmalılar.
+    static void Enable(Hook hook, AllocationCallback onAllocation, FreeCallback onFree);
+    static void Disable(Hook hook);
+    static bool IsEnabled(Hook hook);
+
+    // Çağıranın stack'i: kanca ve operator new çerçeveleri atılmış, yaprak önce.
+    // Çerçeveler ilk Enable'da her new çeşidi bir kez ayrılarak bulunur.
+    static int CaptureCallerStack(void** frames, int maxFrames);
+    // Linux: dladdr + demangle, Windows: modül+offset
+    static std::string DescribeFrame(void* frame);
+};
@@ -0,0 +1,135 @@
+// Headers/AnimatedPreview.h
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "MemoryAccounting.h"
+
+// Ayarlar penceresinde fare üzerine gelince oynatılan kısa, düşük çözünürlüklü
+// animasyonlu önizlemeler. Kareler RGB565'e indirilir ve 8x8 karolar halinde
+// bir önceki kareye göre delta kodlanır: değişmeyen karolar hiç yazılmaz,
+// değişenler ham veya RLE olarak saklanır ("LMAP" formatı).
+class AnimatedPreview {
+public:
+    static constexpr uint32_t FILE_MAGIC = 0x50414D4C;   // "LMAP"
+    static constexpr uint16_t FILE_VERSION = 1;
+    static constexpr int TILE_SIZE = 8;
+
+    static constexpr int DEFAULT_WIDTH = 160;
+    static constexpr int DEFAULT_FPS = 8;
+    static constexpr int DEFAULT_DURATION_MS = 2000;
+
+    // BGRA/BGRX kare; alttan yukarı bitmap'ler için negatif stride kullanılabilir
+    struct Frame {
+        const uint8_t* pixels;
+        int width;
+        int height;
+        int stride;
+        double timestamp;   // Saniye
+    };
+
+    // Çözücüden bağımsız kare kaynağı (Windows: Media Foundation, testler: sentetik)
+    class FrameSource {
+    public:
+        virtual ~FrameSource() = default;
+        // En yakın önceki anahtar kareye konumlanır
+        virtual bool SeekTo(double seconds) = 0;
+        // Bir sonraki çözülmüş kare; frame bir sonraki çağrıya kadar geçerlidir
+        virtual bool ReadFrame(Frame& frame) = 0;
+    };
+
+    struct Options {
+        int width;
+        int fps;
+        int durationMs;
+        int runCount;           // Farklı anahtar karelerden başlayan kısa çözme dizileri
+        int changeThreshold;    // Karo başına ortalama 565 seviye farkı; altı "değişmedi"
+
+        Options() : width(DEFAULT_WIDTH), fps(DEFAULT_FPS), durationMs(DEFAULT_DURATION_MS),
+                    runCount(2), changeThreshold(2) {}
+    };
+
+    class Encoder {
+    public:
+        Encoder(int width, int height, int frameIntervalMs, int changeThreshold = 2);
+
+        // Önizleme boyutundaki BGRA kareyi ekler
+        void AddFrame(const uint8_t* bgra, int stride);
+        std::vector<uint8_t> Finish();
+
+        int GetFrameCount() const { return frameCount; }
+
+    private:
+        void EncodeTile(int tileX, int tileY, const uint16_t* frame);
+
+        int width;
+        int height;
+        int frameIntervalMs;
+        int changeThreshold;
+        int tilesX;
+        int tilesY;
+        int frameCount;
+        std::vector<uint16_t> reference;   // Çözücünün elindeki kare (kayıplı atlamalar dahil)
+        std::vector<uint8_t> frameBytes;
+        std::vector<uint8_t> output;
+    };
+
+    class Player {
+    public:
+        struct Rect {
+            int left;
+            int top;
+            int right;
+            int bottom;
+        };
+
+        Player();
+
+        bool Load(std::vector<uint8_t> data);
+        bool Open(const std::filesystem::path& filePath);
+        bool IsLoaded() const { return !data.empty(); }
+        void Reset();
+        // Veriyi ve piksel tamponunu bırakır, bellek sayacını sıfırlar
+        void Unload();
+
+        // Bir sonraki kareyi (sonda başa sararak) sadece değişen karoları
+        // güncelleyerek çözer; dirty değişen alanı verir
+        bool Advance(Rect& dirty);
+
+        const uint8_t* GetPixels() const { return pixels.data(); }
+        int GetStride() const { return width * 4; }
+        int GetWidth() const { return width; }
+        int GetHeight() const { return height; }
+        int GetFrameIntervalMs() const { return frameIntervalMs; }
+        int GetFrameCount() const { return frameCount; }
+        int GetCurrentFrame() const { return currentFrame; }
+
+    private:
+        bool DecodeTile(int tileX, int tileY, size_t& position);
+
+        std::vector<uint8_t> data;
+        std::vector<uint8_t> pixels;   // BGRA
+        int width;
+        int height;
+        int frameIntervalMs;
+        int frameCount;
+        int tilesX;
+        int tilesY;
+        int currentFrame;
+        size_t firstFrameOffset;
+        size_t position;
+        MemoryAccounting::Tracker memory;
+    };
+
+    // Kaynaktan önizleme boyutuna ölçekleyerek kısa bir animasyon üretir
+    static bool Generate(FrameSource& source, double duration, std::vector<uint8_t>& output,
+                         const Options& options = Options());
+
+    // Alan ortalamasıyla BGRA ölçekleme
+    static void ScaleFrame(const Frame& frame, int width, int height, std::vector<uint8_t>& output);
+
+    static bool WriteFile(const std::filesystem::path& filePath, const std::vector<uint8_t>& data);
+    static bool ReadFile(const std::filesystem::path& filePath, std::vector<uint8_t>& data);
+};
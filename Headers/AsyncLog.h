@@ -0,0 +1,124 @@
+// Headers/AsyncLog.h
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "LogSeverity.h"
+#include "LogSinks.h"
+#include "MemoryAccounting.h"
+
+// Çağıranın thread'inde kilit, biçimlendirme ve disk G/Ç'si olmadan log yazar.
+// Kayıtlar sabit boyutlu hücrelerden oluşan sınırlı, kilitsiz bir MPSC
+// kuyruğuna kopyalanır (ayırma yok); tek bir yazıcı thread kuyruğu toplu
+// boşaltır ve kayıtları sink'lere dağıtır (LogSink.h): yerleşik dosya sink'i
+// ile AddSink'le eklenenler (geçmiş, hata ayıklayıcı, sayaçlar) aynı kuyruktan
+// beslenir, her biri kendi seviye süzgeciyle. Yazıcı aralıkla
+// (FLUSH_INTERVAL_MS) veya flushSeverity ve üstü bir kayıt geldiğinde uyanır.
+//
+// Kuyruk dolmaya yaklaştığında düşük öncelikli kayıtlar (Warning altı)
+// düşürülür ve sayılır; kapasitenin son dörtte biri uyarı ve hatalara ayrılmıştır.
+// Yazıcı düşürülen kayıt sayısını bir sonraki döngüde sink'lere de not eder.
+//
+// SetRotation ile dosya boyut/yaş sınırında yazıcı thread'inde döndürülür;
+// toplu yazım sınırda bölünür, hiçbir kayıt kaybolmaz (LogRotation.h).
+class AsyncLog {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 4096;          // 2'nin kuvveti
+    static constexpr size_t MAX_MESSAGE_BYTES = 232;          // Fazlası karakter sınırında kırpılır, sonuna "…" eklenir
+    static constexpr uint32_t FLUSH_INTERVAL_MS = 200;
+
+    using Encoding = LogFileSink::Encoding;
+
+    explicit AsyncLog(size_t capacity = DEFAULT_CAPACITY, LogSeverity flushSeverity = LogSeverity::Error);
+    ~AsyncLog();
+
+    AsyncLog(const AsyncLog&) = delete;
+    AsyncLog& operator=(const AsyncLog&) = delete;
+
+    // Öncekine ait kayıtlar önce eski dosyaya yazılır. Boş yol çıktıyı kapatır
+    // (kayıtlar yine tüketilir). Dosya sonuna eklenir
+    bool SetFile(const std::string& filePath, Encoding encoding = Encoding::Text);
+    // Varsayılan: döndürme kapalı
+    void SetRotation(const LogRotation::Policy& policy) { fileSink.SetRotation(policy); }
+    LogRotation& GetRotation() { return fileSink.GetRotation(); }
+    // Dosya sink'inin seviye süzgeci için
+    LogSink& GetFileSink() { return fileSink; }
+
+    // Sonraki döngüden itibaren beslenir; sink'ler yazıcı thread'inde çağrılır
+    void AddSink(std::shared_ptr<LogSink> sink);
+    void RemoveSink(const LogSink* sink);
+
+    // Kuyruğa alındıysa true; süzüldüyse veya düşürüldüyse false (hiçbir zaman beklemez)
+    bool Push(LogSeverity severity, std::string_view message);
+    // BinaryLog::Write kullanır: biçim kimliği + kodlanmış argümanlar
+    bool PushRecord(LogSeverity severity, uint16_t formatId, const uint8_t* payload, size_t length);
+
+    // Kuyruğa giriş süzgeci, tüm sink'ler için (derleme zamanı tabanı için LogMacros.h)
+    void SetMinimumSeverity(LogSeverity severity) { minimumSeverity.store(severity, std::memory_order_relaxed); }
+    LogSeverity GetMinimumSeverity() const { return minimumSeverity.load(std::memory_order_relaxed); }
+    bool IsEnabled(LogSeverity severity) const { return severity >= minimumSeverity.load(std::memory_order_relaxed); }
+
+    // Şu ana kadar kuyruğa alınan her şey yazılıp flush edilene kadar bekler
+    void Flush();
+
+    uint64_t GetDroppedCount(LogSeverity severity) const;
+    uint64_t GetDroppedCount() const;
+    uint64_t GetWrittenCount() const { return written.load(std::memory_order_acquire); }
+    size_t GetCapacity() const { return capacity; }
+
+    static const char* GetSeverityName(LogSeverity severity);
+
+private:
+    struct Cell {
+        std::atomic<uint64_t> sequence;
+        int64_t timestampMs;           // system_clock, epoch'tan beri
+        uint16_t formatId;             // BinaryLog::TEXT_FORMAT: text düz metin
+        LogSeverity severity;
+        uint8_t length;
+        char text[MAX_MESSAGE_BYTES];
+    };
+
+    static constexpr size_t RESERVED_DIVISOR = 4;             // Kapasitenin 1/4'ü uyarılara
+
+    void WriterLoop();
+    // Kuyruktaki hazır kayıtları sink'lere dağıtır; tüketilen kayıt sayısı
+    size_t Drain();
+    void Dispatch(const LogRecord& record);
+
+    const size_t capacity;
+    const size_t mask;
+    const size_t reservedCells;
+    const LogSeverity flushSeverity;
+    std::atomic<LogSeverity> minimumSeverity;
+    std::unique_ptr<Cell[]> cells;
+
+    alignas(64) std::atomic<uint64_t> enqueuePosition;
+    alignas(64) uint64_t dequeuePosition;                     // Sadece yazıcı thread
+    std::atomic<uint64_t> dequeued;                           // Üreticilerin doluluk tahmini için
+    std::atomic<uint64_t> written;
+    std::atomic<uint64_t> dropped[static_cast<size_t>(LogSeverity::Count)];
+    uint64_t reportedDrops;
+
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable flushedCondition;
+    std::atomic<bool> urgent;
+    bool stopping;
+
+    std::mutex sinkMutex;                                     // Yazıcı ile SetFile / AddSink arasında
+    LogFileSink fileSink;
+    std::vector<std::shared_ptr<LogSink>> sinks;
+    std::string recordText;                                   // LogRecord::GetText buffer'ı
+    std::thread writer;
+    MemoryAccounting::Tracker memory;
+};
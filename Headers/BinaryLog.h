@@ -0,0 +1,107 @@
+// Headers/BinaryLog.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "AsyncLog.h"
+
+// Ertelenmiş biçimlendirmeli ikili log. Çağrı yeri mesajı biçimlendirmez ve
+// std::string kurmaz: statik bir biçim dizgesinin kimliği ile argümanların ham
+// değerleri kayda kopyalanır. Metin, yazıcı thread'inde (metin dosyası) veya
+// sonradan LMWallpaperLogDecode ile (ikili dosya) üretilir:
+//
+//     static const BinaryLog::Format format("Video işleme hatası: {}");
+//     BinaryLog::Write(log, LogSeverity::Error, format, e.what());
+//
+// İkili dosya kendini tanımlar: bir biçim dosyada ilk kullanıldığında metni de
+// yazılır, çözücünün uygulamanın kendisine ihtiyacı olmaz.
+class BinaryLog {
+public:
+    static constexpr uint16_t MAX_FORMATS = 4096;
+    static constexpr uint16_t TEXT_FORMAT = 0;                // Düz metin kaydı
+    static constexpr size_t MAX_PAYLOAD_BYTES = AsyncLog::MAX_MESSAGE_BYTES;
+    static constexpr char FILE_MAGIC[8] = { 'L', 'M', 'W', 'L', 'O', 'G', '1', '\0' };
+
+    // Çağrı yerinde statik tanımlanır; kimlik ilk kurulumda atanır
+    class Format {
+    public:
+        explicit Format(const char* text);
+        uint16_t GetId() const { return id; }
+        const char* GetText() const { return text; }
+
+    private:
+        const char* text;
+        uint16_t id;
+    };
+
+    // Argümanları sabit boyutlu buffer'a kodlar; sığmayan dizgeler kırpılır
+    class Encoder {
+    public:
+        Encoder() : length(0) {}
+
+        void Put(bool value) { PutUnsigned('u', value ? 1 : 0); }
+        void Put(double value);
+        void Put(std::string_view value);
+        void Put(const char* value) { Put(std::string_view(value ? value : "")); }
+        void Put(const std::string& value) { Put(std::string_view(value)); }
+        // Geniş dizgeler UTF-8'e doğrudan buffer'da çevrilir (ara std::string yok)
+        void Put(std::wstring_view value);
+        void Put(const wchar_t* value) { Put(std::wstring_view(value ? value : L"")); }
+        void Put(const std::wstring& value) { Put(std::wstring_view(value)); }
+
+        template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+        void Put(T value) {
+            if (std::is_signed<T>::value) {
+                const int64_t signedValue = static_cast<int64_t>(value);
+                // Zigzag: küçük negatifler de kısa kodlanır
+                PutUnsigned('i', (static_cast<uint64_t>(signedValue) << 1) ^ static_cast<uint64_t>(signedValue >> 63));
+            } else {
+                PutUnsigned('u', static_cast<uint64_t>(value));
+            }
+        }
+        template <typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+        void Put(T value) { Put(static_cast<typename std::underlying_type<T>::type>(value)); }
+        void Put(float value) { Put(static_cast<double>(value)); }
+        template <typename... Args>
+        void PutAll(const Args&... args) { (Put(args), ...); }
+
+        const uint8_t* GetData() const { return buffer; }
+        size_t GetLength() const { return length; }
+
+    private:
+        void PutUnsigned(char tag, uint64_t value);
+
+        uint8_t buffer[MAX_PAYLOAD_BYTES];
+        size_t length;
+    };
+
+    template <typename... Args>
+    static bool Write(AsyncLog& log, LogSeverity severity, const Format& format, const Args&... args) {
+        Encoder encoder;
+        encoder.PutAll(args...);
+        return WriteEncoded(log, severity, format, encoder);
+    }
+    // Argümanları önceden kodlanmış kayıt (LogRateLimiter kodlanmış mesajı karşılaştırır)
+    static bool WriteEncoded(AsyncLog& log, LogSeverity severity, const Format& format, const Encoder& encoder) {
+        return log.PushRecord(severity, format.GetId(), encoder.GetData(), encoder.GetLength());
+    }
+
+    static const char* GetFormat(uint16_t id);
+
+    // Biçimdeki "{}" yerlerine kodlanmış argümanları yazar
+    static void Render(const char* format, const uint8_t* payload, size_t length, std::string& out);
+
+    // İkili dosya yapı taşları (yazıcı thread'i ve çözücü kullanır)
+    static void AppendFileHeader(std::string& out);
+    static void AppendFormatDefinition(std::string& out, uint16_t id);
+    static void AppendRecord(std::string& out, int64_t timestampMs, LogSeverity severity, uint16_t formatId,
+                             const uint8_t* payload, size_t length);
+
+    // İkili log dosyasını metin satırlarına çevirir; bozuk / eksik dosyada false
+    static bool Decode(std::istream& in, std::ostream& out);
+};
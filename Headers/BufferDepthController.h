@@ -0,0 +1,53 @@
+// Headers/BufferDepthController.h
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+// Bir oynatıcının kare kuyruğu derinliğini kendi decode sürelerinden hesaplar.
+// Her kare için decode'un kare aralığının ne kadar gerisine düştüğü (birikmiş
+// gecikme) tutulur; son WINDOW_SIZE karedeki bu gecikmenin 99. yüzdeliğini
+// karşılayacak kadar kare istenir. Düzgün 720p klip minimumda kalır, patlamalı
+// 4K HEVC daha derin kuyruk alır. Sonuç bellek bütçesinden gelen üst sınırla
+// kırpılır. Artış hemen uygulanır, azalış SHRINK_AFTER kare boyunca ihtiyaç
+// düşük kalırsa birer birer yapılır.
+class BufferDepthController {
+public:
+    static constexpr int MIN_DEPTH = 2;
+    static constexpr int INITIAL_DEPTH = 3;        // Yeterli örnek gelene kadar
+    static constexpr int MAX_DEPTH = 32;
+    static constexpr size_t WINDOW_SIZE = 256;     // 30 fps'te ~8,5 s
+    static constexpr size_t WARMUP_SAMPLES = 30;
+    static constexpr size_t SHRINK_AFTER = 120;
+    static constexpr double STALL_PERCENTILE = 0.99;
+
+    explicit BufferDepthController(double frameIntervalMs);
+
+    // Yeni video: ölçümler sıfırlanır, bellek üst sınırı korunur
+    void Reset(double frameIntervalMs);
+    // Bellek bütçesinin izin verdiği kare sayısı
+    void SetMemoryCap(int frames);
+
+    // Bir karenin decode süresini kaydeder; hedef derinlik değiştiyse true döner
+    bool RecordDecode(double decodeMs);
+
+    int GetDepth() const;          // Bütçeyle kırpılmış, kuyrukta kullanılacak derinlik
+    int GetTargetDepth() const;    // Jitter'ın istediği derinlik (bütçeye bildirilen)
+    double GetStallPercentile() const;
+    double GetFrameInterval() const;
+
+private:
+    int DepthForStall(double stallMs) const;
+
+    mutable std::mutex mutex;
+    double frameInterval;
+    std::vector<double> stalls;    // Halka buffer: kare başına birikmiş gecikme (ms)
+    std::vector<double> scratch;   // Yüzdelik hesabı için kopya
+    size_t nextSlot;
+    double backlog;
+    double stallPercentile;
+    int targetDepth;
+    int memoryCap;
+    size_t framesBelowTarget;
+};
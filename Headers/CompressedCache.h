@@ -0,0 +1,103 @@
+// Headers/CompressedCache.h
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "MemoryAccounting.h"
+#include "MemoryBudgetBroker.h"
+
+// Çözülmüş piksel buffer'ları (görüntüler, thumbnail'ler, kareler) için LRU
+// cache. Atmak ile sayfa dışına yazmak arasında bir ara katman: orta bellek
+// baskısında bir süredir erişilmeyen girdiler yerinde FastCompressor ile
+// sıkıştırılır ve ilk erişimde açılır. Kritik baskıda veya bütçe yetmezse
+// en eski girdiler atılır.
+class CompressedCache {
+public:
+    struct Item {
+        std::shared_ptr<const std::vector<uint8_t>> pixels;   // Tutulduğu sürece geçerli
+        int width;
+        int height;
+        int stride;
+    };
+
+    struct Stats {
+        uint64_t compressions;
+        uint64_t decompressions;
+        uint64_t rawBytesCompressed;
+        uint64_t compressedBytes;
+        uint64_t compressNanoseconds;
+        uint64_t decompressNanoseconds;
+
+        double GetRatio() const {
+            return compressedBytes ? static_cast<double>(rawBytesCompressed) / static_cast<double>(compressedBytes) : 0.0;
+        }
+    };
+
+    static constexpr int DEFAULT_COLD_AGE_MS = 2000;
+    // Bu orandan kötü sıkışan girdi ham bırakılır (açma maliyetine değmez)
+    static constexpr double MIN_SAVING = 0.10;
+
+    CompressedCache(MemoryCategory category, size_t capacityBytes);
+    ~CompressedCache();
+
+    void Put(const std::wstring& key, std::vector<uint8_t> pixels, int width, int height, int stride);
+    // Sıkıştırılmışsa açar; girdi tekrar sıcak olur
+    bool Get(const std::wstring& key, Item& item);
+    void Remove(const std::wstring& key);
+    void Clear();
+
+    // minAge'den uzun süredir erişilmeyen girdileri sıkıştırır; kazanılan baytları döner
+    size_t CompressCold(std::chrono::milliseconds minAge);
+    // En eski girdilerden başlayarak bellekteki boyutu limitin altına indirir
+    void EvictTo(size_t bytes);
+
+    // MemoryBudgetBroker'a tüketici olarak kaydolur: bütçe küçülünce veya
+    // baskı artınca önce sıkıştırır, yetmezse atar
+    void AttachToBroker(MemoryBudgetBroker& broker, const std::string& name, int priority, size_t minimumBytes);
+
+    size_t GetResidentBytes() const;   // Bellekteki (sıkıştırılmış + ham) boyut
+    size_t GetRawBytes() const;        // Hepsi açık olsaydı
+    size_t GetEntryCount() const;
+    size_t GetCompressedCount() const;
+    Stats GetStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        std::wstring key;
+        std::shared_ptr<const std::vector<uint8_t>> pixels;   // Sıcaksa dolu
+        std::vector<uint8_t> compressed;                      // Soğuksa dolu
+        size_t rawSize;
+        int width;
+        int height;
+        int stride;
+        Clock::time_point lastAccess;
+    };
+
+    size_t EntryBytes(const Entry& entry) const;
+    bool CompressEntry(Entry& entry);
+    bool DecompressEntry(Entry& entry);
+    void EvictLocked(size_t bytes);
+    void OnBudget(size_t budgetBytes, MemoryPressure pressure);
+
+    mutable std::mutex mutex;
+    std::list<Entry> entries;   // Baş: en son erişilen
+    std::unordered_map<std::wstring, std::list<Entry>::iterator> index;
+    size_t capacity;
+    size_t residentBytes;
+    size_t rawBytes;
+    size_t compressedCount;
+    Stats stats;
+    MemoryAccounting::Tracker memory;
+    MemoryBudgetBroker* broker;
+    MemoryBudgetBroker::ConsumerId budgetId;
+};
@@ -0,0 +1,48 @@
+// Headers/ContainerProbe.h
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+// MP4/MOV, Matroska/WebM ve AVI başlıklarını DirectShow graph'ı kurmadan
+// doğrudan okuyan hafif video probe'u. Tüm okumalar sınırlıdır; mdat/movi
+// gibi büyük veri bölümleri hiç okunmaz, sadece atlanır.
+class ContainerProbe {
+public:
+    enum class Container {
+        Unknown,
+        MP4,
+        MOV,
+        Matroska,
+        WebM,
+        AVI
+    };
+
+    struct Result {
+        Container container;
+        std::string codec;          // "H.264", "HEVC", "AV1", "VP9" ...
+        int width;
+        int height;
+        double duration;            // saniye
+        double fps;
+        int bitDepth;
+        std::string colorSpace;     // "BT.601", "BT.709", "BT.2020" ...
+        uint64_t frameCount;
+        uint64_t keyframeCount;     // 0 = bilinmiyor
+
+        Result()
+            : container(Container::Unknown), width(0), height(0), duration(0.0),
+              fps(0.0), bitDepth(0), frameCount(0), keyframeCount(0) {}
+    };
+
+    // Moov / Cues / idx1 gibi indeks bölümleri için okunacak maksimum bayt
+    static constexpr size_t MAX_INDEX_READ = 16 * 1024 * 1024;
+    // Dosya başında taranacak maksimum üst seviye kutu/eleman sayısı
+    static constexpr int MAX_TOP_LEVEL_ITEMS = 64;
+
+    static bool Probe(const std::filesystem::path& filePath, Result& result);
+
+    static const char* ContainerName(Container container);
+    static bool IsProbeableExtension(const std::filesystem::path& filePath);
+};
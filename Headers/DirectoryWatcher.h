@@ -0,0 +1,83 @@
+// Headers/DirectoryWatcher.h
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Bir klasördeki dosya ekleme / silme / değiştirme / yeniden adlandırma
+// olaylarını izler (Windows: ReadDirectoryChangesW, Linux: inotify).
+// Olay patlamaları birleştirilir ve sessizlik süresi dolunca tek bir
+// değişiklik listesi olarak callback'e verilir. Olay kuyruğu taşarsa
+// klasörün kendisi Modified, izlenen klasör silinir / taşınır / bağlantısı
+// kesilirse Removed olarak bildirilir; ikinci durumda izleme biter
+// (IsRunning false döner) ve yeniden Start gerekir.
+class DirectoryWatcher {
+public:
+    enum class ChangeType {
+        Added,
+        Removed,
+        Modified,
+        Renamed
+    };
+
+    struct Change {
+        ChangeType type;
+        std::filesystem::path path;
+        std::filesystem::path oldPath;  // Sadece Renamed için
+    };
+
+    using ChangeCallback = std::function<void(const std::vector<Change>&)>;
+
+    // Ham olayları dosya başına tek bir değişikliğe indirger
+    class Coalescer {
+    public:
+        void Add(ChangeType type, const std::filesystem::path& path,
+                 const std::filesystem::path& oldPath = std::filesystem::path());
+        std::vector<Change> Take();
+        bool Empty() const { return pending.empty(); }
+
+    private:
+        struct Pending {
+            uint64_t sequence;
+            Change change;
+        };
+
+        void Put(const Change& change);
+
+        std::unordered_map<std::string, Pending> pending;
+        uint64_t nextSequence = 0;
+    };
+
+    static constexpr int DEFAULT_DEBOUNCE_MS = 250;
+    static constexpr int MAX_LATENCY_MS = 2000;   // Sürekli olay gelse bile en geç bu sürede bildir
+
+    DirectoryWatcher();
+    ~DirectoryWatcher();
+
+    bool Start(const std::filesystem::path& directory, ChangeCallback callback,
+               std::chrono::milliseconds debounce = std::chrono::milliseconds(DEFAULT_DEBOUNCE_MS));
+    void Stop();
+    bool IsRunning() const { return isRunning; }
+
+private:
+    struct PlatformState;
+
+    void WatchLoop();
+
+    std::filesystem::path directory;
+    ChangeCallback callback;
+    std::chrono::milliseconds debounce;
+    std::unique_ptr<PlatformState> platform;
+    std::unique_ptr<std::thread> watchThread;
+    std::atomic<bool> isRunning;
+    std::atomic<bool> shouldStop;
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <chrono>
@@ -11,21 +12,35 @@
 // NOTE: Added <windows.h> to define HRESULT and other Windows types.
 #include <windows.h>
 
+#include "../Logger.h"
+
 
 enum class ErrorLevel {
     INFO,
     WARNING,
+    ERROR,
     CRITICAL
 };
 
+// ErrorHandler::LogInfo ayrıntı seviyeleri
+enum class InfoLevel {
+    TRACE,
+    DEBUG,
+    INFO,
+    WARNING
+};
+
 struct Error {
     std::string message;
     ErrorLevel level;
     std::chrono::system_clock::time_point timestamp;
 };
 
+// Logger'ın hata odaklı yüzü: ayrı dosyası, kilidi ve geçmişi yok; her şey
+// Logger'ın tek kuyruğuna ve sink'lerine gider.
 class ErrorHandler {
 public:
+    // Ortak log dosyasını açar (döndürme varsayılan politikayla)
     ErrorHandler(const std::string& logFilePath = "error_log.txt");
     ~ErrorHandler();
 
@@ -34,13 +49,25 @@ public:
     void HandleError(HRESULT hr, const std::string& functionName, ErrorLevel level = ErrorLevel::CRITICAL);
     void HandleError(HRESULT hr, const std::wstring& functionName, ErrorLevel level = ErrorLevel::CRITICAL);
 
-    const std::vector<Error>& GetErrors() const;
+    // Ortak geçmişteki uyarı ve hatalar (seviye başına sınırlı); yazanları bekletmez
+    std::vector<Error> GetErrors() const;
+    // Sadece bu görünümü boşaltır: önceki kayıtlar GetErrors'tan düşer, ortak
+    // geçmiş (ve onu okuyan diğer görünümler) olduğu gibi kalır
     void ClearErrors();
 
-private:
-    void LogError(const Error& error);
+    // Örneğe gerek olmadan her yerden
+    static void LogError(const std::string& message, ErrorLevel level = ErrorLevel::ERROR);
+    static void LogInfo(const std::string& message, InfoLevel level = InfoLevel::INFO);
+    // UTF-8 metinli bilgi kutusu
+    static void ShowInfoDialog(const std::string& message, const std::string& title = "Bilgi");
+    // "0x80004005 - Belirtilmemiş hata" biçiminde
+    static std::string HRESULTToString(HRESULT hr);
+    // GetLastError() için sistem mesajı, UTF-8
+    static std::string GetLastErrorAsString();
+
+    static LogSeverity ToSeverity(ErrorLevel level);
+    static LogSeverity ToSeverity(InfoLevel level);
 
-    std::vector<Error> m_errors;
-    std::ofstream m_logFile;
-    std::mutex m_mutex;
+private:
+    std::atomic<uint64_t> clearedBefore;   // Bu sıradan önceki geçmiş kayıtları gösterilmez
 };
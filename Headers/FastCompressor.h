@@ -0,0 +1,24 @@
+// Headers/FastCompressor.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Bellek içi soğuk buffer'lar için hızlı, kayıpsız sıkıştırma. Çıktı LZ4 blok
+// formatındadır (token + literal + 16 bit offset + eşleşme uzunluğu); harici
+// bir kütüphane gerektirmez. Oran için değil hız için ayarlıdır: açma
+// maliyeti bir memcpy'nin birkaç katı kadardır.
+class FastCompressor {
+public:
+    static constexpr size_t MIN_MATCH = 4;
+    static constexpr size_t MAX_OFFSET = 65535;
+
+    // En kötü durumda (sıkıştırılamaz veri) gereken çıktı boyutu
+    static size_t MaxCompressedSize(size_t size) { return size + size / 255 + 16; }
+
+    // Sıkıştırılmış boyutu, çıktı sığmazsa 0 döner
+    static size_t Compress(const uint8_t* source, size_t size, uint8_t* destination, size_t capacity);
+
+    // Tam olarak rawSize bayt üretmezse veya veri bozuksa false döner
+    static bool Decompress(const uint8_t* source, size_t size, uint8_t* destination, size_t rawSize);
+};
@@ -0,0 +1,91 @@
+// Headers/FrameArena.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "MemoryAccounting.h"
+
+// Kare başına geçici işler (ölçekleyici filtre tabloları, dönüşüm satırları,
+// karo bitmap'leri) için thread'e özel, tek yönlü büyüyen bellek alanı.
+// Ayırma bir işaretçi kaydırmadır, tek tek serbest bırakma yoktur; alan kare
+// sınırında (Scope bitince) toptan geri sarılır. Bir kare blok sığmazsa yeni
+// blok eklenir ve bir sonraki kare sınırında bloklar tek büyük blokta
+// birleştirilir: ısınmış döngüde global heap'e ve kilidine hiç gidilmez.
+//
+// std::pmr::memory_resource olarak mevcut container'lara verilebilir:
+//     std::pmr::vector<uint16_t> row(width, &FrameArena::ForCurrentThread());
+// Bu container'lar Scope'tan uzun yaşamamalıdır. Döngü içindeki geçici
+// buffer'lar için iç Scope kullanılmalı: aksi halde her tur yeni (soğuk) bellek alır.
+class FrameArena : public std::pmr::memory_resource {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+    // Kare sınırı: kapsam bitince kapsam içindeki bütün ayırmalar geri alınır.
+    // İç içe kullanılabilir (ör. FramePipeline karesi içinde önizleme karesi)
+    class Scope {
+    public:
+        explicit Scope(FrameArena& arena);
+        Scope() : Scope(ForCurrentThread()) {}
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        FrameArena& arena;
+        size_t block;
+        size_t offset;
+    };
+
+    explicit FrameArena(size_t initialBytes = DEFAULT_BLOCK_SIZE);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Bu thread'in arenası (ilk kullanımda oluşturulur)
+    static FrameArena& ForCurrentThread();
+
+    void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    template <typename T>
+    T* AllocateArray(size_t count) {
+        return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // Bütün ayırmaları geri alır; taşma blokları tek blokta birleştirilir
+    void Reset();
+
+    size_t GetUsedBytes() const;
+    size_t GetCapacity() const { return capacity; }
+    size_t GetPeakBytes() const { return peakBytes; }
+    // Global heap'ten blok alma sayısı (ısınmadan sonra artmamalı)
+    uint64_t GetBlockAllocations() const { return blockAllocations; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> memory;
+        size_t size;
+    };
+
+    void AddBlock(size_t minimumBytes);
+    void RewindTo(size_t block, size_t offset);
+
+    std::vector<Block> blocks;
+    size_t currentBlock;
+    size_t currentOffset;
+    size_t capacity;
+    size_t peakBytes;
+    uint64_t blockAllocations;
+    int openScopes;
+    MemoryAccounting::Tracker memory;
+};
@@ -0,0 +1,112 @@
+// Headers/FramePipeline.h
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "BufferDepthController.h"
+#include "FrameTelemetry.h"
+#include "LargePages.h"
+#include "MemoryAccounting.h"
+
+// Oynatıcının decode → kuyruk → sunum döngüsü. Kareler sabit sayıda slotta
+// tutulur; sunulan karenin slotu (piksel buffer'ı ve platform yüzeyi ile
+// birlikte) bir sonraki decode'a verilir. Isındıktan sonra Step heap'e hiç
+// dokunmaz. Yüzey ve buffer'lar sadece bellek bütçesi derinliği düşürdüğünde
+// veya kareler yaşlandığında bırakılır.
+class FramePipeline {
+public:
+    // Step en eskiyi sunduktan sonra decode eder: en fazla MAX_DEPTH slot dolu olur
+    static constexpr int SLOT_COUNT = BufferDepthController::MAX_DEPTH;
+
+    using PixelBuffer = std::vector<uint8_t, LargePageAllocator<uint8_t>>;
+
+    struct Frame {
+        uint64_t index;
+        uint32_t timestampMs;
+        int width;
+        int height;
+        int stride;
+        PixelBuffer pixels;            // Kapasite slot boyunca korunur
+        void* surface;                 // Platform yüzeyi (ör. ID2D1Bitmap); decoder yeniden kullanır
+        size_t surfaceBytes;
+        MemoryAccounting::Tracker memory;
+
+        Frame();
+    };
+
+    // Boş olmayabilen bir slotu yeni kareyle doldurur; kare yoksa false
+    using Decoder = std::function<bool(Frame& frame)>;
+    using Presenter = std::function<void(const Frame& frame)>;
+    using SurfaceReleaser = std::function<void(void* surface)>;
+
+    explicit FramePipeline(double frameIntervalMs);
+    ~FramePipeline();
+
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+
+    void SetDecoder(Decoder decoder);
+    void SetPresenter(Presenter presenter);
+    void SetSurfaceReleaser(SurfaceReleaser releaser);
+
+    // 4K/8K kareler için piksel buffer'larını büyük sayfalardan al (alınamazsa
+    // normal sayfalar). Mevcut kareler ve slot buffer'ları bırakılır.
+    void SetLargePages(LargePages::Mode mode);
+    LargePages::Mode GetLargePages() const;
+
+    // Bir kare aralığı: kuyruk derinliğe ulaştıysa en eski kare sunulur, boşalan
+    // slota yeni kare decode edilir ve süresi derinlik denetleyicisine verilir.
+    // Decoder / presenter geçici işleri için FrameArena::ForCurrentThread kullanabilir.
+    // Hedef derinlik değiştiyse true (bütçe talebini güncellemek için)
+    bool Step();
+
+    // Yeni video: kuyruk ve slotlar boşaltılır, ölçümler sıfırlanır
+    void Reset(double frameIntervalMs);
+    // Bütçe kare sayısı; fazla kareler ve boştaki slotların belleği hemen bırakılır
+    void SetMemoryCap(int frames);
+    // timestampMs'i nowMs'ten maxAgeMs'ten eski kareleri atar, atılan sayıyı döner
+    size_t DropOlderThan(uint32_t nowMs, uint32_t maxAgeMs);
+    void Clear();
+
+    size_t GetQueuedCount() const;
+    uint64_t GetPresentedCount() const;
+    int GetDepth() const { return depthController.GetDepth(); }
+    int GetTargetDepth() const { return depthController.GetTargetDepth(); }
+    double GetStallPercentile() const { return depthController.GetStallPercentile(); }
+    double GetFrameInterval() const { return depthController.GetFrameInterval(); }
+
+    // Sunum süresi, adım başına toplam süre, kuyruk derinliği ve düşürülen
+    // kareler burada ölçülür. Okuma → ölçekleme aşamalarını decoder kendisi
+    // FrameTelemetry::ScopedStage ile yazar (aşama sınırlarını sadece o bilir)
+    FrameTelemetry& GetTelemetry() { return telemetry; }
+    const FrameTelemetry& GetTelemetry() const { return telemetry; }
+
+private:
+    int PopOldest();
+    void Recycle(int slot);
+    void RecycleCold(int slot);
+    void ReleaseSlot(int slot);
+    void ReleaseIdleSlots(int keep);
+    size_t TrimTo(int frames);
+
+    mutable std::mutex mutex;
+    BufferDepthController depthController;
+    FrameTelemetry telemetry;
+    Decoder decoder;
+    Presenter presenter;
+    SurfaceReleaser surfaceReleaser;
+
+    std::array<Frame, SLOT_COUNT> slots;
+    std::array<int, SLOT_COUNT> queue;       // Halka: en eski queueHead'de
+    std::array<int, SLOT_COUNT> freeSlots;   // LIFO: en son kullanılan (sıcak) slot önce
+    int queueHead;
+    int queueCount;
+    int freeCount;
+    uint64_t nextIndex;
+    uint64_t presentedCount;
+};
@@ -0,0 +1,141 @@
+// Headers/FrameTelemetry.h
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "TraceRecorder.h"
+
+// HDR tarzı log-lineer histogram: her ikinin kuvveti aralığı 2^SUB_BUCKET_BITS
+// eşit kovaya bölünür, göreli hata %3,2'yi geçmez. Kovalar sabit dizide
+// atomik sayaçlardır: Record kilitsizdir ve herhangi bir thread'den
+// çağrılabilir. Okuma kovaları kopyalar; eşzamanlı kayıtlar yarım görülebilir
+// ama sayılar hiçbir zaman bozulmaz. MAX_VALUE'dan büyük değerler son kovaya yazılır.
+class HdrHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 5;
+    static constexpr int MAX_VALUE_BITS = 36;                         // Nanosaniyede ~68 s
+    static constexpr uint64_t MAX_VALUE = (uint64_t(1) << MAX_VALUE_BITS) - 1;
+    static constexpr size_t SUB_BUCKET_COUNT = size_t(1) << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    // Değerler kaydedilen birimde (ör. nanosaniye, kare). Yüzdelikler kovanın
+    // üst sınırıdır, gözlenen en büyük değerle kırpılır
+    struct Summary {
+        uint64_t count;
+        double mean;
+        uint64_t p50;
+        uint64_t p90;
+        uint64_t p99;
+        uint64_t p999;
+        uint64_t max;
+
+        Summary() : count(0), mean(0.0), p50(0), p90(0), p99(0), p999(0), max(0) {}
+    };
+
+    HdrHistogram();
+
+    HdrHistogram(const HdrHistogram&) = delete;
+    HdrHistogram& operator=(const HdrHistogram&) = delete;
+
+    void Record(uint64_t value);
+    // Yazarlarla yarışabilir: sadece yeni ölçüm dönemine geçerken çağrılmalı
+    void Reset();
+
+    uint64_t GetCount() const { return count.load(std::memory_order_relaxed); }
+    uint64_t GetValueAtPercentile(double percentile) const;
+    Summary Summarize() const;
+
+    static size_t GetBucketIndex(uint64_t value);
+    static uint64_t GetBucketLowest(size_t index);
+    static uint64_t GetBucketHighest(size_t index);
+
+private:
+    using Counts = std::array<uint32_t, BUCKET_COUNT>;
+    uint64_t Load(Counts& counts) const;
+    static uint64_t ValueAtRank(const Counts& counts, uint64_t rank, uint64_t observedMax);
+
+    std::atomic<uint32_t> buckets[BUCKET_COUNT];
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> sum;
+    std::atomic<uint64_t> max;
+};
+
+// Bir oynatıcının kare süresi telemetrisi: aşama başına gecikme histogramları,
+// kare başına toplam süre, kuyruk derinliği dağılımı ve düşürülen / geciken
+// kare sayaçları. Kayıt tarafı kilitsizdir; tepsi menüsü oynatmayı
+// durdurmadan GetSnapshot ile okur.
+class FrameTelemetry {
+public:
+    // Okuma, demux, dönüşüm ve ölçekleme DirectShow graph'ının içinde kalır ve
+    // ayrı ölçülemez; kare yolunda gerçekten ayrışan aşamalar bunlardır
+    enum class Stage : uint8_t {
+        Decode,     // Karenin slot yüzeyine çözülmesi
+        Present,
+        Count
+    };
+    static constexpr size_t STAGE_COUNT = static_cast<size_t>(Stage::Count);
+
+    struct Snapshot {
+        std::array<HdrHistogram::Summary, STAGE_COUNT> stages;   // Nanosaniye
+        HdrHistogram::Summary frame;                            // Step başına toplam, nanosaniye
+        HdrHistogram::Summary queueDepth;                       // Kare
+        int currentQueueDepth;
+        uint64_t droppedFrames;     // Sunulmadan atılan kareler (yaşlanma, bütçe kırpması)
+        uint64_t lateFrames;        // Kare aralığını aşan adımlar
+
+        Snapshot() : currentQueueDepth(0), droppedFrames(0), lateFrames(0) {}
+    };
+
+    // Kapsam süresini bir aşamaya yazar; telemetry null ise hiçbir şey ölçmez.
+    // İz kaydı açıksa aşama zaman çizelgesinde span olarak da görünür
+    class ScopedStage {
+    public:
+        ScopedStage(FrameTelemetry* telemetry, Stage stage)
+            : span(GetStageName(stage)), telemetry(telemetry), stage(stage), start(telemetry ? Now() : 0) {}
+        ~ScopedStage() {
+            if (telemetry) telemetry->RecordStage(stage, Now() - start);
+        }
+
+        ScopedStage(const ScopedStage&) = delete;
+        ScopedStage& operator=(const ScopedStage&) = delete;
+
+    private:
+        TraceRecorder::Span span;
+        FrameTelemetry* telemetry;
+        Stage stage;
+        uint64_t start;
+    };
+
+    FrameTelemetry();
+
+    FrameTelemetry(const FrameTelemetry&) = delete;
+    FrameTelemetry& operator=(const FrameTelemetry&) = delete;
+
+    void RecordStage(Stage stage, uint64_t nanoseconds);
+    void RecordFrame(uint64_t nanoseconds, bool late);
+    void RecordQueueDepth(int depth);
+    void RecordDropped(uint64_t frames);
+    // Yeni video: tüm ölçümler sıfırlanır
+    void Reset();
+
+    Snapshot GetSnapshot() const;
+
+    static const char* GetStageName(Stage stage);
+    // steady_clock, nanosaniye
+    static uint64_t Now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+private:
+    HdrHistogram stages[STAGE_COUNT];
+    HdrHistogram frame;
+    HdrHistogram queueDepth;
+    std::atomic<int> currentQueueDepth;
+    std::atomic<uint64_t> droppedFrames;
+    std::atomic<uint64_t> lateFrames;
+};
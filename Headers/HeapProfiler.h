@@ -0,0 +1,54 @@
+// Headers/HeapProfiler.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Örneklemeli heap profiler. Ayırmaları AllocationHooks üzerinden görür;
+// Start çağrılmadıkça her ayırmada sadece bir atomik bayrak okunur. Açıkken ortalama her samplingBytes baytta bir ayırma
+// (üstel dağılımlı aralıklarla) seçilir, kısa bir stack alınır ve çağrı yerine
+// göre toplanır. Seçilmeyen ayırmalar için thread-local bir sayaç azaltılır.
+//
+// Çıktılar:
+//  - pprof'un okuduğu metin heap profili (heap_v2 + MAPPED_LIBRARIES)
+//  - flamegraph.pl / speedscope için katlanmış stack'ler ("a;b;c bayt")
+class HeapProfiler {
+public:
+    static constexpr size_t DEFAULT_SAMPLING_BYTES = 512 * 1024;
+    static constexpr int MAX_STACK_DEPTH = 24;
+
+    enum class Metric : uint8_t {
+        InUseBytes,       // Şu an ayrılı olan (sızıntı / büyüme)
+        AllocatedBytes    // Profil başından beri ayrılan toplam (churn)
+    };
+
+    // Değerler örneklemeden geri ölçeklenmiş tahminlerdir
+    struct Site {
+        std::vector<std::string> frames;   // Kök önce, ayırmayı yapan fonksiyon sonda
+        uint64_t allocCount;
+        uint64_t allocBytes;
+        uint64_t inUseCount;
+        uint64_t inUseBytes;
+    };
+
+    // Önceki ölçümleri siler. Aynı anda tek profil çalışır.
+    static bool Start(size_t samplingBytes = DEFAULT_SAMPLING_BYTES);
+    // Toplanan veri dışa aktarım için korunur
+    static void Stop();
+    static bool IsRunning();
+
+    // LMW_HEAP_PROFILE=<dosya öneki> ayarlıysa profili başlatır ve çıkışta
+    // <önek>.heap ile <önek>.folded yazar (soak testleri için).
+    // LMW_HEAP_PROFILE_RATE örnekleme aralığını bayt olarak değiştirir.
+    static bool StartFromEnvironment();
+
+    static bool WritePprof(const std::string& path);
+    static bool WriteCollapsed(const std::string& path, Metric metric = Metric::InUseBytes);
+
+    // Metriğe göre büyükten küçüğe
+    static std::vector<Site> GetTopSites(size_t count, Metric metric = Metric::InUseBytes);
+    static uint64_t GetSampleCount();
+    static size_t GetSamplingBytes();
+};
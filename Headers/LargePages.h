@@ -0,0 +1,77 @@
+// Headers/LargePages.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+// Büyük kare buffer'ları için 2 MB'lık sayfalar. 4K bir BGRA kare ~8000 adet
+// 4 KB sayfaya yayılır; dönüşüm ve ölçekleme çekirdeklerinde TLB kaçırmaları
+// belirginleşir. Büyük sayfalar alınamazsa (Windows'ta SeLockMemoryPrivilege
+// yok, Linux'ta hugetlb havuzu boş / THP kapalı) sessizce normal sayfalara
+// düşülür; ne alındığı istatistiklerden okunabilir.
+class LargePages {
+public:
+    enum class Mode : uint8_t {
+        Off,           // Normal heap
+        Transparent,   // Linux: THP madvise (havuz gerekmez). Windows: Explicit gibi
+        Explicit       // Windows: MEM_LARGE_PAGES, Linux: MAP_HUGETLB; olmazsa Transparent
+    };
+
+    enum class Backing : uint8_t {
+        Heap,          // Eşikten küçük veya Mode::Off
+        Regular,       // Sayfa eşlemesi, büyük sayfa alınamadı
+        Transparent,   // THP istendi (çekirdek sayfaları arka planda birleştirebilir)
+        Explicit,      // Garantili büyük sayfalar
+        Count
+    };
+
+    // Bundan küçük buffer'lar büyük sayfaya değmez: normal heap'ten gelir
+    static constexpr size_t MINIMUM_BYTES = 1024 * 1024;
+
+    // 0: platform büyük sayfa desteklemiyor
+    static size_t GetLargePageSize();
+
+    // Boyut ve mod aynı verilerek Free edilmelidir
+    static void* Allocate(size_t bytes, Mode mode, Backing* backing = nullptr);
+    static void Free(void* pointer, size_t bytes, Mode mode);
+
+    // O an ayrılı olan bayt, gerçekte alınan türe göre
+    static size_t GetBytes(Backing backing);
+    static const char* GetBackingName(Backing backing);
+};
+
+// Kare buffer'ları için std::vector allocator'ı; mod allocator'la taşınır
+template <typename T>
+class LargePageAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    LargePageAllocator() noexcept : mode(LargePages::Mode::Off) {}
+    explicit LargePageAllocator(LargePages::Mode mode) noexcept : mode(mode) {}
+    template <typename U>
+    LargePageAllocator(const LargePageAllocator<U>& other) noexcept : mode(other.GetMode()) {}
+
+    T* allocate(size_t count) {
+        void* pointer = LargePages::Allocate(count * sizeof(T), mode);
+        if (!pointer) throw std::bad_alloc();
+        return static_cast<T*>(pointer);
+    }
+
+    void deallocate(T* pointer, size_t count) noexcept {
+        LargePages::Free(pointer, count * sizeof(T), mode);
+    }
+
+    LargePages::Mode GetMode() const noexcept { return mode; }
+
+    template <typename U>
+    bool operator==(const LargePageAllocator<U>& other) const noexcept { return mode == other.GetMode(); }
+    template <typename U>
+    bool operator!=(const LargePageAllocator<U>& other) const noexcept { return mode != other.GetMode(); }
+
+private:
+    LargePages::Mode mode;
+};
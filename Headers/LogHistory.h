@@ -0,0 +1,71 @@
+// Headers/LogHistory.h
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "LogSeverity.h"
+#include "MemoryAccounting.h"
+
+// Bellekte tutulan son log kayıtları. Her seviyenin kendi sabit kapasiteli
+// halkası vardır: haftalarca çalışan süreçte bellek sabit kalır ve gürültülü
+// INFO kayıtları nadir hataları halkadan atamaz.
+//
+// Yazma kilitsiz ve ayırmasızdır (hücreye kopyalama). Okuyucu yazıcıları hiç
+// bekletmez: her hücre bir sürüm sayacıyla korunur (seqlock); okuma sırasında
+// üzerine yazılan hücre anlık görüntüye alınmaz. Görüntü, başladığı anda
+// eklenmiş kayıtların halkada hâlâ duran kısmıdır, ekleniş sırasıyla.
+class LogHistory {
+public:
+    static constexpr size_t MAX_MESSAGE_BYTES = 224;          // Fazlası karakter sınırında kırpılır, sonuna "…" eklenir
+    using Capacities = std::array<size_t, static_cast<size_t>(LogSeverity::Count)>;
+
+    struct Entry {
+        uint64_t sequence;          // Tüm seviyeler arasında ekleniş sırası
+        int64_t timestampMs;        // system_clock, epoch'tan beri
+        LogSeverity severity;
+        std::string message;
+    };
+
+    // Trace 64, Debug 128, Info / Warning / Error 256, Critical 64
+    static Capacities DefaultCapacities();
+
+    explicit LogHistory(const Capacities& capacities = DefaultCapacities());
+
+    LogHistory(const LogHistory&) = delete;
+    LogHistory& operator=(const LogHistory&) = delete;
+
+    void Append(LogSeverity severity, std::string_view message, int64_t timestampMs);
+    std::vector<Entry> Snapshot() const;
+    // Şu ana kadarki kayıtları görüntülerden çıkarır (yazıcıları durdurmaz)
+    void Clear();
+
+    size_t GetCapacity(LogSeverity severity) const;
+    uint64_t GetAppendedCount() const { return nextSequence.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> version;     // Tek: yazılıyor
+        uint64_t sequence;
+        int64_t timestampMs;
+        uint8_t length;
+        char text[MAX_MESSAGE_BYTES];
+    };
+
+    struct Ring {
+        std::unique_ptr<Slot[]> slots;
+        size_t capacity;
+        std::atomic<uint64_t> head;
+    };
+
+    std::array<Ring, static_cast<size_t>(LogSeverity::Count)> rings;
+    std::atomic<uint64_t> nextSequence;
+    std::atomic<uint64_t> clearedBefore;
+    MemoryAccounting::Tracker memory;
+};
@@ -0,0 +1,90 @@
+// Headers/LogMacros.h
+#pragma once
+
+#include "BinaryLog.h"
+#include "LogRateLimiter.h"
+
+// Derleme zamanı log tabanı: bunun altındaki çağrılar hiç derlenmez, argümanları
+// da hesaplanmaz. 0 Trace, 1 Debug, 2 Info, 3 Warning, 4 Error, 5 Critical.
+// Release'te Trace/Debug atılır; CMake'te LMWALLPAPER_LOG_FLOOR ile değiştirilebilir.
+#ifndef LMWALLPAPER_LOG_FLOOR
+#ifdef NDEBUG
+#define LMWALLPAPER_LOG_FLOOR 2
+#else
+#define LMWALLPAPER_LOG_FLOOR 0
+#endif
+#endif
+
+// Tabanın üstündeki seviyeler çalışma zamanında da süzülür (AsyncLog::SetMinimumSeverity);
+// süzülen çağrının argümanları yine hesaplanmaz:
+//     LMW_LOG_DEBUG(Logger::GetInstance(), "Kare buffer'ı: {}/{} frame ({})", frames, target, name);
+//
+// Hedef, LogEnabled(hedef, seviye), LogWrite(hedef, seviye, biçim, argümanlar...),
+// LogWriteEncoded(hedef, seviye, biçim, kodlayıcı) ve LogOutput(hedef) aşırı
+// yüklemeleri olan herhangi bir nesnedir (AsyncLog, Logger).
+#define LMW_LOG_COMPILED(severity) (static_cast<int>(LogSeverity::severity) >= LMWALLPAPER_LOG_FLOOR)
+
+// Argümanı olmayan ama pahalı hazırlık isteyen bloklar için:
+//     if (LMW_LOG_IS_ON(log, Trace)) { ... dökümü hazırla ...; LMW_LOG_TRACE(log, "{}", döküm); }
+#define LMW_LOG_IS_ON(target, severity) (LMW_LOG_COMPILED(severity) && LogEnabled((target), LogSeverity::severity))
+
+#define LMW_LOG(target, severity, text, ...)                                                   \
+    do {                                                                                       \
+        if constexpr (LMW_LOG_COMPILED(severity)) {                                            \
+            if (LogEnabled((target), LogSeverity::severity)) {                                 \
+                static const BinaryLog::Format lmwLogFormat(text);                             \
+                LogWrite((target), LogSeverity::severity, lmwLogFormat __VA_OPT__(,) __VA_ARGS__); \
+            }                                                                                  \
+        }                                                                                      \
+    } while (false)
+
+// Döngüde tekrarlayabilen hatalar için: çağrı yeri başına tekrar bastırma ve
+// token bucket (LogRateLimiter); bastırılanlar özet satırlarıyla sayılır
+//     LMW_LOG_LIMITED(Logger::GetInstance(), Error, "Video işleme hatası: {}", e.what());
+#define LMW_LOG_LIMITED(target, severity, text, ...)                                           \
+    do {                                                                                       \
+        if constexpr (LMW_LOG_COMPILED(severity)) {                                            \
+            if (LogEnabled((target), LogSeverity::severity)) {                                 \
+                static const BinaryLog::Format lmwLogFormat(text);                             \
+                static LogRateLimiter lmwLogLimiter;                                           \
+                BinaryLog::Encoder lmwLogMessage;                                              \
+                lmwLogMessage.PutAll(__VA_ARGS__);                                             \
+                LogWriteLimited((target), LogSeverity::severity, lmwLogFormat, lmwLogLimiter, lmwLogMessage); \
+            }                                                                                  \
+        }                                                                                      \
+    } while (false)
+
+#define LMW_LOG_TRACE(target, text, ...)    LMW_LOG(target, Trace, text __VA_OPT__(,) __VA_ARGS__)
+#define LMW_LOG_DEBUG(target, text, ...)    LMW_LOG(target, Debug, text __VA_OPT__(,) __VA_ARGS__)
+#define LMW_LOG_INFO(target, text, ...)     LMW_LOG(target, Info, text __VA_OPT__(,) __VA_ARGS__)
+#define LMW_LOG_WARNING(target, text, ...)  LMW_LOG(target, Warning, text __VA_OPT__(,) __VA_ARGS__)
+#define LMW_LOG_ERROR(target, text, ...)    LMW_LOG(target, Error, text __VA_OPT__(,) __VA_ARGS__)
+#define LMW_LOG_CRITICAL(target, text, ...) LMW_LOG(target, Critical, text __VA_OPT__(,) __VA_ARGS__)
+
+inline bool LogEnabled(const AsyncLog& log, LogSeverity severity) {
+    return log.IsEnabled(severity);
+}
+
+template <typename... Args>
+inline void LogWrite(AsyncLog& log, LogSeverity severity, const BinaryLog::Format& format, const Args&... args) {
+    BinaryLog::Write(log, severity, format, args...);
+}
+
+inline void LogWriteEncoded(AsyncLog& log, LogSeverity severity, const BinaryLog::Format& format,
+                            const BinaryLog::Encoder& encoder) {
+    BinaryLog::WriteEncoded(log, severity, format, encoder);
+}
+
+inline AsyncLog& LogOutput(AsyncLog& log) {
+    return log;
+}
+
+// Özetler hedefin kuyruğuna yazılır; çağrı yeri susunca da (bkz. LogRateLimiter)
+template <typename Target>
+inline void LogWriteLimited(Target& target, LogSeverity severity, const BinaryLog::Format& format,
+                            LogRateLimiter& limiter, const BinaryLog::Encoder& message) {
+    const LogRateLimiter::Decision decision = limiter.Admit(message, LogOutput(target), severity);
+    if (decision.repeated > 0) LogWrite(target, severity, LogRateLimiter::GetRepeatedFormat(), decision.repeated);
+    if (decision.suppressed > 0) LogWrite(target, severity, LogRateLimiter::GetSuppressedFormat(), decision.suppressed);
+    if (decision.emit) LogWriteEncoded(target, severity, format, message);
+}
@@ -0,0 +1,90 @@
+// Headers/LogRateLimiter.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "BinaryLog.h"
+#include "LogSeverity.h"
+
+// Tek bir çağrı yerinin log akışını sınırlar. Çözme bozulduğunda oynatma ve
+// temizlik döngüleri aynı hatayı saniyede yüzlerce kez yazabiliyor; burada:
+//   - Aynı mesaj art arda gelirse yazılmaz, sayılır. Sayı bir sonraki farklı
+//     mesajdan önce veya SUMMARY_INTERVAL_MS'de bir "son mesaj N kez
+//     tekrarlandı" özetiyle yazılır.
+//   - Farklı mesajlar token bucket'tan geçer (BURST kadar ani, saniyede RATE).
+//     Token yokken gelenler sayılıp "N mesaj bastırıldı" özetine girer.
+//   - Çağrı yeri susarsa özeti yazacak çağrı gelmez: bir AsyncLog'a bağlı
+//     limiter'ların vadesi gelen özetlerini o logun yazıcı thread'i yazar
+//     (FlushDue), log kapanırken bekleyenlerin hepsi yazılır (FlushAll).
+// Hiçbir kayıt sessizce kaybolmaz: yazılan + bastırılan = çağrı sayısı.
+// Mesajlar kodlanmış argümanlarıyla karşılaştırılır (biçim çağrı yerinde sabit).
+class LogRateLimiter {
+public:
+    static constexpr double DEFAULT_BURST = 10.0;
+    static constexpr double DEFAULT_RATE = 1.0;                 // Saniyede token
+    static constexpr int64_t DEFAULT_SUMMARY_INTERVAL_MS = 10000;
+
+    // Çağıranın ne yazacağı: önce özetler, sonra (emit ise) mesajın kendisi
+    struct Decision {
+        bool emit;
+        uint32_t repeated;      // "Son mesaj N kez tekrarlandı"
+        uint32_t suppressed;    // "N mesaj hız sınırıyla bastırıldı"
+
+        Decision() : emit(false), repeated(0), suppressed(0) {}
+    };
+
+    explicit LogRateLimiter(double burst = DEFAULT_BURST, double ratePerSecond = DEFAULT_RATE,
+                            int64_t summaryIntervalMs = DEFAULT_SUMMARY_INTERVAL_MS);
+    // Bekleyen özetler hâlâ bağlı olduğu loga yazılır
+    ~LogRateLimiter();
+
+    LogRateLimiter(const LogRateLimiter&) = delete;
+    LogRateLimiter& operator=(const LogRateLimiter&) = delete;
+
+    Decision Admit(const BinaryLog::Encoder& message);
+    // Ayrıca limiter'ı özetlerin kendiliğinden yazılacağı loga ve seviyeye bağlar
+    Decision Admit(const BinaryLog::Encoder& message, AsyncLog& summaryOutput, LogSeverity summarySeverity);
+    Decision Admit(uint64_t messageHash, int64_t nowMs);
+    // Bekleyen özeti alır; dueOnly ise sadece SUMMARY_INTERVAL_MS dolduysa
+    Decision TakePending(int64_t nowMs, bool dueOnly);
+
+    uint64_t GetEmittedCount() const;
+    uint64_t GetSuppressedCount() const;            // Tekrar + hız sınırı
+    uint64_t GetPendingCount() const;               // Henüz özeti yazılmamış olanlar
+
+    static uint64_t Hash(const BinaryLog::Encoder& message);
+    static const BinaryLog::Format& GetRepeatedFormat();
+    static const BinaryLog::Format& GetSuppressedFormat();
+
+    // log'a bağlı limiter'ların vadesi gelen özetlerini yazar (AsyncLog yazıcı thread'i)
+    static void FlushDue(AsyncLog& log, int64_t nowMs);
+    // Bekleyen tüm özetleri yazar ve limiter'ları log'dan ayırır (AsyncLog kapanışı)
+    static void FlushAll(AsyncLog& log);
+    // steady_clock, milisaniye (Admit(Encoder) ile aynı saat)
+    static int64_t NowMs();
+
+private:
+    Decision AdmitLocked(uint64_t messageHash, int64_t nowMs);
+    void Refill(int64_t nowMs);
+    bool SummaryDue(int64_t nowMs) const;
+    void TakeSummary(Decision& decision, int64_t nowMs);
+
+    const double burst;
+    const double ratePerSecond;
+    const int64_t summaryIntervalMs;
+
+    mutable std::mutex mutex;
+    double tokens;
+    int64_t lastRefillMs;           // -1: henüz çağrı yok
+    int64_t lastOutputMs;           // Son mesaj veya özet
+    uint64_t lastHash;
+    bool hasLast;
+    uint32_t repeated;
+    uint32_t suppressed;
+    uint64_t emittedTotal;
+    uint64_t suppressedTotal;
+    AsyncLog* output;               // Kendiliğinden yazılan özetler için; null: bağlı değil
+    LogSeverity severity;
+};
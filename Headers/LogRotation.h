@@ -0,0 +1,97 @@
+// Headers/LogRotation.h
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// AsyncLog dosyasını boyut veya yaş sınırında döndürür. Döndürme yazıcı
+// thread'inde yapılır (dosya kapatılır, zaman damgalı ada taşınır, yenisi
+// açılır); üreticiler kuyruğa yazmaya devam eder, hiç beklemez. Eski dosyalar
+// düşük öncelikli bir thread'de FastCompressor ile sıkıştırılır ve en yeni
+// retainCount tanesi dışındakiler silinir:
+//
+//     error_log.txt                                      (etkin)
+//     error_log.20240131-235959-123-000004.txt.lmz       (arşiv, sıralama = zaman)
+//
+// Yaş, dosyanın bu süreçte açıldığı andan ölçülür.
+class LogRotation {
+public:
+    static constexpr uint64_t DEFAULT_MAX_BYTES = 8ull * 1024 * 1024;
+    static constexpr int64_t DEFAULT_MAX_AGE_MS = 24ll * 60 * 60 * 1000;
+    static constexpr int DEFAULT_RETAIN_COUNT = 5;
+    static constexpr size_t CHUNK_BYTES = 1024 * 1024;        // Sıkıştırma bloğu
+    static constexpr char COMPRESSED_EXTENSION[] = ".lmz";
+    static constexpr char FILE_MAGIC[8] = { 'L', 'M', 'W', 'L', 'O', 'G', 'Z', '\0' };
+
+    struct Policy {
+        uint64_t maxBytes;          // 0: boyuta göre döndürme yok
+        int64_t maxAgeMs;           // 0: yaşa göre döndürme yok
+        int retainCount;            // Tutulan arşiv sayısı (etkin dosya hariç)
+        bool compress;
+
+        Policy()
+            : maxBytes(DEFAULT_MAX_BYTES), maxAgeMs(DEFAULT_MAX_AGE_MS), retainCount(DEFAULT_RETAIN_COUNT),
+              compress(true) {}
+    };
+
+    // Varsayılan: döndürme kapalı (SetPolicy ile açılır)
+    LogRotation();
+    // Bekleyen sıkıştırmaları bitirir
+    ~LogRotation();
+
+    LogRotation(const LogRotation&) = delete;
+    LogRotation& operator=(const LogRotation&) = delete;
+
+    void SetPolicy(const Policy& policy);
+    Policy GetPolicy() const;
+
+    // Yazıcı thread'i: etkin dosya sınırı aştı mı
+    bool IsDue(uint64_t fileBytes, int64_t openedAtMs, int64_t nowMs) const;
+    // Boyut sınırına kalan bayt; toplu yazım bunu aşmadan döndürmeye fırsat verir
+    uint64_t GetRemainingBytes(uint64_t fileBytes) const;
+
+    // Kapalı etkin dosyayı arşiv adına taşır ve sıkıştırma/temizlik işini
+    // arka plana bırakır. Taşınamazsa false (dosya olduğu gibi kullanılmaya devam eder)
+    bool Retire(const std::string& activePath, int64_t nowMs);
+
+    // Kuyruktaki sıkıştırma ve temizlik işleri bitene kadar bekler
+    void WaitIdle();
+
+    uint64_t GetRotatedCount() const;
+    uint64_t GetCompressedCount() const;
+
+    // Etkin dosyanın arşivleri, eskiden yeniye
+    static std::vector<std::filesystem::path> ListArchives(const std::string& activePath);
+    static bool CompressFile(const std::filesystem::path& source, const std::filesystem::path& destination);
+    // Sıkıştırılmış arşivi açar; bozuk dosyada false
+    static bool DecompressFile(const std::filesystem::path& source, std::ostream& out);
+
+private:
+    struct Job {
+        std::string activePath;
+        std::filesystem::path archivePath;
+    };
+
+    void CompressorLoop();
+    void EnforceRetention(const std::string& activePath, int retainCount);
+
+    mutable std::mutex mutex;
+    std::condition_variable jobCondition;
+    std::condition_variable idleCondition;
+    Policy policy;
+    std::deque<Job> jobs;
+    bool busy;
+    bool stopping;
+    uint64_t sequence;
+    uint64_t rotatedCount;
+    uint64_t compressedCount;
+    std::thread compressor;                 // İlk döndürmede başlatılır
+};
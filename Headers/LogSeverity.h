@@ -0,0 +1,27 @@
+// Headers/LogSeverity.h
+#pragma once
+
+#include <cstdint>
+
+// Logger (LogLevel) ve ErrorHandler (ErrorLevel) seviyelerinin ortak karşılığı
+enum class LogSeverity : uint8_t {
+    Trace,
+    Debug,
+    Info,
+    Warning,
+    Error,
+    Critical,
+    Count
+};
+
+inline const char* GetLogSeverityName(LogSeverity severity) {
+    switch (severity) {
+        case LogSeverity::Trace:    return "TRACE";
+        case LogSeverity::Debug:    return "DEBUG";
+        case LogSeverity::Info:     return "INFO";
+        case LogSeverity::Warning:  return "WARNING";
+        case LogSeverity::Error:    return "ERROR";
+        case LogSeverity::Critical: return "CRITICAL";
+        default:                    return "UNKNOWN";
+    }
+}
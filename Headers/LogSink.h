@@ -0,0 +1,73 @@
+// Headers/LogSink.h
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "LogSeverity.h"
+
+// "[2024-01-31 23:59:59.123] [INFO] " - dosya, hata ayıklayıcı ve çözücü aynı satır başını üretir
+class LogLinePrefix {
+public:
+    LogLinePrefix() : cachedSecond(INT64_MIN), date{} {}
+    void Append(std::string& out, int64_t timestampMs, LogSeverity severity);
+
+private:
+    int64_t cachedSecond;      // Aynı saniyedeki kayıtlar localtime'a gitmez
+    char date[32];
+};
+
+// Yazıcı thread'inin kuyruktan aldığı kayıt. Payload hücreye aittir; kayıt
+// sadece Consume süresince geçerlidir. Metin, isteyen ilk sink için bir kez
+// biçimlendirilir, diğerleri aynı metni kullanır.
+class LogRecord {
+public:
+    LogRecord(int64_t timestampMs, LogSeverity severity, uint16_t formatId, const uint8_t* payload, size_t length,
+              std::string& textBuffer)
+        : timestampMs(timestampMs), severity(severity), formatId(formatId), payload(payload), length(length),
+          text(textBuffer), rendered(false) {}
+
+    int64_t GetTimestampMs() const { return timestampMs; }      // system_clock, epoch'tan beri
+    LogSeverity GetSeverity() const { return severity; }
+    uint16_t GetFormatId() const { return formatId; }           // BinaryLog::TEXT_FORMAT: payload düz metin
+    const uint8_t* GetPayload() const { return payload; }
+    size_t GetLength() const { return length; }
+
+    // Satır başı olmadan mesaj
+    const std::string& GetText() const;
+
+private:
+    int64_t timestampMs;
+    LogSeverity severity;
+    uint16_t formatId;
+    const uint8_t* payload;
+    size_t length;
+    std::string& text;
+    mutable bool rendered;
+};
+
+// AsyncLog'un yazıcı thread'inin beslediği çıktı. Her sink kendi seviye
+// süzgecine sahiptir; bir yazım döngüsü BeginBatch, kabul edilen her kayıt
+// için Consume ve EndBatch çağrılarından oluşur. Hepsi yazıcı thread'inde ve
+// AsyncLog'un sink kilidi altında çalışır, sink'in kendi kilidi gerekmez.
+class LogSink {
+public:
+    explicit LogSink(LogSeverity minimumSeverity = LogSeverity::Trace) : minimumSeverity(minimumSeverity) {}
+    virtual ~LogSink() = default;
+
+    LogSink(const LogSink&) = delete;
+    LogSink& operator=(const LogSink&) = delete;
+
+    void SetMinimumSeverity(LogSeverity severity) { minimumSeverity.store(severity, std::memory_order_relaxed); }
+    LogSeverity GetMinimumSeverity() const { return minimumSeverity.load(std::memory_order_relaxed); }
+    bool Accepts(LogSeverity severity) const { return severity >= minimumSeverity.load(std::memory_order_relaxed); }
+
+    virtual void BeginBatch() {}
+    virtual void Consume(const LogRecord& record) = 0;
+    virtual void EndBatch() {}
+
+private:
+    std::atomic<LogSeverity> minimumSeverity;
+};
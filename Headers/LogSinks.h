@@ -0,0 +1,102 @@
+// Headers/LogSinks.h
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "LogHistory.h"
+#include "LogRotation.h"
+#include "LogSink.h"
+
+// Metin veya ikili log dosyası. Kayıtlar batch'te biriktirilir ve döngü
+// sonunda tek fwrite ile yazılır; döndürme açıksa batch boyut sınırında
+// bölünür (LogRotation.h). AsyncLog'un yerleşik sink'idir; dosya AsyncLog::SetFile
+// üzerinden açılır ki yazıcıyla aynı kilit altında değişsin.
+class LogFileSink : public LogSink {
+public:
+    enum class Encoding : uint8_t {
+        Text,       // Satır satır okunabilir metin; ikili kayıtlar yazıcıda biçimlendirilir
+        Binary      // BinaryLog kayıtları; LMWallpaperLogDecode ile metne çevrilir
+    };
+
+    LogFileSink();
+    ~LogFileSink() override;
+
+    // Boş yol dosyayı kapatır. Dosya sonuna eklenir
+    bool Open(const std::string& filePath, Encoding encoding);
+    void SetRotation(const LogRotation::Policy& policy) { rotation.SetPolicy(policy); }
+    LogRotation& GetRotation() { return rotation; }
+
+    void BeginBatch() override;
+    void Consume(const LogRecord& record) override;
+    void EndBatch() override;
+
+private:
+    bool OpenFile();
+    void Rotate();
+    void WriteBatch();
+    void UpdateLimit();
+
+    std::FILE* file;
+    std::string filePath;
+    uint64_t fileBytes;
+    int64_t fileOpenedMs;
+    uint64_t limit;                         // Batch bu boyuta ulaşınca yazılıp döndürme denetlenir
+    Encoding encoding;
+    std::vector<bool> definedFormats;       // Bu ikili dosyaya yazılmış biçimler
+    LogLinePrefix linePrefix;
+    std::string batch;
+    LogRotation rotation;
+};
+
+// Son kayıtlar bellekte, seviye başına sınırlı halkalarda (LogHistory.h)
+class LogHistorySink : public LogSink {
+public:
+    explicit LogHistorySink(LogSeverity minimumSeverity = LogSeverity::Info,
+                            const LogHistory::Capacities& capacities = LogHistory::DefaultCapacities())
+        : LogSink(minimumSeverity), history(capacities) {}
+
+    void Consume(const LogRecord& record) override;
+
+    LogHistory& GetHistory() { return history; }
+    const LogHistory& GetHistory() const { return history; }
+
+private:
+    LogHistory history;
+};
+
+// Hata ayıklayıcı çıktısı (Windows: OutputDebugString, diğerleri: stderr).
+// Döngünün satırları tek çağrıda gönderilir; stream verilirse oraya yazılır.
+class LogDebuggerSink : public LogSink {
+public:
+    explicit LogDebuggerSink(LogSeverity minimumSeverity = LogSeverity::Debug, std::FILE* stream = nullptr)
+        : LogSink(minimumSeverity), stream(stream) {}
+
+    void Consume(const LogRecord& record) override;
+    void EndBatch() override;
+
+private:
+    std::FILE* stream;
+    LogLinePrefix linePrefix;
+    std::string lines;
+};
+
+// Seviye başına kayıt sayacı; herhangi bir thread'den okunabilir
+class LogMetricsSink : public LogSink {
+public:
+    explicit LogMetricsSink(LogSeverity minimumSeverity = LogSeverity::Trace);
+
+    void Consume(const LogRecord& record) override;
+
+    uint64_t GetCount(LogSeverity severity) const;
+    uint64_t GetTotalCount() const;
+    uint64_t GetPayloadBytes() const { return payloadBytes.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> counts[static_cast<size_t>(LogSeverity::Count)];
+    std::atomic<uint64_t> payloadBytes;
+};
@@ -0,0 +1,33 @@
+// Headers/LogText.h
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+// Sabit boyutlu log hücrelerine (AsyncLog, LogHistory, BinaryLog) metin kopyalama.
+// Kırpma çok baytlı bir UTF-8 karakterini bölmez; aksi halde sink'ler ve
+// görüntüleyici geçersiz UTF-8 alır.
+
+constexpr char LOG_TRUNCATION_MARKER[] = "\xE2\x80\xA6";   // U+2026 "…"
+constexpr size_t LOG_TRUNCATION_MARKER_BYTES = sizeof(LOG_TRUNCATION_MARKER) - 1;
+
+// limit baytı aşmayan ve bir karakterin ortasında bitmeyen en uzun önek
+inline size_t GetUtf8PrefixLength(const char* text, size_t length, size_t limit) {
+    if (length <= limit) return length;
+    size_t cut = limit;
+    // Devam baytında (10xxxxxx) kesilmez; geçersiz girdide en fazla 3 bayt geri gidilir
+    for (int i = 0; i < 3 && cut > 0 && (static_cast<unsigned char>(text[cut]) & 0xC0) == 0x80; ++i) --cut;
+    return cut;
+}
+
+// Sığmayan metni karakter sınırında kırpar ve sonuna "…" ekler; yazılan bayt sayısı
+inline size_t CopyLogText(char* destination, size_t capacity, const char* text, size_t length) {
+    if (length <= capacity) {
+        if (length > 0) std::memcpy(destination, text, length);
+        return length;
+    }
+    const size_t cut = GetUtf8PrefixLength(text, length, capacity - LOG_TRUNCATION_MARKER_BYTES);
+    std::memcpy(destination, text, cut);
+    std::memcpy(destination + cut, LOG_TRUNCATION_MARKER, LOG_TRUNCATION_MARKER_BYTES);
+    return cut + LOG_TRUNCATION_MARKER_BYTES;
+}
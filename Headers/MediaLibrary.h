@@ -0,0 +1,119 @@
+// Headers/MediaLibrary.h
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ContainerProbe.h"
+#include "DirectoryWatcher.h"
+#include "PerceptualHash.h"
+
+// Duvar kağıdı klasörlerinin artımlı indeksi. Probe sonuçları, thumbnail
+// referansları ve dosya kimliği (boyut, mtime, inode / dosya ID) kompakt
+// bir ikili dosyada tutulur; yeniden taramada sadece değişen dosyalar
+// tekrar probe edilir.
+class MediaLibrary {
+public:
+    struct FileIdentity {
+        uint64_t size;
+        int64_t modifiedTime;   // Epoch'tan beri nanosaniye (Windows: FILETIME)
+        uint64_t fileId;        // inode veya NTFS dosya indeksi
+
+        FileIdentity() : size(0), modifiedTime(0), fileId(0) {}
+        bool operator==(const FileIdentity& other) const {
+            return size == other.size && modifiedTime == other.modifiedTime && fileId == other.fileId;
+        }
+        bool operator!=(const FileIdentity& other) const { return !(*this == other); }
+    };
+
+    struct Entry {
+        std::filesystem::path path;
+        FileIdentity identity;
+        ContainerProbe::Result info;
+        bool probed;                        // Probe başarılı oldu mu
+        std::filesystem::path thumbnailPath;
+        std::vector<uint64_t> frameHashes;  // Örneklenen karelerin pHash'leri
+        std::filesystem::path previewPath;  // Animasyonlu önizleme (AnimatedPreview)
+
+        Entry() : probed(false) {}
+    };
+
+    struct ScanStats {
+        size_t total;
+        size_t added;
+        size_t changed;
+        size_t removed;
+        size_t unchanged;
+        double seconds;
+
+        ScanStats() : total(0), added(0), changed(0), removed(0), unchanged(0), seconds(0.0) {}
+    };
+
+    // DirectoryWatcher değişikliklerinin kütüphaneye uygulanmış hali;
+    // arayüz listesi ve thumbnail kuyruğu bunları tek tek işler.
+    struct Update {
+        enum class Kind {
+            Added,
+            Removed,
+            Changed,
+            Renamed,
+            Rescanned   // İzleyici olay kaybetti, klasör baştan tarandı
+        };
+
+        Kind kind;
+        std::filesystem::path path;
+        std::filesystem::path oldPath;
+    };
+
+    static constexpr uint32_t STORE_MAGIC = 0x4C574D4C;  // "LMWL"
+    static constexpr uint32_t STORE_VERSION = 3;   // v2: kare hash'leri, v3: önizleme yolu
+
+    MediaLibrary();
+    ~MediaLibrary();
+
+    bool Load(const std::filesystem::path& storePath);
+    bool Save(const std::filesystem::path& storePath) const;
+
+    ScanStats Rescan(const std::filesystem::path& directory, bool recursive = false);
+    std::vector<Update> ApplyChanges(const std::vector<DirectoryWatcher::Change>& changes);
+
+    bool GetEntry(const std::filesystem::path& filePath, Entry& entry) const;
+    std::vector<Entry> GetEntries() const;
+    size_t GetEntryCount() const;
+
+    // Kimlik hâlâ geçerliyse önbellekteki probe sonucunu döndürür
+    bool GetVideoInfo(const std::filesystem::path& filePath, ContainerProbe::Result& info) const;
+    bool SetThumbnail(const std::filesystem::path& filePath, const std::filesystem::path& thumbnailPath);
+    bool SetAnimatedPreview(const std::filesystem::path& filePath, const std::filesystem::path& previewPath);
+
+    // Algısal kopya tespiti: hash'ler thumbnail üretimi sırasında kaydedilir
+    bool SetFrameHashes(const std::filesystem::path& filePath, const std::vector<uint64_t>& frameHashes);
+    bool FindDuplicate(const std::filesystem::path& filePath, const std::vector<uint64_t>& frameHashes,
+                       Entry& original, int maxDistance = PerceptualHash::DUPLICATE_DISTANCE) const;
+    std::vector<std::vector<std::filesystem::path>> FindDuplicateGroups(
+        int maxDistance = PerceptualHash::DUPLICATE_DISTANCE) const;
+
+    void SetWorkerCount(unsigned count) { workerCount = count ? count : 1; }
+
+    static bool ReadFileIdentity(const std::filesystem::path& filePath, FileIdentity& identity);
+    static bool IsLibraryExtension(const std::filesystem::path& filePath);
+
+private:
+    static std::string MakeKey(const std::filesystem::path& filePath);
+    bool RefreshEntry(const std::filesystem::path& filePath, Update& update);
+    bool RemoveEntry(const std::filesystem::path& filePath);
+    void RebuildHashIndex() const;
+
+    std::unordered_map<std::string, Entry> entries;
+    mutable std::mutex mutex;
+    unsigned workerCount;
+
+    // Kare hash'leri üzerinde Hamming indeksi; kayıt değişince tembel olarak yeniden kurulur
+    mutable HashIndex hashIndex;
+    mutable std::vector<const Entry*> hashOwners;   // Kare -> kayıt
+    mutable bool hashIndexDirty;
+};
@@ -0,0 +1,128 @@
+// Headers/MemoryAccounting.h
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Bellek kullanımının alt sistemlere göre etiketlenmesi. Çalışma kümesi (RSS)
+// büyümenin kaynağını söylemez ve sayfa dışı bırakma ile sahte düşüş gösterir;
+// temizlik kararları bunun yerine bu kategorilerden verilir.
+enum class MemoryCategory : uint8_t {
+    Frames,        // Oynatma kare buffer'ları
+    ImageCache,    // Yüklenmiş duvar kağıdı görüntüleri
+    Thumbnails,    // Thumbnail ve animasyonlu önizlemeler
+    Decoder,       // Çözücüden kilitlenmiş örnek buffer'ları
+    Logging,       // Bellekte tutulan log geçmişi
+    Scratch,       // Kare başına geçici çalışma alanı (FrameArena)
+    Count
+};
+
+class MemoryAccounting {
+public:
+    static constexpr size_t CATEGORY_COUNT = static_cast<size_t>(MemoryCategory::Count);
+
+    struct CategoryUsage {
+        size_t currentBytes;
+        size_t peakBytes;
+        uint64_t allocations;   // Add çağrısı sayısı
+    };
+
+    struct Snapshot {
+        std::array<CategoryUsage, CATEGORY_COUNT> categories;
+        size_t trackedBytes;
+
+        const CategoryUsage& operator[](MemoryCategory category) const {
+            return categories[static_cast<size_t>(category)];
+        }
+    };
+
+    // İşletim sisteminin gördüğü süreç belleği (Linux: /proc/self/smaps_rollup,
+    // Windows: PROCESS_MEMORY_COUNTERS_EX)
+    struct ProcessMemory {
+        size_t residentBytes;      // RSS / çalışma kümesi
+        size_t privateBytes;       // Süreçe özel (paylaşılmayan) sayfalar / commit
+        size_t anonymousBytes;     // Dosyaya dayanmayan sayfalar (heap, çözücü havuzları)
+        size_t swapBytes;
+
+        ProcessMemory() : residentBytes(0), privateBytes(0), anonymousBytes(0), swapBytes(0) {}
+    };
+
+    // Sıcak yol: sadece relaxed atomik işlemler, kilit yok
+    static void Add(MemoryCategory category, size_t bytes) {
+        Counter& counter = counters[static_cast<size_t>(category)];
+        const size_t current = counter.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        counter.allocations.fetch_add(1, std::memory_order_relaxed);
+
+        size_t peak = counter.peak.load(std::memory_order_relaxed);
+        while (current > peak &&
+               !counter.peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+        }
+    }
+
+    static void Subtract(MemoryCategory category, size_t bytes) {
+        counters[static_cast<size_t>(category)].current.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    static size_t GetCurrent(MemoryCategory category) {
+        return counters[static_cast<size_t>(category)].current.load(std::memory_order_relaxed);
+    }
+
+    static CategoryUsage GetUsage(MemoryCategory category);
+    static Snapshot TakeSnapshot();
+    static void ResetPeaks();
+
+    static const char* GetCategoryName(MemoryCategory category);
+
+    static bool QueryProcessMemory(ProcessMemory& memory);
+    // smaps_rollup metnini ayrıştırır (testler için ayrı)
+    static bool ParseSmapsRollup(const std::string& text, ProcessMemory& memory);
+
+    // Bir buffer'ın boyutunu kategoriye bağlar; yok edilince veya Set ile
+    // boyut değişince sayaç farkı kadar güncellenir.
+    class Tracker {
+    public:
+        explicit Tracker(MemoryCategory category) : category(category), bytes(0) {}
+        ~Tracker() { Set(0); }
+
+        Tracker(Tracker&& other) noexcept : category(other.category), bytes(other.bytes) { other.bytes = 0; }
+        Tracker& operator=(Tracker&& other) noexcept {
+            if (this != &other) {
+                Set(0);
+                category = other.category;
+                bytes = other.bytes;
+                other.bytes = 0;
+            }
+            return *this;
+        }
+        Tracker(const Tracker&) = delete;
+        Tracker& operator=(const Tracker&) = delete;
+
+        void Set(size_t newBytes) {
+            if (newBytes > bytes) {
+                Add(category, newBytes - bytes);
+            } else if (newBytes < bytes) {
+                Subtract(category, bytes - newBytes);
+            }
+            bytes = newBytes;
+        }
+
+        size_t Get() const { return bytes; }
+
+    private:
+        MemoryCategory category;
+        size_t bytes;
+    };
+
+private:
+    // Her kategori kendi önbellek satırında: farklı thread'lerin güncellemeleri çakışmaz
+    struct alignas(64) Counter {
+        std::atomic<size_t> current{0};
+        std::atomic<size_t> peak{0};
+        std::atomic<uint64_t> allocations{0};
+    };
+
+    static std::array<Counter, CATEGORY_COUNT> counters;
+};
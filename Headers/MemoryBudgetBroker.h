@@ -0,0 +1,95 @@
+// Headers/MemoryBudgetBroker.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+enum class MemoryPressure : uint8_t {
+    Normal,
+    Moderate,
+    Critical
+};
+
+// Toplam bellek bütçesini kayıtlı tüketiciler (kare buffer'ları, thumbnail
+// cache'i, ...) arasında önceliğe göre paylaştırır. Her tüketici bir minimum ve
+// istenen miktar bildirir; bütçesi değiştiğinde veya baskı seviyesi değiştiğinde
+// callback'i çağrılır ve kendini verilen bütçeye indirmesi beklenir.
+class MemoryBudgetBroker {
+public:
+    using ConsumerId = uint32_t;
+    // Tüketici budgetBytes'ı aşmayacak şekilde küçülmeli (bütçe büyüdüyse büyüyebilir)
+    using BudgetCallback = std::function<void(size_t budgetBytes, MemoryPressure pressure)>;
+
+    struct Consumer {
+        std::string name;
+        int priority;           // Büyük olan önce doyurulur
+        size_t minimumBytes;    // Her koşulda verilir
+        size_t desiredBytes;
+        BudgetCallback onBudget;
+    };
+
+    // Kullanım / bütçe oranları: girişler çıkışlardan yüksek (histerezis)
+    static constexpr double MODERATE_ENTER = 0.80;
+    static constexpr double MODERATE_EXIT = 0.70;
+    static constexpr double CRITICAL_ENTER = 0.95;
+    static constexpr double CRITICAL_EXIT = 0.85;
+
+    static constexpr double MODERATE_BUDGET_SCALE = 0.75;   // Orta baskıda dağıtılan pay
+    static constexpr double GROW_HYSTERESIS = 0.10;         // Bütçe artışları %10'u geçince bildirilir
+
+    explicit MemoryBudgetBroker(size_t totalBudget);
+
+    // Uygulama genelindeki broker (VideoPlayer, VideoPreview, MemoryOptimizer)
+    static MemoryBudgetBroker& GetInstance();
+
+    ConsumerId Register(Consumer consumer);
+    // Döndükten sonra tüketicinin callback'i bir daha çağrılmaz
+    void Unregister(ConsumerId id);
+    void UpdateDemand(ConsumerId id, size_t minimumBytes, size_t desiredBytes);
+
+    void SetTotalBudget(size_t bytes);
+    // Ölçülen kullanıma göre iç baskı seviyesini günceller
+    void UpdateUsage(size_t usedBytes);
+    // İşletim sisteminden gelen baskı; etkin seviye iç ve dış seviyenin büyüğüdür
+    void SetExternalPressure(MemoryPressure pressure);
+    void Rebalance();
+
+    size_t GetGrant(ConsumerId id) const;
+    // Tüketicinin isteği sınırsız olsaydı alabileceği bütçe: diğerlerinin
+    // minimumları ve daha yüksek öncelikli istekler düşülür (yükleme öncesi kabul için)
+    size_t GetAvailableFor(ConsumerId id) const;
+    size_t GetTotalBudget() const;
+    MemoryPressure GetPressure() const;
+
+    static const char* GetPressureName(MemoryPressure pressure);
+
+private:
+    struct Entry {
+        ConsumerId id;
+        Consumer consumer;
+        size_t grant;
+        MemoryPressure notifiedPressure;
+        bool notified;
+    };
+
+    MemoryPressure EffectivePressure() const;
+    std::vector<size_t> Allocate(MemoryPressure pressure) const;
+    // Bütçesi veya baskı seviyesi değişen tüketicileri döndürür
+    std::vector<ConsumerId> RebalanceLocked();
+    void Dispatch(const std::vector<ConsumerId>& changed);
+
+    mutable std::mutex mutex;
+    // Callback'ler kilit dışında çağrılır; Unregister bunun bitmesini bekler.
+    // Callback içinden broker'ı tekrar çağırmak mümkün olsun diye recursive.
+    std::recursive_mutex dispatchMutex;
+    std::vector<Entry> consumers;
+    ConsumerId nextId;
+    size_t totalBudget;
+    size_t usedBytes;
+    MemoryPressure usagePressure;
+    MemoryPressure externalPressure;
+};
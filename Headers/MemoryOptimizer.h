@@ -3,15 +3,36 @@
 
 #include "framework.h"
 #include "ErrorHandler.h"
+#include "MemoryAccounting.h"
+#include "MemoryBudgetBroker.h"
+#include "MemoryPressureMonitor.h"
 
+// Temizlik kararları çalışma kümesinden değil, MemoryAccounting kategorilerinden
+// verilir. Süreç belleği sadece etiketlenmemiş (çözücü içi, heap parçalanması)
+// kısmı ayırmak için okunur. Temizlik işletim sisteminin baskı bildirimleriyle
+// tetiklenir; bildirim kaynağı yoksa periyodik yoklamaya geri düşülür.
+// Sistem baskısı olmasa da uygulamanın kendi limitleri (memoryLimit, kategori
+// limitleri, broker histerezisi) seyrek bir kontrolle yine de uygulanır.
 class MemoryOptimizer {
 private:
-    std::atomic<size_t> currentMemoryUsage;
+    static constexpr int POLL_INTERVAL_SECONDS = 10;          // Bildirim kaynağı yokken
+    static constexpr int LIMIT_CHECK_INTERVAL_SECONDS = 60;   // Bildirimler varken
+
+
+    std::atomic<size_t> currentMemoryUsage;   // Etiketlenmiş toplam
     std::atomic<size_t> peakMemoryUsage;
     std::atomic<size_t> memoryLimit;
+    std::array<std::atomic<size_t>, MemoryAccounting::CATEGORY_COUNT> categoryLimits;
+    MemoryAccounting::Snapshot lastSnapshot;
+    MemoryAccounting::ProcessMemory processMemory;
+    MemoryPressureMonitor pressureMonitor;
     std::unique_ptr<std::thread> cleanupThread;
+    bool pressureNotifications;   // true: cleanupThread sadece seyrek limit kontrolü yapar
     std::atomic<bool> isRunning;
     std::mutex mutex;
+    std::mutex cleanupMutex;      // Yoklama ve baskı thread'leri AutoCleanup'ı aynı anda çalıştırmaz
+    std::mutex stopMutex;
+    std::condition_variable stopCondition;
 
 public:
     MemoryOptimizer();
@@ -23,9 +44,17 @@ public:
     size_t GetCurrentMemoryUsage();
     size_t GetPeakMemoryUsage() const { return peakMemoryUsage; }
     
+    void SetCategoryLimit(MemoryCategory category, size_t bytes) { categoryLimits[static_cast<size_t>(category)] = bytes; }
+    size_t GetCategoryLimit(MemoryCategory category) const { return categoryLimits[static_cast<size_t>(category)]; }
+    MemoryAccounting::Snapshot GetSnapshot();
+    // Süreç özel belleğinin hiçbir kategoriye yazılmamış kısmı
+    size_t GetUntrackedMemory();
+    
     void MonitorMemoryUsage();
     void OptimizeMemoryAllocation();
 
 private:
     void CleanupLoop();
+    void OnMemoryPressure(MemoryPressure pressure);
+    bool IsOverLimit(const MemoryAccounting::Snapshot& snapshot, MemoryCategory category) const;
 };
\ No newline at end of file
@@ -0,0 +1,66 @@
+// Headers/MemoryPressureMonitor.h
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "MemoryBudgetBroker.h"
+
+// İşletim sisteminin bellek baskısı bildirimlerini dinler (Windows:
+// CreateMemoryResourceNotification, Linux: /proc/pressure/memory PSI
+// tetikleyicileri). Periyodik yoklama yoktur: baskı yokken thread hiç uyanmaz.
+// Olaylar kısa bir debounce ile birleştirilir; seviye değişince callback çağrılır.
+class MemoryPressureMonitor {
+public:
+    using PressureCallback = std::function<void(MemoryPressure pressure)>;
+
+    static constexpr int DEFAULT_DEBOUNCE_MS = 50;
+    static constexpr int DEFAULT_RECOVERY_MS = 4000;   // Bu süre olay gelmezse Normal'e dön
+    // PSI: ayrıcalıksız süreçler için pencere en az 2 s ve 2 s'nin katı olmalı
+    static constexpr int PSI_WINDOW_US = 2000000;
+    static constexpr int PSI_MODERATE_STALL_US = 100000;   // "some": en az bir görev bekledi
+    static constexpr int PSI_CRITICAL_STALL_US = 200000;   // "full": tüm görevler bekledi
+
+    struct Options {
+        int debounceMs;
+        int recoveryMs;
+        bool useSystemSource;   // false: sadece Inject (testler)
+
+        Options() : debounceMs(DEFAULT_DEBOUNCE_MS), recoveryMs(DEFAULT_RECOVERY_MS), useSystemSource(true) {}
+    };
+
+    MemoryPressureMonitor();
+    ~MemoryPressureMonitor();
+
+    // Sistem kaynağı istenip açılamazsa false döner (çağıran yoklamaya geri düşebilir)
+    bool Start(PressureCallback callback, const Options& options = Options());
+    void Stop();
+    bool IsRunning() const { return isRunning; }
+
+    // Başka bir kaynaktan gelen baskı olayını aynı debounce yolundan geçirir
+    void Inject(MemoryPressure pressure);
+
+    MemoryPressure GetLevel() const { return level; }
+    // Bekleme döngüsünün kaç kez uyandığı (boşta sabit kalmalı)
+    uint64_t GetWakeupCount() const { return wakeupCount; }
+
+private:
+    struct PlatformState;
+
+    void MonitorLoop();
+    void Wake();
+
+    PressureCallback callback;
+    Options options;
+    std::unique_ptr<PlatformState> platform;
+    std::unique_ptr<std::thread> monitorThread;
+    std::atomic<bool> isRunning;
+    std::atomic<bool> shouldStop;
+    std::atomic<MemoryPressure> level;
+    std::atomic<int> injected;   // -1: yok, aksi halde en yüksek enjekte edilen seviye
+    std::atomic<uint64_t> wakeupCount;
+};
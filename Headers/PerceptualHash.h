@@ -0,0 +1,87 @@
+// Headers/PerceptualHash.h
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Videolardan örneklenen kareler için 64 bitlik algısal hash'ler (dHash / pHash).
+// Yeniden kodlanmış, farklı çözünürlükteki veya kırpılmış kopyalar birbirine
+// küçük Hamming mesafesinde hash üretir.
+class PerceptualHash {
+public:
+    // 8-bit gri (bytesPerPixel = 1) veya BGRA/BGRX (bytesPerPixel = 4) kare.
+    // Alttan yukarı bitmap'ler için negatif stride kullanılabilir.
+    struct Image {
+        const uint8_t* pixels;
+        int width;
+        int height;
+        int stride;
+        int bytesPerPixel;
+    };
+
+    static constexpr int DEFAULT_SAMPLE_COUNT = 4;   // Video başına örneklenen kare
+    static constexpr int DUPLICATE_DISTANCE = 10;    // 64 bit üzerinden benzerlik eşiği
+
+    static uint64_t DHash(const Image& image);
+    static uint64_t PHash(const Image& image);
+
+    static int Distance(uint64_t a, uint64_t b) { return std::popcount(a ^ b); }
+
+    // Düz dizide kaba kuvvet arama; döngü popcount'a indirgendiği için
+    // derleyici vektörleştirebilir. Eşleşen indeksleri matches'a ekler.
+    static size_t FindWithin(uint64_t query, const uint64_t* hashes, size_t count,
+                             int maxDistance, std::vector<uint32_t>& matches);
+
+    // Süre boyunca kırpmalardan az etkilenecek şekilde dağıtılmış örnek zamanları (saniye)
+    static std::vector<double> SamplePositions(double duration, int sampleCount = DEFAULT_SAMPLE_COUNT);
+
+    // İki videonun kare hash'lerinin çoğunluğu eşleşiyorsa kopya kabul edilir
+    static bool IsDuplicate(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b,
+                            int maxDistance = DUPLICATE_DISTANCE);
+};
+
+// Hamming mesafesi için çoklu indeks hashing (multi-index hashing): 64 bit
+// dört 16 bitlik parçaya bölünür. Mesafesi r'yi aşmayan her hash'in en az
+// bir parçası sorgunun aynı parçasına r/4 içindedir; sadece bu kovalar taranır.
+// Kovalar ilk sorguda kurulur; eşzamanlı sorgular dışarıdan kilitlenmelidir.
+class HashIndex {
+public:
+    struct Match {
+        uint32_t id;
+        int distance;
+    };
+
+    static constexpr int CHUNK_COUNT = 4;
+    static constexpr int MAX_CHUNK_RADIUS = 2;   // r >= 12'de düz tarama daha ucuz
+
+    void Insert(uint64_t hash, uint32_t id);
+    void Query(uint64_t hash, int maxDistance, std::vector<Match>& matches) const;
+    bool Nearest(uint64_t hash, Match& match) const;
+
+    void Reserve(size_t count);
+    void Clear();
+    size_t Size() const { return hashes.size(); }
+
+private:
+    static constexpr int CHUNK_BITS = 16;
+    static constexpr size_t BUCKET_COUNT = size_t(1) << CHUNK_BITS;
+
+    static uint32_t Chunk(uint64_t hash, int chunk) {
+        return static_cast<uint32_t>(hash >> (chunk * CHUNK_BITS)) & 0xFFFFu;
+    }
+
+    void Build() const;
+    void ScanBucket(uint64_t hash, int chunk, uint32_t bucket, int chunkRadius, int maxDistance,
+                    std::vector<Match>& matches) const;
+
+    std::vector<uint64_t> hashes;
+    std::vector<uint32_t> ids;
+
+    // Her parça için kova başlangıçları (CSR) ve kovalara sıralanmış hash indeksleri;
+    // ekleme sonrası ilk sorguda sayma sıralamasıyla yeniden kurulur
+    mutable std::vector<uint32_t> bucketOffsets[CHUNK_COUNT];
+    mutable std::vector<uint32_t> bucketItems[CHUNK_COUNT];
+    mutable bool built = false;
+};
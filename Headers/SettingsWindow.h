@@ -5,9 +5,15 @@
 #include <dwmapi.h>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "resource.h"
 #include "ThemeManager.h"
 #include "VideoPreview.h"
+#include "AnimatedPreview.h"
+#include "ThumbnailQueue.h"
+#include "MediaLibrary.h"
+#include "DirectoryWatcher.h"
 #include "MonitorManager.h"
 #include "framework.h"
 #include "ErrorHandler.h"
@@ -20,6 +26,26 @@ private:
     bool isDragging;
     POINT dragOffset;
 
+    // Seçili videonun klasörü: indeks, canlı değişiklik takibi ve izleyici
+    // thread'inden UI thread'ine aktarılan güncellemeler
+    MediaLibrary mediaLibrary;
+    DirectoryWatcher folderWatcher;
+    std::filesystem::path watchedFolder;
+    std::mutex libraryUpdateMutex;
+    std::vector<MediaLibrary::Update> pendingLibraryUpdates;
+
+    // Fare üzerindeyken oynatılan animasyonlu önizleme
+    VideoPreview videoPreview;
+    std::unique_ptr<ThumbnailQueue> previewQueue;
+    AnimatedPreview::Player hoverPreview;
+    ID2D1Bitmap* previewBitmap;
+    MemoryAccounting::Tracker previewBitmapMemory{MemoryCategory::Thumbnails};
+    std::wstring previewVideoPath;
+    bool previewHovered;
+
+    static const int PREVIEW_X = 20;
+    static const int PREVIEW_Y = 280;
+
     void CreateModernWindow();
     void InitializeD2D();
     void SetupWindowShadow();
@@ -28,6 +54,17 @@ private:
     void LoadSettings();
     void SaveSettings();
 
+    void RequestAnimatedPreview(const std::wstring& videoPath);
+    void LoadAnimatedPreview(const std::wstring& previewPath);
+    void StepAnimatedPreview();
+    void StopAnimatedPreview();
+    bool IsInPreviewArea(POINT pt) const;
+    static std::wstring GetPreviewCachePath(const std::wstring& videoPath);
+
+    void WatchVideoFolder(const std::wstring& videoPath);
+    void OnLibraryChanged();
+    static std::filesystem::path GetLibraryStorePath();
+
 public:
     SettingsWindow();
     ~SettingsWindow();
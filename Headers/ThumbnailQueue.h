@@ -0,0 +1,63 @@
+// Headers/ThumbnailQueue.h
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "MediaLibrary.h"
+
+// Thumbnail (veya animasyonlu önizleme) üretimini arka plan thread'ine taşıyan
+// tekilleştirilmiş kuyruk.
+// Kütüphane güncellemeleri (ekleme / silme / yeniden adlandırma) doğrudan
+// uygulanır; tam yeniden tarama ya da liste yeniden kurulumu gerekmez.
+class ThumbnailQueue {
+public:
+    // Videodan thumbnail üretir; başarılıysa thumbnailPath doldurulur
+    using Generator = std::function<bool(const std::filesystem::path& videoPath,
+                                         std::filesystem::path& thumbnailPath)>;
+
+    // Üretilen dosyanın kütüphanede hangi alana yazılacağı
+    enum class Target {
+        Thumbnail,
+        AnimatedPreview
+    };
+
+    ThumbnailQueue(Generator generator, MediaLibrary* library = nullptr, Target target = Target::Thumbnail);
+    ~ThumbnailQueue();
+
+    void Enqueue(const std::filesystem::path& videoPath);
+    void Remove(const std::filesystem::path& videoPath);
+    void Rename(const std::filesystem::path& oldPath, const std::filesystem::path& newPath);
+    void Apply(const std::vector<MediaLibrary::Update>& updates);
+
+    size_t GetPendingCount() const;
+    size_t GetCompletedCount() const { return completedCount; }
+    bool WaitUntilIdle(std::chrono::milliseconds timeout);
+
+private:
+    void WorkerLoop();
+
+    Generator generator;
+    MediaLibrary* library;
+    Target target;
+
+    std::deque<std::filesystem::path> queue;
+    std::unordered_set<std::string> queued;
+    mutable std::mutex mutex;
+    std::condition_variable queueCondition;
+    std::condition_variable idleCondition;
+    bool busy;
+    bool shouldStop;
+    std::atomic<size_t> completedCount;
+    std::unique_ptr<std::thread> workerThread;
+};
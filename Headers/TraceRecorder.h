@@ -0,0 +1,152 @@
+// Headers/TraceRecorder.h
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MemoryAccounting.h"
+
+// Takılma şikâyetleri için zaman çizelgesi: decode, sunum, temizlik ve
+// thumbnail thread'lerinin span'leri (Begin/End), sayaçları ve işaretleri
+// Chrome / Perfetto trace-event JSON'u olarak dökülür (chrome://tracing,
+// ui.perfetto.dev).
+//
+// Varsayılan kapalıdır; kapalıyken her çağrı tek bir relaxed yüklemedir.
+// Açıkken her thread kendi sabit kapasiteli halkasına yazar: kilit ve ayırma
+// yoktur (halka thread'in ilk olayında bir kez ayrılır), dolunca en eski
+// olaylar ezilir. Döküm yazıcıları bekletmez; kopyalanırken ezilen olaylar
+// atılır. İsimler statik ömürlü olmalıdır (işaretçi saklanır).
+//
+// Döküm istenince (WriteJson) veya kare süresi kaçırılınca (OnMissedDeadline,
+// dizin ayarlıysa ve son dökümden beri yeterli süre geçtiyse) arka planda yazılır.
+class TraceRecorder {
+public:
+    static constexpr size_t DEFAULT_EVENTS_PER_THREAD = 8192;    // 60 fps'te ~10 s; thread başına 256 KB
+    static constexpr size_t MAX_THREADS = 64;                    // Fazlası izlenmez
+    static constexpr int64_t DEFAULT_DEADLINE_DUMP_INTERVAL_MS = 30000;
+
+    // Kapsam süresince bir span; açıkken başlayan span kapatılınca da biter
+    class Span {
+    public:
+        explicit Span(const char* name, TraceRecorder& recorder = GetInstance())
+            : recorder(recorder.IsEnabled() ? &recorder : nullptr), name(name) {
+            if (this->recorder) this->recorder->Record(Phase::Begin, name, 0);
+        }
+        ~Span() {
+            if (recorder) recorder->Record(Phase::End, name, 0);
+        }
+
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+
+    private:
+        TraceRecorder* recorder;
+        const char* name;
+    };
+
+    // eventsPerThread ikinin kuvvetine yuvarlanır; dökümde thread başına en
+    // fazla eventsPerThread - 1 olay görünür (yazılıyor olabilecek hücre atlanır)
+    explicit TraceRecorder(size_t eventsPerThread = DEFAULT_EVENTS_PER_THREAD);
+    // Bekleyen dökümü bitirir
+    ~TraceRecorder();
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    static TraceRecorder& GetInstance();
+
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    void Begin(const char* name) { if (IsEnabled()) Record(Phase::Begin, name, 0); }
+    void End(const char* name) { if (IsEnabled()) Record(Phase::End, name, 0); }
+    void Counter(const char* name, int64_t value) { if (IsEnabled()) Record(Phase::Counter, name, value); }
+    void Instant(const char* name) { if (IsEnabled()) Record(Phase::Instant, name, 0); }
+
+    // Bu thread'in zaman çizelgesindeki adı; kapalıyken de çağrılabilir
+    void SetThreadName(const std::string& name);
+
+    void WriteJson(std::ostream& out) const;
+    bool WriteJson(const std::filesystem::path& path) const;
+    // Şu ana kadarki olayları dökümlerden çıkarır (yazıcıları durdurmaz)
+    void Clear();
+
+    // Kaçırılan kare süresinde dökümün yazılacağı dizin; boş yol otomatik dökümü kapatır
+    void SetDeadlineDumpDirectory(const std::filesystem::path& directory,
+                                  int64_t minIntervalMs = DEFAULT_DEADLINE_DUMP_INTERVAL_MS);
+    // Zaman çizelgesine işaret koyar ve gerekiyorsa dökümü arka plana bırakır
+    void OnMissedDeadline(const char* reason);
+    // Arka plandaki dökümler bitene kadar bekler
+    void WaitIdle();
+
+    uint64_t GetDumpCount() const;
+    std::filesystem::path GetLastDumpPath() const;
+    // MAX_THREADS dolduğu için izlenemeyen thread sayısı
+    uint64_t GetUntracedThreadCount() const { return untracedThreads.load(std::memory_order_relaxed); }
+
+private:
+    enum class Phase : uint8_t { Begin, End, Counter, Instant };
+
+    // Alanlar relaxed atomik: okuyucu yazılmakta olan olayı kopyalayabilir,
+    // kopya sonrası head denetimiyle atılır
+    struct Event {
+        std::atomic<uint64_t> timestampNs;
+        std::atomic<const char*> name;
+        std::atomic<int64_t> value;
+        std::atomic<Phase> phase;
+    };
+
+    struct ThreadBuffer {
+        std::unique_ptr<Event[]> events;
+        std::atomic<uint64_t> head;              // Sadece sahibi yazar
+        std::atomic<uint64_t> clearedBefore;
+        std::thread::id owner;
+        uint32_t tid;
+    };
+
+    struct EventCopy {
+        uint64_t timestampNs;
+        const char* name;
+        int64_t value;
+        Phase phase;
+    };
+
+    void Record(Phase phase, const char* name, int64_t value);
+    ThreadBuffer* GetThreadBuffer();
+    std::vector<EventCopy> CopyEvents(const ThreadBuffer& buffer) const;
+    void DumpLoop();
+
+    const uint64_t instanceId;                  // Thread önbelleği adres yeniden kullanımına karşı
+    const size_t capacity;
+    std::atomic<bool> enabled;
+    std::atomic<uint64_t> untracedThreads;
+
+    mutable std::mutex mutex;                   // Tampon listesi, thread adları, döküm kuyruğu
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::map<std::thread::id, std::string> threadNames;
+    MemoryAccounting::Tracker memory;
+
+    std::filesystem::path deadlineDirectory;
+    int64_t deadlineIntervalMs;
+    std::atomic<int64_t> nextDeadlineDumpMs;
+    uint64_t dumpSequence;
+    uint64_t dumpCount;
+    std::filesystem::path lastDumpPath;
+    std::deque<std::filesystem::path> pendingDumps;
+    std::condition_variable dumpCondition;
+    std::condition_variable idleCondition;
+    bool dumping;
+    bool stopping;
+    std::thread dumper;                         // İlk otomatik dökümde başlatılır
+};
@@ -3,33 +3,31 @@
 
 #include "framework.h"
 #include "MemoryOptimizer.h"
+#include "MemoryBudgetBroker.h"
+#include "FramePipeline.h"
+#include "AdmissionControl.h"
 #include "ErrorHandler.h"
 #include "ImageProcessor.h"
 
 class VideoPlayer {
 private:
-    struct FrameData {
-        ID2D1Bitmap* pBitmap;
-        DWORD timestamp;
-        
-        FrameData() : pBitmap(nullptr), timestamp(0) {}
-        ~FrameData() {
-            if (pBitmap) {
-                pBitmap->Release();
-                pBitmap = nullptr;
-            }
-        }
-    };
-    
     IGraphBuilder* pGraphBuilder;
     IMediaControl* pMediaControl;
     IVideoWindow* pVideoWindow;
     IMediaEvent* pMediaEvent;
     IBasicVideo* pBasicVideo;
     
-    std::deque<std::unique_ptr<FrameData>> frameBuffer;
-    static const int MAX_BUFFER_SIZE = 3;
-    static int maxBufferFrames;
+    static constexpr double DEFAULT_FRAME_INTERVAL_MS = 1000.0 / 30.0;
+    static constexpr size_t LARGE_PAGE_FRAME_BYTES = static_cast<size_t>(3840) * 2160 * 4;
+    // Kareler sabit slotlarda yeniden kullanılır. Derinlik kendi decode jitter'ından
+    // hesaplanır, MemoryBudgetBroker bütçesiyle kırpılır
+    FramePipeline framePipeline;
+    std::atomic<int> maxBufferFrames;
+    // Yüklemede yazılır, broker'ın dağıtım thread'inde (OnMemoryBudget) okunur
+    std::atomic<size_t> frameBytes;     // Kuyruktaki bir karenin boyutu (monitör veya küçültülmüş video)
+    std::atomic<int> admittedDepth;     // Yükleme öncesi kabulün izin verdiği en büyük derinlik
+    std::atomic<int> decodeScale;       // 1, 2, 4: kabul kareleri küçültülmüş tutmaya karar verdiyse
+    MemoryBudgetBroker::ConsumerId budgetId;
     
     bool isPlaying;
     std::wstring currentVideoPath;
@@ -38,7 +36,10 @@ private:
     
     std::unique_ptr<std::thread> videoThread;
     std::atomic<bool> shouldStop;
-    std::mutex bufferMutex;
+#ifndef NDEBUG
+    // Bu kadar kareden sonra döngü ayırma yaparsa çağrı yeri loglanır
+    static constexpr uint64_t ALLOCATION_CHECK_AFTER_FRAMES = 120;
+#endif
     
     ImageProcessor imageProcessor;
     
@@ -56,12 +57,16 @@ public:
     
     // Static methods for memory management
     static std::vector<VideoPlayer*>& GetAllInstances() { return allInstances; }
-    static void SetMaxBufferFrames(int frames) { maxBufferFrames = frames; }
     static void CleanupThreads();
     
     // Instance methods
     void ClearUnusedFrames();
-    size_t GetFrameCount() const { return frameBuffer.size(); }
+    size_t GetFrameCount() const { return framePipeline.GetQueuedCount(); }
+    int GetMaxBufferFrames() const { return maxBufferFrames; }
+    double GetDecodeStallPercentile() const { return framePipeline.GetStallPercentile(); }
+    // Aşama başına p50/p99, kuyruk derinliği, düşürülen kareler; oynatmayı durdurmaz
+    FrameTelemetry::Snapshot GetTelemetrySnapshot() const { return framePipeline.GetTelemetry().GetSnapshot(); }
+    const std::wstring& GetVideoPath() const { return currentVideoPath; }
     bool IsPlaying() const { return isPlaying; }
 
 private:
@@ -69,7 +74,12 @@ private:
     void ConfigureVideoWindow();
     void StartVideoProcessingThread();
     void VideoProcessingLoop();
-    void ProcessVideoFrame();
+    bool ProcessVideoFrame();
+    bool DecodeFrame(FramePipeline::Frame& frame);
     void Cleanup();
     HRESULT BuildGraph(const std::wstring& videoPath);
+    // Graph kurulmadan probe ile bellek ayak izini tahmin eder; sığmıyorsa false
+    bool AdmitVideo(const std::wstring& videoPath);
+    void OnMemoryBudget(size_t budgetBytes, MemoryPressure pressure);
+    void UpdateBufferDemand();
 };
\ No newline at end of file
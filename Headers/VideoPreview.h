@@ -6,6 +6,11 @@
 #include "MemoryOptimizer.h"
 #include "ErrorHandler.h"
 #include "ImageProcessor.h"
+#include "ContainerProbe.h"
+#include "MediaLibrary.h"
+#include "PerceptualHash.h"
+#include "AnimatedPreview.h"
+#include "MemoryBudgetBroker.h"
 
 class VideoPreview {
 public:
@@ -15,20 +20,31 @@ public:
         double duration;
         double fps;
         std::string codec;
+        std::string container;
+        std::string colorSpace;
+        int bitDepth;
+        uint64_t keyframeCount;
         size_t fileSize;
         
-        VideoInfo() : width(0), height(0), duration(0.0), fps(0.0), fileSize(0) {}
+        VideoInfo() : width(0), height(0), duration(0.0), fps(0.0), bitDepth(0), keyframeCount(0), fileSize(0) {}
     };
 
 private:
     ImageProcessor imageProcessor;
     std::map<std::string, std::wstring> thumbnailCache; // path -> thumbnail path
     std::mutex cacheMutex;
+    MediaLibrary* mediaLibrary;
     
     static const int MAX_CACHE_SIZE = 20;  // Maksimum 20 mini resim
+    static const int MIN_CACHE_SIZE = 4;   // Kritik baskıda bile tutulan
     static const int THUMBNAIL_SIZE = 128; // Mini resim boyutu (128x128)
+    std::atomic<size_t> maxCacheEntries;   // MemoryBudgetBroker bütçesinden
+    MemoryBudgetBroker::ConsumerId budgetId;
 
+    bool GetVideoInfoWithDirectShow(const std::wstring& videoPath, VideoInfo& info);
     bool CreateThumbnailWithDirectShow(const std::wstring& videoPath, const std::wstring& outputPath);
+    bool ReuseDuplicateThumbnail(const std::wstring& videoPath, const std::vector<uint64_t>& frameHashes,
+                                 const std::wstring& outputPath);
     bool SaveBitmapToFile(HBITMAP hBitmap, const std::wstring& filePath);
     int GetEncoderClsid(const WCHAR* format, CLSID* pClsid);
 
@@ -38,10 +54,14 @@ public:
     
     bool GenerateThumbnail(const std::wstring& videoPath, const std::wstring& outputPath);
     VideoInfo GetVideoInfo(const std::wstring& videoPath);
+    bool ComputeFrameHashes(const std::wstring& videoPath, std::vector<uint64_t>& frameHashes);
+    bool GenerateAnimatedPreview(const std::wstring& videoPath, const std::wstring& outputPath);
     void ClearThumbnailCache();
     bool IsThumbnailCached(const std::string& videoPath);
+    void SetMediaLibrary(MediaLibrary* library) { mediaLibrary = library; }
 
 private:
     void UpdateCacheSize();
+    void OnMemoryBudget(size_t budgetBytes, MemoryPressure pressure);
     void OptimizeMemoryUsage();
 };
\ No newline at end of file
@@ -15,6 +15,8 @@
 #define IDM_PERFORMANCE                 32773
 #define IDM_ABOUT                       32774
 #define IDM_EXIT                        32775
+#define IDM_HEAP_PROFILE                32776
+#define IDM_TRACE                       32777
 
 // Ayarlar penceresi kontrolleri
 #define IDC_VIDEO_PATH                  1000
@@ -42,6 +44,11 @@
 
 // Tray mesajı
 #define WM_TRAY_MESSAGE                 (WM_USER + 1)
+#define WM_PREVIEW_READY                (WM_USER + 2)
+#define WM_LIBRARY_CHANGED              (WM_USER + 3)
+
+// Zamanlayıcılar
+#define IDT_PREVIEW_ANIMATION           1
 
 // Versiyon bilgileri
 #define VS_VERSION_INFO                 1
@@ -51,7 +58,7 @@
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NO_MFC                     1
 #define _APS_NEXT_RESOURCE_VALUE        132
-#define _APS_NEXT_COMMAND_VALUE         32776
+#define _APS_NEXT_COMMAND_VALUE         32778
 #define _APS_NEXT_CONTROL_VALUE         1011
 #define _APS_NEXT_SYMED_VALUE           110
 #endif
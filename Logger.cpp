@@ -10,21 +10,25 @@ Logger& Logger::GetInstance() {
     return instance;
 }
 
-Logger::Logger() {
-    // Default constructor
+Logger::Logger()
+    : m_history(std::make_shared<LogHistorySink>(LogSeverity::Info)),
+#ifdef NDEBUG
+      m_debugger(std::make_shared<LogDebuggerSink>(LogSeverity::Warning)),
+#else
+      m_debugger(std::make_shared<LogDebuggerSink>(LogSeverity::Debug)),
+#endif
+      m_metrics(std::make_shared<LogMetricsSink>()) {
+    m_output.AddSink(m_history);
+    m_output.AddSink(m_debugger);
+    m_output.AddSink(m_metrics);
 }
 
 Logger::~Logger() {
-    if (m_logFile.is_open()) {
-        m_logFile.close();
-    }
+    // AsyncLog kuyrukta kalanları sink'lere dağıtıp dosyayı kapatır
 }
 
 void Logger::Log(const std::string& message, LogLevel level) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    LogEntry entry{ level, message, std::chrono::system_clock::now() };
-    m_history.push_back(entry);
-    WriteToFile(entry);
+    m_output.Push(ToSeverity(level), message);
 }
 
 void Logger::Log(const std::wstring& message, LogLevel level) {
@@ -32,34 +36,27 @@ void Logger::Log(const std::wstring& message, LogLevel level) {
     Log(converter.to_bytes(message), level);
 }
 
-const std::vector<LogEntry>& Logger::GetHistory() const {
-    return m_history;
-}
-
-void Logger::SetLogFile(const std::string& filePath) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (m_logFile.is_open()) {
-        m_logFile.close();
+std::vector<LogEntry> Logger::GetHistory() const {
+    std::vector<LogEntry> history;
+    for (auto& entry : m_history->GetHistory().Snapshot()) {
+        const LogLevel level = entry.severity >= LogSeverity::Error ? LogLevel::ERROR
+                             : entry.severity == LogSeverity::Warning ? LogLevel::WARNING : LogLevel::INFO;
+        history.push_back({ level, std::move(entry.message),
+                            std::chrono::system_clock::time_point(std::chrono::milliseconds(entry.timestampMs)) });
     }
-    m_logFile.open(filePath, std::ios_base::app);
+    return history;
 }
 
-void Logger::WriteToFile(const LogEntry& entry) {
-    if (!m_logFile.is_open()) return;
+bool Logger::SetLogFile(const std::string& filePath, AsyncLog::Encoding encoding,
+                        const LogRotation::Policy& rotation) {
+    m_output.SetRotation(rotation);
+    return m_output.SetFile(filePath, encoding);
+}
 
-    std::string levelStr;
-    switch (entry.level) {
-    case LogLevel::INFO:    levelStr = "INFO"; break;
-    case LogLevel::WARNING: levelStr = "WARNING"; break;
-    case LogLevel::ERROR:   levelStr = "ERROR"; break;
+LogSeverity Logger::ToSeverity(LogLevel level) {
+    switch (level) {
+    case LogLevel::WARNING: return LogSeverity::Warning;
+    case LogLevel::ERROR:   return LogSeverity::Error;
+    default:                return LogSeverity::Info;
     }
-
-    auto time_t = std::chrono::system_clock::to_time_t(entry.timestamp);
-    struct tm timeinfo;
-    localtime_s(&timeinfo, &time_t);
-
-    std::stringstream ss;
-    ss << std::put_time(&timeinfo, "%Y-%m-%d %H:%M:%S");
-
-    m_logFile << "[" << ss.str() << "] [" << levelStr << "] " << entry.message << std::endl;
 }
@@ -9,6 +9,11 @@
 #include <iomanip>
 #include <mutex>
 
+#include "Headers/AsyncLog.h"
+#include "Headers/BinaryLog.h"
+#include "Headers/LogMacros.h"
+#include "Headers/LogSinks.h"
+
 // NOTE: Removed dependency on external 'fmt' library.
 enum class LogLevel {
     INFO,
@@ -22,15 +27,58 @@ struct LogEntry {
     std::chrono::system_clock::time_point timestamp;
 };
 
+// Uygulamanın tek log hattı: tüm kayıtlar (ErrorHandler'ınkiler dahil) aynı
+// kuyruğa girer; tek yazıcı thread dosya, geçmiş, hata ayıklayıcı ve sayaç
+// sink'lerini besler. Her sink'in kendi seviye süzgeci vardır.
 class Logger {
 public:
     static Logger& GetInstance();
 
     void Log(const std::string& message, LogLevel level = LogLevel::INFO);
     void Log(const std::wstring& message, LogLevel level = LogLevel::INFO);
+    void Log(LogSeverity severity, std::string_view message) { m_output.Push(severity, message); }
+
+    // Sıcak yollar için: çağıranın thread'inde biçimlendirme ve std::string yok
+    //     static const BinaryLog::Format format("Video işleme hatası: {}");
+    //     Logger::GetInstance().Write(LogLevel::ERROR, format, e.what());
+    template <typename... Args>
+    void Write(LogLevel level, const BinaryLog::Format& format, const Args&... args) {
+        Write(ToSeverity(level), format, args...);
+    }
+
+    // LMW_LOG_* makroları bunu kullanır (LogMacros.h)
+    template <typename... Args>
+    void Write(LogSeverity severity, const BinaryLog::Format& format, const Args&... args) {
+        BinaryLog::Encoder encoder;
+        encoder.PutAll(args...);
+        WriteEncoded(severity, format, encoder);
+    }
+    void WriteEncoded(LogSeverity severity, const BinaryLog::Format& format, const BinaryLog::Encoder& encoder) {
+        BinaryLog::WriteEncoded(m_output, severity, format, encoder);
+    }
+
+    // Kuyruğa giriş süzgeci; sink süzgeçleri bunun üstünde ayrıca uygulanır
+    bool IsEnabled(LogSeverity severity) const { return m_output.IsEnabled(severity); }
+    void SetMinimumSeverity(LogSeverity severity) { m_output.SetMinimumSeverity(severity); }
+
+    // Son kayıtların anlık görüntüsü (seviye başına sınırlı); yazanları bekletmez.
+    // Geçmiş yazıcı thread'inde dolar: en yeni kayıtlar bir yazım döngüsü gecikebilir
+    std::vector<LogEntry> GetHistory() const;
+    void ClearHistory() { m_history->GetHistory().Clear(); }
+    // Kuyruktaki her şey tüm sink'lere ulaşana kadar bekler
+    void Flush() { m_output.Flush(); }
+    // LMW_LOG_LIMITED özetlerinin yazıldığı kuyruk
+    AsyncLog& GetOutput() { return m_output; }
 
-    const std::vector<LogEntry>& GetHistory() const;
-    void SetLogFile(const std::string& filePath);
+    LogSink& GetFileSink() { return m_output.GetFileSink(); }
+    LogHistorySink& GetHistorySink() { return *m_history; }
+    LogDebuggerSink& GetDebuggerSink() { return *m_debugger; }
+    const LogMetricsSink& GetMetrics() const { return *m_metrics; }
+    void AddSink(std::shared_ptr<LogSink> sink) { m_output.AddSink(std::move(sink)); }
+    // Binary: dosya LMWallpaperLogDecode ile okunur (daha küçük, yazıcıda biçimlendirme yok).
+    // Varsayılan politika: 8 MB / 24 saatte döndür, 5 sıkıştırılmış arşiv tut
+    bool SetLogFile(const std::string& filePath, AsyncLog::Encoding encoding = AsyncLog::Encoding::Text,
+                    const LogRotation::Policy& rotation = LogRotation::Policy());
 
 private:
     Logger();
@@ -38,9 +86,29 @@ private:
     Logger(const Logger&) = delete;
     Logger& operator=(const Logger&) = delete;
 
-    void WriteToFile(const LogEntry& entry);
+    static LogSeverity ToSeverity(LogLevel level);
 
-    std::vector<LogEntry> m_history;
-    std::ofstream m_logFile;
-    std::mutex m_mutex;
+    std::shared_ptr<LogHistorySink> m_history;
+    std::shared_ptr<LogDebuggerSink> m_debugger;
+    std::shared_ptr<LogMetricsSink> m_metrics;
+    // Biçimlendirme ve G/Ç arka plandaki yazıcı thread'inde (çağıranın thread'inde kilit ve G/Ç yok)
+    AsyncLog m_output;
 };
+
+inline bool LogEnabled(const Logger& logger, LogSeverity severity) {
+    return logger.IsEnabled(severity);
+}
+
+template <typename... Args>
+inline void LogWrite(Logger& logger, LogSeverity severity, const BinaryLog::Format& format, const Args&... args) {
+    logger.Write(severity, format, args...);
+}
+
+inline void LogWriteEncoded(Logger& logger, LogSeverity severity, const BinaryLog::Format& format,
+                            const BinaryLog::Encoder& encoder) {
+    logger.WriteEncoded(severity, format, encoder);
+}
+
+inline AsyncLog& LogOutput(Logger& logger) {
+    return logger.GetOutput();
+}
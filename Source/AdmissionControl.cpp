@@ -0,0 +1,161 @@
+// Source/AdmissionControl.cpp
+#include "../Headers/AdmissionControl.h"
+#include "../Headers/BufferDepthController.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+constexpr size_t BYTES_PER_QUEUED_PIXEL = 4;   // BGRA
+constexpr int MACROBLOCK_SIZE = 16;
+
+// H.264 Tablo A-1: MaxDpbMbs (seviye 5.1 ve 6.2)
+constexpr int64_t H264_MAX_DPB_MBS = 184320;
+constexpr int64_t H264_MAX_DPB_MBS_8K = 696320;
+// HEVC Tablo A.8: MaxLumaPs (seviye 5.x ve 6.x), maxDpbPicBuf = 6
+constexpr int64_t HEVC_MAX_LUMA_PS = 8912896;
+constexpr int64_t HEVC_MAX_LUMA_PS_8K = 35651584;
+constexpr int HEVC_MAX_DPB_PIC_BUF = 6;
+
+constexpr int64_t PIXELS_4K = static_cast<int64_t>(4096) * 2304;
+
+int ScaledDimension(int value, int scale) {
+    // Çözücüler çift boyut ister
+    return std::max(2, (value / scale) & ~1);
+}
+
+double Megabytes(size_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+std::string Describe(const AdmissionControl::Request& request, const AdmissionControl::Plan& plan) {
+    char text[256];
+    std::snprintf(text, sizeof(text), "%dx%d %d-bit %s, %d monitör: %.1f MB tahmin, %.1f MB kullanılabilir",
+                  request.probe.width, request.probe.height, request.probe.bitDepth,
+                  request.probe.codec.empty() ? "?" : request.probe.codec.c_str(), request.monitorCount,
+                  Megabytes(plan.estimatedBytes), Megabytes(request.availableBytes));
+    return text;
+}
+
+}  // namespace
+
+size_t AdmissionControl::DecodedFrameBytes(int width, int height, int bitDepth) {
+    const size_t pixels = static_cast<size_t>(std::max(width, 0)) * static_cast<size_t>(std::max(height, 0));
+    // 4:2:0: luma + yarım çözünürlükte iki kroma düzlemi; 8 bit üstü 16 bit örnek
+    const size_t bytesPerSample = bitDepth > 8 ? 2 : 1;
+    return pixels * 3 / 2 * bytesPerSample;
+}
+
+int AdmissionControl::ReferenceFrames(const std::string& codec, int width, int height) {
+    const int64_t pixels = static_cast<int64_t>(width) * height;
+    if (pixels <= 0) return 1;
+
+    if (codec == "H.264") {
+        const int64_t macroblocks = static_cast<int64_t>((width + MACROBLOCK_SIZE - 1) / MACROBLOCK_SIZE) *
+                                    ((height + MACROBLOCK_SIZE - 1) / MACROBLOCK_SIZE);
+        const int64_t maxDpbMbs = pixels > PIXELS_4K ? H264_MAX_DPB_MBS_8K : H264_MAX_DPB_MBS;
+        return static_cast<int>(std::clamp<int64_t>(maxDpbMbs / macroblocks, 1, 16));
+    }
+    if (codec == "HEVC") {
+        const int64_t maxLumaPs = pixels > HEVC_MAX_LUMA_PS ? HEVC_MAX_LUMA_PS_8K : HEVC_MAX_LUMA_PS;
+        if (pixels <= maxLumaPs / 4) return std::min(HEVC_MAX_DPB_PIC_BUF * 4, 16);
+        if (pixels <= maxLumaPs / 2) return HEVC_MAX_DPB_PIC_BUF * 2;
+        if (pixels <= maxLumaPs * 3 / 4) return HEVC_MAX_DPB_PIC_BUF * 4 / 3;
+        return HEVC_MAX_DPB_PIC_BUF;
+    }
+    // VP9 ve AV1: 8 referans slotu
+    if (codec == "VP9" || codec == "AV1") return 8;
+    // Intra / bilinmeyen codec'ler: çözülen + gösterilen
+    return 2;
+}
+
+AdmissionControl::Footprint AdmissionControl::Estimate(const Request& request, int decodeScale, int bufferDepth,
+                                                       bool sharedDecode) {
+    const ContainerProbe::Result& probe = request.probe;
+    const int instances = sharedDecode ? 1 : std::max(request.monitorCount, 1);
+
+    // Çözücü referans yüzeylerini her zaman tam çözünürlükte tutar
+    const int surfaces = ReferenceFrames(probe.codec, probe.width, probe.height) + DECODER_EXTRA_SURFACES;
+    const size_t decoderBytes = DecodedFrameBytes(probe.width, probe.height, std::max(probe.bitDepth, 8)) * surfaces;
+
+    // Kuyruk ölçeklenmiş çözünürlükte tutar; ekrandan büyük tutmanın anlamı yok
+    int queueWidth = ScaledDimension(probe.width, decodeScale);
+    int queueHeight = ScaledDimension(probe.height, decodeScale);
+    if (request.outputWidth > 0 && request.outputHeight > 0 &&
+        static_cast<int64_t>(queueWidth) * queueHeight > static_cast<int64_t>(request.outputWidth) * request.outputHeight) {
+        queueWidth = request.outputWidth;
+        queueHeight = request.outputHeight;
+    }
+    const size_t queueBytes = static_cast<size_t>(queueWidth) * queueHeight * BYTES_PER_QUEUED_PIXEL * bufferDepth;
+
+    Footprint footprint;
+    footprint.decoderBytes = decoderBytes * instances;
+    // Paylaşımlı çözmede kareler tek kuyrukta tutulup monitörlere dağıtılır
+    footprint.queueBytes = queueBytes * instances;
+    footprint.totalBytes = footprint.decoderBytes + footprint.queueBytes;
+    return footprint;
+}
+
+AdmissionControl::Plan AdmissionControl::Decide(const Request& request) {
+    Plan plan;
+    const ContainerProbe::Result& probe = request.probe;
+    if (probe.width <= 0 || probe.height <= 0) {
+        plan.reason = "Video çözünürlüğü okunamadı";
+        return plan;
+    }
+
+    const int desiredDepth = std::clamp(request.desiredDepth > 0 ? request.desiredDepth : BufferDepthController::MIN_DEPTH,
+                                        BufferDepthController::MIN_DEPTH, BufferDepthController::MAX_DEPTH);
+    const bool canShare = request.allowSharedDecode && request.monitorCount > 1;
+
+    auto fits = [&](int scale, int depth, bool shared) {
+        const Footprint footprint = Estimate(request, scale, depth, shared);
+        plan.decodeScale = scale;
+        plan.bufferDepth = depth;
+        plan.sharedDecode = shared;
+        plan.estimatedBytes = footprint.totalBytes;
+        return footprint.totalBytes <= request.availableBytes;
+    };
+
+    // Bozulma sırası: önce görüntüyü etkilemeyenler (paylaşım, kuyruk), en son çözünürlük
+    std::string change;
+    bool accepted = fits(1, desiredDepth, false);
+    if (accepted) {
+        plan.outcome = Outcome::Accept;
+    } else {
+        if (canShare && fits(1, desiredDepth, true)) {
+            change = "paylaşımlı çözme";
+            accepted = true;
+        }
+        for (int depth = desiredDepth - 1; !accepted && depth >= BufferDepthController::MIN_DEPTH; --depth) {
+            if (fits(1, depth, canShare)) {
+                change = "kuyruk derinliği " + std::to_string(desiredDepth) + " -> " + std::to_string(depth);
+                accepted = true;
+            }
+        }
+        for (int scale = 2; !accepted && scale <= MAX_DECODE_SCALE; scale *= 2) {
+            if (fits(scale, BufferDepthController::MIN_DEPTH, canShare)) {
+                change = "1/" + std::to_string(scale) + " çözünürlükte çözme";
+                accepted = true;
+            }
+        }
+        plan.outcome = accepted ? Outcome::Degrade : Outcome::Reject;
+    }
+
+    plan.decodeWidth = ScaledDimension(probe.width, plan.decodeScale);
+    plan.decodeHeight = ScaledDimension(probe.height, plan.decodeScale);
+    plan.reason = Describe(request, plan);
+    if (plan.outcome == Outcome::Degrade) plan.reason += " (" + change + ")";
+    if (plan.outcome == Outcome::Reject) plan.reason += " (en düşük yapılandırma da sığmıyor)";
+    return plan;
+}
+
+const char* AdmissionControl::GetOutcomeName(Outcome outcome) {
+    switch (outcome) {
+        case Outcome::Accept:  return "Accept";
+        case Outcome::Degrade: return "Degrade";
+        case Outcome::Reject:  return "Reject";
+        default:               return "Unknown";
+    }
+}
@@ -0,0 +1,94 @@
+// Source/AllocationCounter.cpp
+#include "../Headers/AllocationCounter.h"
+#include "../Headers/AllocationHooks.h"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+
+namespace {
+
+thread_local AllocationCounter* t_innermost = nullptr;
+thread_local bool t_inHook = false;   // Stack yakalama / sembol çözme ayırmaları sayılmaz
+
+std::mutex g_activeMutex;
+int g_activeCounters = 0;   // Kanca sadece en az bir sayaç varken açık
+
+class HookGuard {
+public:
+    HookGuard() : previous(t_inHook) { t_inHook = true; }
+    ~HookGuard() { t_inHook = previous; }
+private:
+    bool previous;
+};
+
+}  // namespace
+
+struct AllocationCounterHook {
+    static void OnAllocation(void*, size_t size) {
+        AllocationCounter* counter = t_innermost;
+        if (!counter || t_inHook) return;
+        HookGuard guard;
+
+        // Stack bir kez alınır, ilk ayırmasını henüz görmemiş bütün sayaçlara kopyalanır
+        void* frames[AllocationCounter::MAX_STACK_DEPTH];
+        int depth = -1;
+        for (; counter; counter = counter->parent) {
+            if (counter->count == 0) {
+                if (depth < 0) depth = AllocationHooks::CaptureCallerStack(frames, AllocationCounter::MAX_STACK_DEPTH);
+                std::copy(frames, frames + depth, counter->firstFrames);
+                counter->firstDepth = depth;
+                counter->firstSize = size;
+            }
+            ++counter->count;
+            counter->bytes += size;
+        }
+    }
+};
+
+AllocationCounter::AllocationCounter()
+    : parent(nullptr), count(0), bytes(0), firstSize(0), firstFrames(), firstDepth(0) {
+    {
+        std::lock_guard<std::mutex> lock(g_activeMutex);
+        if (g_activeCounters++ == 0) {
+            AllocationHooks::Enable(AllocationHooks::Hook::AllocationCounter, AllocationCounterHook::OnAllocation, nullptr);
+        }
+    }
+    // Kanca açıldıktan sonra bağlanır: açılıştaki kalibrasyon ayırmaları sayılmaz
+    parent = t_innermost;
+    t_innermost = this;
+}
+
+AllocationCounter::~AllocationCounter() {
+    t_innermost = parent;
+    std::lock_guard<std::mutex> lock(g_activeMutex);
+    if (--g_activeCounters == 0) {
+        AllocationHooks::Disable(AllocationHooks::Hook::AllocationCounter);
+    }
+}
+
+std::vector<std::string> AllocationCounter::GetFirstAllocationSite() const {
+    HookGuard guard;
+    std::vector<std::string> site;
+    site.reserve(static_cast<size_t>(firstDepth));
+    for (int i = 0; i < firstDepth; ++i) site.push_back(AllocationHooks::DescribeFrame(firstFrames[i]));
+    return site;
+}
+
+std::string AllocationCounter::Describe() const {
+    HookGuard guard;
+    std::ostringstream out;
+    out << count << " ayırma (" << bytes << " bayt)";
+    if (count > 0) {
+        out << ", ilki " << firstSize << " bayt:";
+        for (const auto& frame : GetFirstAllocationSite()) out << "\n  " << frame;
+    }
+    return out.str();
+}
+
+void AllocationCounter::Reset() {
+    count = 0;
+    bytes = 0;
+    firstSize = 0;
+    firstDepth = 0;
+}
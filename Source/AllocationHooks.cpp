@@ -0,0 +1,395 @@
+// Source/AllocationHooks.cpp
+#include "../Headers/AllocationHooks.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <malloc.h>
+#else
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+#if defined(_MSC_VER)
+#define ALLOCATION_HOOKS_NOINLINE __declspec(noinline)
+#else
+#define ALLOCATION_HOOKS_NOINLINE __attribute__((noinline))
+#endif
+
+namespace {
+
+constexpr size_t HOOK_COUNT = static_cast<size_t>(AllocationHooks::Hook::Count);
+constexpr uint32_t CALIBRATION_FLAG = 1u << 31;
+constexpr int CALIBRATION_DEPTH = 256;
+constexpr int MAX_HOOK_FRAMES = 32;
+// Kanca callback'lerinin kendi çerçeveleri de bu derinlik içinde kalmalı
+constexpr int HOOK_SCAN_DEPTH = 12;
+
+// operator new'den statik başlatma bitmeden de çağrılabilir: hepsi sabit başlatılır
+std::atomic<uint32_t> g_enabled{ 0 };
+std::atomic<AllocationHooks::AllocationCallback> g_onAllocation[HOOK_COUNT];
+std::atomic<AllocationHooks::FreeCallback> g_onFree[HOOK_COUNT];
+std::mutex g_controlMutex;
+
+// Kalibrasyon g_controlMutex altında tek thread'de yapılır
+thread_local bool t_calibrating = false;
+void* g_calibration[CALIBRATION_DEPTH];
+int g_calibrationDepth = 0;
+void* g_hookFrames[MAX_HOOK_FRAMES];
+std::atomic<int> g_hookFrameCount{ 0 };
+bool g_calibrated = false;
+
+#ifdef _WIN32
+int CaptureFrames(void** frames, int count) {
+    return CaptureStackBackTrace(0, static_cast<DWORD>(count), frames, nullptr);
+}
+#else
+int CaptureFrames(void** frames, int count) {
+    return backtrace(frames, count);
+}
+#endif
+
+bool IsHookFrame(void* frame, int hookFrameCount) {
+    for (int i = 0; i < hookFrameCount; ++i) {
+        if (g_hookFrames[i] == frame) return true;
+    }
+    return false;
+}
+
+ALLOCATION_HOOKS_NOINLINE void DispatchAllocation(void* pointer, size_t size) {
+    const uint32_t enabled = g_enabled.load(std::memory_order_acquire);
+    if (t_calibrating) {
+        g_calibrationDepth = CaptureFrames(g_calibration, CALIBRATION_DEPTH);
+        return;
+    }
+    for (size_t i = 0; i < HOOK_COUNT; ++i) {
+        if (!(enabled & (1u << i))) continue;
+        if (auto callback = g_onAllocation[i].load(std::memory_order_relaxed)) callback(pointer, size);
+    }
+}
+
+ALLOCATION_HOOKS_NOINLINE void DispatchFree(void* pointer) {
+    const uint32_t enabled = g_enabled.load(std::memory_order_acquire);
+    for (size_t i = 0; i < HOOK_COUNT; ++i) {
+        if (!(enabled & (1u << i))) continue;
+        if (auto callback = g_onFree[i].load(std::memory_order_relaxed)) callback(pointer);
+    }
+}
+
+inline void* AfterAllocation(void* pointer, size_t size) {
+    if (g_enabled.load(std::memory_order_relaxed) && pointer) DispatchAllocation(pointer, size);
+    return pointer;
+}
+
+inline void BeforeFree(void* pointer) {
+    if (g_enabled.load(std::memory_order_relaxed) && pointer) DispatchFree(pointer);
+}
+
+void* AllocateOrNull(size_t size) {
+    return std::malloc(size ? size : 1);
+}
+
+void* AllocateAlignedOrNull(size_t size, size_t alignment) {
+    if (size == 0) size = 1;
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    void* pointer = nullptr;
+    if (alignment < sizeof(void*)) alignment = sizeof(void*);
+    return posix_memalign(&pointer, alignment, size) == 0 ? pointer : nullptr;
+#endif
+}
+
+void FreeAligned(void* pointer) {
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+template <typename Allocate>
+void* AllocateOrThrow(Allocate allocate) {
+    for (;;) {
+        if (void* pointer = allocate()) return pointer;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+// Her new çeşidini bir kez ayırıp yalnızca kancaya ait çerçeveleri bulur:
+// aynı çağrı zincirinde kalibrasyon stack'i ile ayırma stack'i arasındaki fark
+// tam olarak kanca çerçeveleridir (derleyicinin inline / tail call kararlarından bağımsız)
+ALLOCATION_HOOKS_NOINLINE void CalibrateVariant(int variant, int& hookFrameCount) {
+    void* reference[CALIBRATION_DEPTH];
+    const int referenceDepth = CaptureFrames(reference, CALIBRATION_DEPTH);
+
+    t_calibrating = true;
+    g_calibrationDepth = 0;
+    void* pointer = nullptr;
+    // Volatile işaretçiler: bu dosyada tanımlı operator new'ler aksi halde buraya
+    // inline edilir ve kalibrasyon uygulama kodunun görmediği adresleri bulur
+    using PlainNew = void* (*)(size_t);
+    using NothrowNew = void* (*)(size_t, const std::nothrow_t&) noexcept;
+    using AlignedNew = void* (*)(size_t, std::align_val_t);
+    using AlignedNothrowNew = void* (*)(size_t, std::align_val_t, const std::nothrow_t&) noexcept;
+    const std::align_val_t alignment = static_cast<std::align_val_t>(64);
+    switch (variant) {
+        case 0: { PlainNew volatile call = &::operator new; pointer = call(16); ::operator delete(pointer); break; }
+        case 1: { PlainNew volatile call = &::operator new[]; pointer = call(16); ::operator delete[](pointer); break; }
+        case 2: {
+            NothrowNew volatile call = &::operator new;
+            pointer = call(16, std::nothrow);
+            ::operator delete(pointer);
+            break;
+        }
+        case 3: {
+            NothrowNew volatile call = &::operator new[];
+            pointer = call(16, std::nothrow);
+            ::operator delete[](pointer);
+            break;
+        }
+        case 4: {
+            AlignedNew volatile call = &::operator new;
+            pointer = call(16, alignment);
+            ::operator delete(pointer, alignment);
+            break;
+        }
+        case 5: {
+            AlignedNew volatile call = &::operator new[];
+            pointer = call(16, alignment);
+            ::operator delete[](pointer, alignment);
+            break;
+        }
+        case 6: {
+            AlignedNothrowNew volatile call = &::operator new;
+            pointer = call(16, alignment, std::nothrow);
+            ::operator delete(pointer, alignment);
+            break;
+        }
+        default: {
+            AlignedNothrowNew volatile call = &::operator new[];
+            pointer = call(16, alignment, std::nothrow);
+            ::operator delete[](pointer, alignment);
+            break;
+        }
+    }
+    const int sampleDepth = g_calibrationDepth;
+    t_calibrating = false;
+
+    // reference: [CalibrateVariant, çağıranlar...]
+    // sample:    [kanca çerçeveleri..., CalibrateVariant, çağıranlar...]
+    // Çağıranlar iki stack'te aynıdır; CalibrateVariant'ın dönüş adresi farklıdır
+    if (sampleDepth <= 1 || sampleDepth >= CALIBRATION_DEPTH || referenceDepth >= CALIBRATION_DEPTH) return;
+    int common = 0;
+    while (common < referenceDepth && common < sampleDepth &&
+           reference[referenceDepth - 1 - common] == g_calibration[sampleDepth - 1 - common]) {
+        ++common;
+    }
+    const int hookFrames = sampleDepth - common - 1;
+    for (int i = 0; i < hookFrames; ++i) {
+        void* frame = g_calibration[i];
+        if (!IsHookFrame(frame, hookFrameCount) && hookFrameCount < MAX_HOOK_FRAMES) {
+            g_hookFrames[hookFrameCount++] = frame;
+        }
+    }
+}
+
+void CalibrateLocked() {
+    if (g_calibrated) return;
+    g_calibrated = true;
+
+#ifndef _WIN32
+    // backtrace ilk çağrıda libgcc'yi yükler (ve malloc yapar): kanca içinde olmasın
+    void* warmup[4];
+    backtrace(warmup, 4);
+#endif
+
+    // Kalibrasyon bayrağı operator new'i dağıtıma sokar; diğer thread'ler için
+    // kayıtlı callback olmadığından etkisi yoktur
+    g_enabled.fetch_or(CALIBRATION_FLAG, std::memory_order_acq_rel);
+    int hookFrameCount = 0;
+    for (int variant = 0; variant < 8; ++variant) CalibrateVariant(variant, hookFrameCount);
+    g_enabled.fetch_and(~CALIBRATION_FLAG, std::memory_order_acq_rel);
+    g_hookFrameCount.store(hookFrameCount, std::memory_order_release);
+}
+
+}  // namespace
+
+void AllocationHooks::Enable(Hook hook, AllocationCallback onAllocation, FreeCallback onFree) {
+    std::lock_guard<std::mutex> lock(g_controlMutex);
+    CalibrateLocked();
+
+    const size_t index = static_cast<size_t>(hook);
+    g_onAllocation[index].store(onAllocation, std::memory_order_relaxed);
+    g_onFree[index].store(onFree, std::memory_order_relaxed);
+    g_enabled.fetch_or(1u << index, std::memory_order_release);
+}
+
+void AllocationHooks::Disable(Hook hook) {
+    std::lock_guard<std::mutex> lock(g_controlMutex);
+    g_enabled.fetch_and(~(1u << static_cast<size_t>(hook)), std::memory_order_release);
+}
+
+bool AllocationHooks::IsEnabled(Hook hook) {
+    return (g_enabled.load(std::memory_order_relaxed) & (1u << static_cast<size_t>(hook))) != 0;
+}
+
+int AllocationHooks::CaptureCallerStack(void** frames, int maxFrames) {
+    void* captured[CALIBRATION_DEPTH];
+    const int count = CaptureFrames(captured, std::min(maxFrames + HOOK_SCAN_DEPTH, CALIBRATION_DEPTH));
+
+    // Derleyici çağrı yerlerini kopyalayabildiği için en alttaki çerçeveler
+    // eşleşmeyebilir: bilinen son kanca çerçevesinin (operator new) arkasından başla
+    const int hookFrameCount = g_hookFrameCount.load(std::memory_order_acquire);
+    int first = 0;
+    for (int i = 0; i < count && i < HOOK_SCAN_DEPTH; ++i) {
+        if (IsHookFrame(captured[i], hookFrameCount)) first = i + 1;
+    }
+    const int depth = std::min(count - first, maxFrames);
+    if (depth <= 0) return 0;
+    std::copy(captured + first, captured + first + depth, frames);
+    return depth;
+}
+
+std::string AllocationHooks::DescribeFrame(void* frame) {
+    const uintptr_t address = reinterpret_cast<uintptr_t>(frame);
+    std::ostringstream out;
+#ifdef _WIN32
+    HMODULE module = nullptr;
+    char path[MAX_PATH] = {};
+    if (GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                           static_cast<LPCSTR>(frame), &module) &&
+        GetModuleFileNameA(module, path, MAX_PATH)) {
+        const char* name = std::strrchr(path, '\\');
+        out << (name ? name + 1 : path) << "+0x" << std::hex << (address - reinterpret_cast<uintptr_t>(module));
+        return out.str();
+    }
+#else
+    // Dönüş adresi çağrı komutunun arkasını gösterir: çağıran fonksiyonda kalmak için 1 geri
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void*>(address - 1), &info)) {
+        if (info.dli_sname) {
+            int status = 0;
+            char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+            std::string name = status == 0 && demangled ? demangled : info.dli_sname;
+            std::free(demangled);
+            std::replace(name.begin(), name.end(), ';', ':');
+            return name;
+        }
+        if (info.dli_fname) {
+            const char* name = std::strrchr(info.dli_fname, '/');
+            out << (name ? name + 1 : info.dli_fname) << "+0x" << std::hex
+                << (address - reinterpret_cast<uintptr_t>(info.dli_fbase));
+            return out.str();
+        }
+    }
+#endif
+    out << "0x" << std::hex << address;
+    return out.str();
+}
+
+// Global operator new / delete
+
+void* operator new(size_t size) {
+    return AfterAllocation(AllocateOrThrow([size] { return AllocateOrNull(size); }), size);
+}
+
+void* operator new[](size_t size) {
+    return AfterAllocation(AllocateOrThrow([size] { return AllocateOrNull(size); }), size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return AfterAllocation(AllocateOrNull(size), size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return AfterAllocation(AllocateOrNull(size), size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return AfterAllocation(
+        AllocateOrThrow([=] { return AllocateAlignedOrNull(size, static_cast<size_t>(alignment)); }), size);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return AfterAllocation(
+        AllocateOrThrow([=] { return AllocateAlignedOrNull(size, static_cast<size_t>(alignment)); }), size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return AfterAllocation(AllocateAlignedOrNull(size, static_cast<size_t>(alignment)), size);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return AfterAllocation(AllocateAlignedOrNull(size, static_cast<size_t>(alignment)), size);
+}
+
+void operator delete(void* pointer) noexcept {
+    BeforeFree(pointer);
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    BeforeFree(pointer);
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    BeforeFree(pointer);
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    BeforeFree(pointer);
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    BeforeFree(pointer);
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    BeforeFree(pointer);
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    BeforeFree(pointer);
+    FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    BeforeFree(pointer);
+    FreeAligned(pointer);
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept {
+    BeforeFree(pointer);
+    FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept {
+    BeforeFree(pointer);
+    FreeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    BeforeFree(pointer);
+    FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    BeforeFree(pointer);
+    FreeAligned(pointer);
+}
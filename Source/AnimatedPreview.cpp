@@ -0,0 +1,440 @@
+// Source/AnimatedPreview.cpp
+#include "../Headers/AnimatedPreview.h"
+#include "../Headers/FrameArena.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+
+static constexpr size_t HEADER_SIZE = 16;
+static constexpr uint8_t FRAME_KEY = 0x01;
+static constexpr uint8_t TILE_RAW = 0;
+static constexpr uint8_t TILE_RLE = 1;
+
+template <typename T>
+static void PutLE(std::vector<uint8_t>& buffer, T value) {
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+template <typename T>
+static T GetLE(const uint8_t* bytes) {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<T>(static_cast<T>(bytes[i]) << (8 * i));
+    }
+    return value;
+}
+
+static inline uint16_t ToRgb565(const uint8_t* bgra) {
+    return static_cast<uint16_t>(((bgra[2] >> 3) << 11) | ((bgra[1] >> 2) << 5) | (bgra[0] >> 3));
+}
+
+static inline void FromRgb565(uint16_t value, uint8_t* bgra) {
+    const uint8_t r = static_cast<uint8_t>((value >> 11) & 0x1F);
+    const uint8_t g = static_cast<uint8_t>((value >> 5) & 0x3F);
+    const uint8_t b = static_cast<uint8_t>(value & 0x1F);
+    bgra[0] = static_cast<uint8_t>((b << 3) | (b >> 2));
+    bgra[1] = static_cast<uint8_t>((g << 2) | (g >> 4));
+    bgra[2] = static_cast<uint8_t>((r << 3) | (r >> 2));
+    bgra[3] = 255;
+}
+
+// İki 565 piksel arasındaki kanal farkları toplamı (yeşil 5 bite indirgenir)
+static inline int Rgb565Difference(uint16_t a, uint16_t b) {
+    return std::abs(((a >> 11) & 0x1F) - ((b >> 11) & 0x1F)) +
+           std::abs(((a >> 6) & 0x1F) - ((b >> 6) & 0x1F)) +
+           std::abs((a & 0x1F) - (b & 0x1F));
+}
+
+// ---------------------------------------------------------------------------
+// Encoder
+// ---------------------------------------------------------------------------
+
+AnimatedPreview::Encoder::Encoder(int width, int height, int frameIntervalMs, int changeThreshold)
+    : width(width)
+    , height(height)
+    , frameIntervalMs(frameIntervalMs)
+    , changeThreshold(changeThreshold)
+    , tilesX((width + TILE_SIZE - 1) / TILE_SIZE)
+    , tilesY((height + TILE_SIZE - 1) / TILE_SIZE)
+    , frameCount(0)
+    , reference(static_cast<size_t>(width) * height, 0) {
+    output.resize(HEADER_SIZE);
+}
+
+void AnimatedPreview::Encoder::AddFrame(const uint8_t* bgra, int stride) {
+    // Dönüştürülmüş kare ve karo bitmap'i sadece bu kare boyunca yaşar
+    FrameArena::Scope scope;
+    FrameArena& arena = FrameArena::ForCurrentThread();
+    std::pmr::vector<uint16_t> frame(static_cast<size_t>(width) * height, &arena);
+    for (int y = 0; y < height; ++y) {
+        const uint8_t* row = bgra + static_cast<ptrdiff_t>(y) * stride;
+        for (int x = 0; x < width; ++x) {
+            frame[static_cast<size_t>(y) * width + x] = ToRgb565(row + x * 4);
+        }
+    }
+
+    // Hangi karolar referanstan eşikten fazla farklı?
+    const int tileCount = tilesX * tilesY;
+    std::pmr::vector<uint8_t> changed(tileCount, 1, &arena);
+    int changedCount = tileCount;
+    if (frameCount > 0) {
+        changedCount = 0;
+        for (int ty = 0; ty < tilesY; ++ty) {
+            for (int tx = 0; tx < tilesX; ++tx) {
+                const int x0 = tx * TILE_SIZE, x1 = std::min(width, x0 + TILE_SIZE);
+                const int y0 = ty * TILE_SIZE, y1 = std::min(height, y0 + TILE_SIZE);
+                int difference = 0;
+                for (int y = y0; y < y1; ++y) {
+                    for (int x = x0; x < x1; ++x) {
+                        const size_t i = static_cast<size_t>(y) * width + x;
+                        difference += Rgb565Difference(frame[i], reference[i]);
+                    }
+                }
+                const bool tileChanged = difference > changeThreshold * (x1 - x0) * (y1 - y0);
+                changed[ty * tilesX + tx] = tileChanged ? 1 : 0;
+                changedCount += tileChanged ? 1 : 0;
+            }
+        }
+    }
+
+    // Sahne kesmesi gibi büyük değişimlerde bitmap'i atlayıp anahtar kare yaz
+    const bool key = frameCount == 0 || changedCount * 10 > tileCount * 6;
+    frameBytes.clear();
+    frameBytes.push_back(key ? FRAME_KEY : 0);
+    if (!key) {
+        const size_t bitmapStart = frameBytes.size();
+        frameBytes.resize(bitmapStart + (tileCount + 7) / 8, 0);
+        for (int i = 0; i < tileCount; ++i) {
+            if (changed[i]) frameBytes[bitmapStart + i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+        }
+    }
+
+    for (int ty = 0; ty < tilesY; ++ty) {
+        for (int tx = 0; tx < tilesX; ++tx) {
+            if (key || changed[ty * tilesX + tx]) EncodeTile(tx, ty, frame.data());
+        }
+    }
+
+    PutLE(output, static_cast<uint32_t>(frameBytes.size()));
+    output.insert(output.end(), frameBytes.begin(), frameBytes.end());
+    ++frameCount;
+}
+
+void AnimatedPreview::Encoder::EncodeTile(int tileX, int tileY, const uint16_t* frame) {
+    const int x0 = tileX * TILE_SIZE, x1 = std::min(width, x0 + TILE_SIZE);
+    const int y0 = tileY * TILE_SIZE, y1 = std::min(height, y0 + TILE_SIZE);
+
+    uint16_t tile[TILE_SIZE * TILE_SIZE];
+    int count = 0;
+    for (int y = y0; y < y1; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            const size_t i = static_cast<size_t>(y) * width + x;
+            tile[count++] = frame[i];
+            reference[i] = frame[i];
+        }
+    }
+
+    // Düz renkli alanlar (gökyüzü, letterbox) için RLE daha küçükse onu kullan
+    int runs = 1;
+    for (int i = 1; i < count; ++i) {
+        if (tile[i] != tile[i - 1]) ++runs;
+    }
+
+    if (runs * 3 < count * 2) {
+        frameBytes.push_back(TILE_RLE);
+        int start = 0;
+        while (start < count) {
+            int end = start + 1;
+            while (end < count && end - start < 256 && tile[end] == tile[start]) ++end;
+            frameBytes.push_back(static_cast<uint8_t>(end - start - 1));
+            PutLE(frameBytes, tile[start]);
+            start = end;
+        }
+    } else {
+        frameBytes.push_back(TILE_RAW);
+        for (int i = 0; i < count; ++i) {
+            PutLE(frameBytes, tile[i]);
+        }
+    }
+}
+
+std::vector<uint8_t> AnimatedPreview::Encoder::Finish() {
+    std::vector<uint8_t> header;
+    header.reserve(HEADER_SIZE);
+    PutLE(header, FILE_MAGIC);
+    PutLE(header, FILE_VERSION);
+    PutLE(header, static_cast<uint16_t>(width));
+    PutLE(header, static_cast<uint16_t>(height));
+    PutLE(header, static_cast<uint16_t>(frameCount));
+    PutLE(header, static_cast<uint16_t>(frameIntervalMs));
+    header.push_back(static_cast<uint8_t>(TILE_SIZE));
+    header.push_back(0);
+    std::copy(header.begin(), header.end(), output.begin());
+    return std::move(output);
+}
+
+// ---------------------------------------------------------------------------
+// Player
+// ---------------------------------------------------------------------------
+
+AnimatedPreview::Player::Player()
+    : width(0), height(0), frameIntervalMs(0), frameCount(0), tilesX(0), tilesY(0),
+      currentFrame(-1), firstFrameOffset(0), position(0), memory(MemoryCategory::Thumbnails) {
+}
+
+bool AnimatedPreview::Player::Load(std::vector<uint8_t> bytes) {
+    data.clear();
+    if (bytes.size() < HEADER_SIZE || GetLE<uint32_t>(bytes.data()) != FILE_MAGIC ||
+        GetLE<uint16_t>(bytes.data() + 4) != FILE_VERSION || bytes[14] != TILE_SIZE) {
+        return false;
+    }
+
+    width = GetLE<uint16_t>(bytes.data() + 6);
+    height = GetLE<uint16_t>(bytes.data() + 8);
+    frameCount = GetLE<uint16_t>(bytes.data() + 10);
+    frameIntervalMs = GetLE<uint16_t>(bytes.data() + 12);
+    if (width == 0 || height == 0 || frameCount == 0) return false;
+
+    // Kare sınırlarını baştan doğrula; oynatma sırasında sadece karo içi kontrol kalır
+    size_t offset = HEADER_SIZE;
+    for (int i = 0; i < frameCount; ++i) {
+        if (offset + 4 > bytes.size()) return false;
+        const uint32_t size = GetLE<uint32_t>(bytes.data() + offset);
+        if (size == 0 || offset + 4 + size > bytes.size()) return false;
+        offset += 4 + size;
+    }
+    if ((bytes[HEADER_SIZE + 4] & FRAME_KEY) == 0) return false;
+
+    data = std::move(bytes);
+    tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    firstFrameOffset = HEADER_SIZE;
+    pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+    memory.Set(data.capacity() + pixels.capacity());
+    Reset();
+    return true;
+}
+
+bool AnimatedPreview::Player::Open(const std::filesystem::path& filePath) {
+    std::vector<uint8_t> bytes;
+    return ReadFile(filePath, bytes) && Load(std::move(bytes));
+}
+
+void AnimatedPreview::Player::Reset() {
+    currentFrame = -1;
+    position = firstFrameOffset;
+}
+
+void AnimatedPreview::Player::Unload() {
+    std::vector<uint8_t>().swap(data);
+    std::vector<uint8_t>().swap(pixels);
+    width = height = frameIntervalMs = frameCount = tilesX = tilesY = 0;
+    firstFrameOffset = 0;
+    memory.Set(0);
+    Reset();
+}
+
+bool AnimatedPreview::Player::DecodeTile(int tileX, int tileY, size_t& offset) {
+    const int x0 = tileX * TILE_SIZE, x1 = std::min(width, x0 + TILE_SIZE);
+    const int y0 = tileY * TILE_SIZE, y1 = std::min(height, y0 + TILE_SIZE);
+    const int tileWidth = x1 - x0;
+    const int count = tileWidth * (y1 - y0);
+
+    if (offset >= data.size()) return false;
+    const uint8_t mode = data[offset++];
+
+    int written = 0;
+    auto put = [&](uint16_t value, int repeat) {
+        for (int r = 0; r < repeat; ++r, ++written) {
+            const int x = x0 + written % tileWidth;
+            const int y = y0 + written / tileWidth;
+            FromRgb565(value, &pixels[(static_cast<size_t>(y) * width + x) * 4]);
+        }
+    };
+
+    if (mode == TILE_RAW) {
+        if (offset + static_cast<size_t>(count) * 2 > data.size()) return false;
+        for (int i = 0; i < count; ++i, offset += 2) {
+            put(GetLE<uint16_t>(&data[offset]), 1);
+        }
+        return true;
+    }
+
+    if (mode == TILE_RLE) {
+        while (written < count) {
+            if (offset + 3 > data.size()) return false;
+            const int run = data[offset] + 1;
+            if (written + run > count) return false;
+            put(GetLE<uint16_t>(&data[offset + 1]), run);
+            offset += 3;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool AnimatedPreview::Player::Advance(Rect& dirty) {
+    if (data.empty()) return false;
+
+    if (currentFrame + 1 >= frameCount) {
+        // Döngü: ilk kare her zaman anahtar karedir
+        Reset();
+    }
+
+    const uint32_t size = GetLE<uint32_t>(&data[position]);
+    const size_t frameEnd = position + 4 + size;
+    size_t offset = position + 4;
+    const bool key = (data[offset++] & FRAME_KEY) != 0;
+
+    const int tileCount = tilesX * tilesY;
+    const uint8_t* bitmap = nullptr;
+    if (!key) {
+        if (offset + (tileCount + 7) / 8 > frameEnd) {
+            Reset();
+            return false;
+        }
+        bitmap = &data[offset];
+        offset += (tileCount + 7) / 8;
+    }
+
+    dirty = { width, height, 0, 0 };
+    for (int i = 0; i < tileCount; ++i) {
+        if (bitmap && !(bitmap[i / 8] & (1u << (i % 8)))) continue;
+
+        const int tx = i % tilesX, ty = i / tilesX;
+        if (!DecodeTile(tx, ty, offset) || offset > frameEnd) {
+            Reset();
+            return false;
+        }
+        dirty.left = std::min(dirty.left, tx * TILE_SIZE);
+        dirty.top = std::min(dirty.top, ty * TILE_SIZE);
+        dirty.right = std::max(dirty.right, std::min(width, (tx + 1) * TILE_SIZE));
+        dirty.bottom = std::max(dirty.bottom, std::min(height, (ty + 1) * TILE_SIZE));
+    }
+    if (dirty.right <= dirty.left) {
+        dirty = { 0, 0, 0, 0 };
+    }
+
+    position = frameEnd;
+    ++currentFrame;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Üretim
+// ---------------------------------------------------------------------------
+
+void AnimatedPreview::ScaleFrame(const Frame& frame, int outWidth, int outHeight, std::vector<uint8_t>& output) {
+    output.resize(static_cast<size_t>(outWidth) * outHeight * 4);
+
+    // Sütun aralıkları her satırda aynı: bir kez hesaplanıp karelik alanda tutulur
+    FrameArena::Scope scope;
+    int* columns = FrameArena::ForCurrentThread().AllocateArray<int>(static_cast<size_t>(outWidth) * 2);
+    for (int ox = 0; ox < outWidth; ++ox) {
+        const int x0 = ox * frame.width / outWidth;
+        columns[ox * 2] = x0;
+        columns[ox * 2 + 1] = std::max(x0 + 1, (ox + 1) * frame.width / outWidth);
+    }
+
+    for (int oy = 0; oy < outHeight; ++oy) {
+        const int y0 = oy * frame.height / outHeight;
+        const int y1 = std::max(y0 + 1, (oy + 1) * frame.height / outHeight);
+        for (int ox = 0; ox < outWidth; ++ox) {
+            const int x0 = columns[ox * 2];
+            const int x1 = columns[ox * 2 + 1];
+
+            uint32_t sums[3] = { 0, 0, 0 };
+            for (int y = y0; y < y1; ++y) {
+                const uint8_t* pixel = frame.pixels + static_cast<ptrdiff_t>(y) * frame.stride + x0 * 4;
+                for (int x = x0; x < x1; ++x, pixel += 4) {
+                    sums[0] += pixel[0];
+                    sums[1] += pixel[1];
+                    sums[2] += pixel[2];
+                }
+            }
+
+            const uint32_t area = static_cast<uint32_t>((y1 - y0) * (x1 - x0));
+            uint8_t* out = &output[(static_cast<size_t>(oy) * outWidth + ox) * 4];
+            out[0] = static_cast<uint8_t>(sums[0] / area);
+            out[1] = static_cast<uint8_t>(sums[1] / area);
+            out[2] = static_cast<uint8_t>(sums[2] / area);
+            out[3] = 255;
+        }
+    }
+}
+
+bool AnimatedPreview::Generate(FrameSource& source, double duration, std::vector<uint8_t>& output,
+                               const Options& options) {
+    if (options.width <= 0 || options.fps <= 0 || options.durationMs <= 0) return false;
+
+    const int totalFrames = std::max(1, options.fps * options.durationMs / 1000);
+    const int runCount = std::clamp(options.runCount, 1, totalFrames);
+    const double frameStep = 1.0 / options.fps;
+
+    std::unique_ptr<Encoder> encoder;
+    std::vector<uint8_t> scaled;
+    int previewHeight = 0;
+    int collected = 0;
+
+    for (int run = 0; run < runCount && collected < totalFrames; ++run) {
+        // Dizileri videoya eşit aralıklarla yay; her biri bir anahtar kareden başlar
+        const double start = duration > 0.0 ? duration * (run + 1) / (runCount + 1) : 0.0;
+        if (!source.SeekTo(start) && run > 0) continue;
+
+        const int wanted = (run == runCount - 1) ? totalFrames - collected
+                                                 : std::min(totalFrames - collected, (totalFrames + runCount - 1) / runCount);
+        double nextTime = -1.0;
+        int taken = 0;
+        Frame frame;
+        while (taken < wanted && source.ReadFrame(frame)) {
+            if (!frame.pixels || frame.width <= 0 || frame.height <= 0) return false;
+            if (nextTime < 0.0) nextTime = frame.timestamp;
+            if (frame.timestamp + 1e-6 < nextTime) continue;   // Aradaki kareler sadece çözülür
+
+            if (!encoder) {
+                previewHeight = std::max(2, static_cast<int>(std::lround(
+                    static_cast<double>(options.width) * frame.height / frame.width)) & ~1);
+                encoder = std::make_unique<Encoder>(options.width, previewHeight, 1000 / options.fps,
+                                                    options.changeThreshold);
+            }
+            ScaleFrame(frame, options.width, previewHeight, scaled);
+            encoder->AddFrame(scaled.data(), options.width * 4);
+
+            ++taken;
+            nextTime += frameStep;
+        }
+        collected += taken;
+    }
+
+    if (!encoder || encoder->GetFrameCount() == 0) return false;
+    output = encoder->Finish();
+    return true;
+}
+
+bool AnimatedPreview::WriteFile(const std::filesystem::path& filePath, const std::vector<uint8_t>& data) {
+    std::filesystem::path tempPath = filePath;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file.good()) return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, filePath, ec);
+    return !ec;
+}
+
+bool AnimatedPreview::ReadFile(const std::filesystem::path& filePath, std::vector<uint8_t>& data) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) return false;
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !data.empty();
+}
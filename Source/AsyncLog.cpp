@@ -0,0 +1,219 @@
+// Source/AsyncLog.cpp
+#include "../Headers/AsyncLog.h"
+#include "../Headers/BinaryLog.h"
+#include "../Headers/LogRateLimiter.h"
+#include "../Headers/LogText.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+    size_t result = 2;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+AsyncLog::AsyncLog(size_t requestedCapacity, LogSeverity flushSeverity)
+    : capacity(RoundUpToPowerOfTwo(std::max<size_t>(requestedCapacity, 8))),
+      mask(capacity - 1),
+      reservedCells(capacity / RESERVED_DIVISOR),
+      flushSeverity(flushSeverity),
+      minimumSeverity(LogSeverity::Trace),
+      cells(new Cell[capacity]),
+      enqueuePosition(0),
+      dequeuePosition(0),
+      dequeued(0),
+      written(0),
+      reportedDrops(0),
+      urgent(false),
+      stopping(false),
+      memory(MemoryCategory::Logging) {
+    for (size_t i = 0; i < capacity; ++i) cells[i].sequence.store(i, std::memory_order_relaxed);
+    for (auto& counter : dropped) counter.store(0, std::memory_order_relaxed);
+    memory.Set(capacity * sizeof(Cell));
+    writer = std::thread(&AsyncLog::WriterLoop, this);
+}
+
+AsyncLog::~AsyncLog() {
+    // Susmuş çağrı yerlerinin bekleyen "tekrarlandı / bastırıldı" sayıları kaybolmaz
+    LogRateLimiter::FlushAll(*this);
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_one();
+    writer.join();
+}
+
+bool AsyncLog::SetFile(const std::string& filePath, Encoding encoding) {
+    // Önceki dosyaya ait kayıtlar önce oraya yazılır
+    Flush();
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    return fileSink.Open(filePath, encoding);
+}
+
+void AsyncLog::AddSink(std::shared_ptr<LogSink> sink) {
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    sinks.push_back(std::move(sink));
+}
+
+void AsyncLog::RemoveSink(const LogSink* sink) {
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    sinks.erase(std::remove_if(sinks.begin(), sinks.end(),
+                               [sink](const std::shared_ptr<LogSink>& entry) { return entry.get() == sink; }),
+                sinks.end());
+}
+
+bool AsyncLog::Push(LogSeverity severity, std::string_view message) {
+    return PushRecord(severity, BinaryLog::TEXT_FORMAT, reinterpret_cast<const uint8_t*>(message.data()), message.size());
+}
+
+bool AsyncLog::PushRecord(LogSeverity severity, uint16_t formatId, const uint8_t* payload, size_t length) {
+    // Süzülen kayıt düşürülmüş sayılmaz
+    if (!IsEnabled(severity)) return false;
+    const bool lowSeverity = severity < LogSeverity::Warning;
+    uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells[position & mask];
+        const uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+        if (difference == 0) {
+            // Doluluk yaklaşık (yazıcı arada boşaltıyor olabilir): ayrılmış hücrelere düşük öncelik giremez
+            if (lowSeverity && position - dequeued.load(std::memory_order_relaxed) >= capacity - reservedCells) {
+                dropped[static_cast<size_t>(severity)].fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        } else if (difference < 0) {
+            dropped[static_cast<size_t>(severity)].fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    if (formatId == BinaryLog::TEXT_FORMAT) {
+        length = CopyLogText(cell->text, MAX_MESSAGE_BYTES, reinterpret_cast<const char*>(payload), length);
+    } else {
+        // Kodlanmış argümanlar MAX_PAYLOAD_BYTES'ı aşmaz
+        length = std::min(length, MAX_MESSAGE_BYTES);
+        std::memcpy(cell->text, payload, length);
+    }
+    cell->length = static_cast<uint8_t>(length);
+    cell->formatId = formatId;
+    cell->severity = severity;
+    cell->timestampMs = NowMs();
+    cell->sequence.store(position + 1, std::memory_order_release);
+
+    // Yazıcı normalde aralıkla uyanır; önemli kayıt veya yarı dolu kuyruk erken uyandırır
+    if (severity >= flushSeverity || position - dequeued.load(std::memory_order_relaxed) == capacity / 2) {
+        urgent.store(true, std::memory_order_release);
+        wakeCondition.notify_one();
+    }
+    return true;
+}
+
+void AsyncLog::Flush() {
+    const uint64_t target = enqueuePosition.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    urgent.store(true, std::memory_order_release);
+    wakeCondition.notify_one();
+    flushedCondition.wait(lock, [&] { return written.load(std::memory_order_acquire) >= target || stopping; });
+}
+
+uint64_t AsyncLog::GetDroppedCount(LogSeverity severity) const {
+    return dropped[static_cast<size_t>(severity)].load(std::memory_order_relaxed);
+}
+
+uint64_t AsyncLog::GetDroppedCount() const {
+    uint64_t total = 0;
+    for (const auto& counter : dropped) total += counter.load(std::memory_order_relaxed);
+    return total;
+}
+
+const char* AsyncLog::GetSeverityName(LogSeverity severity) {
+    return GetLogSeverityName(severity);
+}
+
+void AsyncLog::WriterLoop() {
+    recordText.reserve(MAX_MESSAGE_BYTES * 2);
+    for (;;) {
+        bool stop;
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCondition.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS), [&] {
+                return stopping || urgent.load(std::memory_order_acquire);
+            });
+            stop = stopping;
+        }
+        urgent.store(false, std::memory_order_relaxed);
+        // Sonraki Drain'de yazılır
+        LogRateLimiter::FlushDue(*this, LogRateLimiter::NowMs());
+
+        size_t consumed;
+        {
+            // Dosya, kodlaması ve sink listesi döngü boyunca değişmez
+            std::lock_guard<std::mutex> lock(sinkMutex);
+            fileSink.BeginBatch();
+            for (const auto& sink : sinks) sink->BeginBatch();
+            consumed = Drain();
+            fileSink.EndBatch();
+            for (const auto& sink : sinks) sink->EndBatch();
+        }
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            written.fetch_add(consumed, std::memory_order_release);
+        }
+        flushedCondition.notify_all();
+
+        // Durdurulurken yayınlanmayı bekleyen son kayıtlar da alınır
+        if (stop && enqueuePosition.load(std::memory_order_acquire) == dequeuePosition) break;
+    }
+}
+
+size_t AsyncLog::Drain() {
+    size_t consumed = 0;
+    int64_t lastTimestamp = NowMs();
+    for (;;) {
+        Cell& cell = cells[dequeuePosition & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) break;
+
+        // Hücre, sink'ler kaydı tüketene kadar üreticilere geri verilmez
+        Dispatch(LogRecord(cell.timestampMs, cell.severity, cell.formatId, reinterpret_cast<const uint8_t*>(cell.text),
+                           cell.length, recordText));
+        lastTimestamp = cell.timestampMs;
+
+        cell.sequence.store(dequeuePosition + capacity, std::memory_order_release);
+        ++dequeuePosition;
+        dequeued.store(dequeuePosition, std::memory_order_release);
+        ++consumed;
+    }
+
+    const uint64_t drops = GetDroppedCount();
+    if (drops != reportedDrops) {
+        const std::string note = std::to_string(drops - reportedDrops) + " kayıt kuyruk dolu olduğu için düşürüldü";
+        Dispatch(LogRecord(lastTimestamp, LogSeverity::Warning, BinaryLog::TEXT_FORMAT,
+                           reinterpret_cast<const uint8_t*>(note.data()), note.size(), recordText));
+        reportedDrops = drops;
+    }
+    return consumed;
+}
+
+void AsyncLog::Dispatch(const LogRecord& record) {
+    const LogSeverity severity = record.GetSeverity();
+    if (fileSink.Accepts(severity)) fileSink.Consume(record);
+    for (const auto& sink : sinks) {
+        if (sink->Accepts(severity)) sink->Consume(record);
+    }
+}
@@ -0,0 +1,262 @@
+// Source/BinaryLog.cpp
+#include "../Headers/BinaryLog.h"
+#include "../Headers/LogText.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace {
+
+enum RecordKind : uint8_t {
+    FORMAT_DEFINITION = 1,
+    ENTRY = 2
+};
+
+// Biçim tablosu dolarsa yeni çağrı yerleri argümanları yan yana basan biçimi paylaşır
+constexpr uint16_t OVERFLOW_FORMAT = BinaryLog::MAX_FORMATS - 1;
+constexpr const char* OVERFLOW_TEXT = "{} {} {} {} {} {} {} {}";
+
+std::atomic<const char*> g_formats[BinaryLog::MAX_FORMATS];
+std::atomic<uint16_t> g_nextFormat{ 1 };
+
+template <typename T>
+void AppendRaw(std::string& out, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+template <typename T>
+bool ReadRaw(std::istream& in, T& value) {
+    char bytes[sizeof(T)];
+    if (!in.read(bytes, sizeof(T))) return false;
+    std::memcpy(&value, bytes, sizeof(T));
+    return true;
+}
+
+bool ReadVarint(const uint8_t*& cursor, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; cursor < end && shift < 64; shift += 7) {
+        const uint8_t byte = *cursor++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+// Sıradaki argümanı metne çevirir; payload bittiyse veya bozuksa false
+bool RenderArgument(const uint8_t*& cursor, const uint8_t* end, std::string& out) {
+    if (cursor >= end) return false;
+    const char tag = static_cast<char>(*cursor++);
+    char number[32];
+    switch (tag) {
+        case 'i':
+        case 'u': {
+            uint64_t value;
+            if (!ReadVarint(cursor, end, value)) return false;
+            std::to_chars_result result;
+            if (tag == 'i') {
+                const int64_t decoded = static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+                result = std::to_chars(number, number + sizeof(number), decoded);
+            } else {
+                result = std::to_chars(number, number + sizeof(number), value);
+            }
+            out.append(number, result.ptr);
+            return true;
+        }
+        case 'd': {
+            double value;
+            if (end - cursor < static_cast<ptrdiff_t>(sizeof(double))) return false;
+            std::memcpy(&value, cursor, sizeof(double));
+            cursor += sizeof(double);
+            const int length = std::snprintf(number, sizeof(number), "%g", value);
+            out.append(number, static_cast<size_t>(std::max(length, 0)));
+            return true;
+        }
+        case 's': {
+            if (cursor >= end) return false;
+            const size_t declared = *cursor++;
+            const size_t length = std::min(declared, static_cast<size_t>(end - cursor));
+            out.append(reinterpret_cast<const char*>(cursor), length);
+            cursor += length;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+BinaryLog::Format::Format(const char* text) : text(text), id(OVERFLOW_FORMAT) {
+    uint16_t next = g_nextFormat.load(std::memory_order_relaxed);
+    while (next < OVERFLOW_FORMAT && !g_nextFormat.compare_exchange_weak(next, next + 1, std::memory_order_relaxed)) {
+    }
+    if (next < OVERFLOW_FORMAT) {
+        id = next;
+        g_formats[id].store(text, std::memory_order_release);
+    }
+}
+
+void BinaryLog::Encoder::PutUnsigned(char tag, uint64_t value) {
+    // Etiket + en fazla 10 baytlık varint
+    if (length + 11 > MAX_PAYLOAD_BYTES) return;
+    buffer[length++] = static_cast<uint8_t>(tag);
+    while (value >= 0x80) {
+        buffer[length++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    buffer[length++] = static_cast<uint8_t>(value);
+}
+
+void BinaryLog::Encoder::Put(double value) {
+    if (length + 1 + sizeof(double) > MAX_PAYLOAD_BYTES) return;
+    buffer[length++] = 'd';
+    std::memcpy(buffer + length, &value, sizeof(double));
+    length += sizeof(double);
+}
+
+void BinaryLog::Encoder::Put(std::string_view value) {
+    if (length + 2 > MAX_PAYLOAD_BYTES) return;
+    // wstring sürümü gibi çok baytlı bir karakterin ortasında kesmez
+    const size_t count = GetUtf8PrefixLength(value.data(), value.size(), MAX_PAYLOAD_BYTES - length - 2);
+    buffer[length++] = 's';
+    buffer[length++] = static_cast<uint8_t>(count);
+    if (count > 0) std::memcpy(buffer + length, value.data(), count);
+    length += count;
+}
+
+void BinaryLog::Encoder::Put(std::wstring_view value) {
+    if (length + 2 > MAX_PAYLOAD_BYTES) return;
+    buffer[length++] = 's';
+    uint8_t* count = &buffer[length++];
+    const size_t start = length;
+    for (size_t i = 0; i < value.size(); ++i) {
+        uint32_t code = static_cast<uint32_t>(value[i]);
+        // UTF-16 (Windows): vekil çiftleri birleştir
+        if (code >= 0xD800 && code <= 0xDBFF && i + 1 < value.size()) {
+            const uint32_t low = static_cast<uint32_t>(value[i + 1]);
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                ++i;
+            }
+        }
+        uint8_t bytes[4];
+        size_t size;
+        if (code < 0x80) {
+            bytes[0] = static_cast<uint8_t>(code);
+            size = 1;
+        } else if (code < 0x800) {
+            bytes[0] = static_cast<uint8_t>(0xC0 | (code >> 6));
+            bytes[1] = static_cast<uint8_t>(0x80 | (code & 0x3F));
+            size = 2;
+        } else if (code < 0x10000) {
+            bytes[0] = static_cast<uint8_t>(0xE0 | (code >> 12));
+            bytes[1] = static_cast<uint8_t>(0x80 | ((code >> 6) & 0x3F));
+            bytes[2] = static_cast<uint8_t>(0x80 | (code & 0x3F));
+            size = 3;
+        } else {
+            bytes[0] = static_cast<uint8_t>(0xF0 | (code >> 18));
+            bytes[1] = static_cast<uint8_t>(0x80 | ((code >> 12) & 0x3F));
+            bytes[2] = static_cast<uint8_t>(0x80 | ((code >> 6) & 0x3F));
+            bytes[3] = static_cast<uint8_t>(0x80 | (code & 0x3F));
+            size = 4;
+        }
+        // Karakter ortasında kesilmez
+        if (length + size > MAX_PAYLOAD_BYTES) break;
+        std::memcpy(buffer + length, bytes, size);
+        length += size;
+    }
+    *count = static_cast<uint8_t>(length - start);
+}
+
+const char* BinaryLog::GetFormat(uint16_t id) {
+    if (id == OVERFLOW_FORMAT) return OVERFLOW_TEXT;
+    const char* text = id < MAX_FORMATS ? g_formats[id].load(std::memory_order_acquire) : nullptr;
+    return text ? text : OVERFLOW_TEXT;
+}
+
+void BinaryLog::Render(const char* format, const uint8_t* payload, size_t length, std::string& out) {
+    const uint8_t* cursor = payload;
+    const uint8_t* end = payload + length;
+    for (const char* p = format; *p; ++p) {
+        if (p[0] == '{' && p[1] == '}') {
+            if (!RenderArgument(cursor, end, out)) cursor = end;
+            ++p;
+        } else {
+            out += *p;
+        }
+    }
+}
+
+void BinaryLog::AppendFileHeader(std::string& out) {
+    out.append(FILE_MAGIC, sizeof(FILE_MAGIC));
+}
+
+void BinaryLog::AppendFormatDefinition(std::string& out, uint16_t id) {
+    const char* text = GetFormat(id);
+    const uint16_t length = static_cast<uint16_t>(std::min<size_t>(std::strlen(text), UINT16_MAX));
+    out += static_cast<char>(FORMAT_DEFINITION);
+    AppendRaw(out, id);
+    AppendRaw(out, length);
+    out.append(text, length);
+}
+
+void BinaryLog::AppendRecord(std::string& out, int64_t timestampMs, LogSeverity severity, uint16_t formatId,
+                             const uint8_t* payload, size_t length) {
+    length = std::min(length, MAX_PAYLOAD_BYTES);
+    out += static_cast<char>(ENTRY);
+    AppendRaw(out, timestampMs);
+    out += static_cast<char>(severity);
+    AppendRaw(out, formatId);
+    out += static_cast<char>(length);
+    out.append(reinterpret_cast<const char*>(payload), length);
+}
+
+bool BinaryLog::Decode(std::istream& in, std::ostream& out) {
+    char magic[sizeof(FILE_MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0) return false;
+
+    std::vector<std::string> formats(MAX_FORMATS);
+    LogLinePrefix prefix;
+    std::string line;
+    uint8_t payload[MAX_PAYLOAD_BYTES];
+    char kind;
+    while (in.get(kind)) {
+        if (kind == FORMAT_DEFINITION) {
+            uint16_t id;
+            uint16_t length;
+            if (!ReadRaw(in, id) || !ReadRaw(in, length) || id >= MAX_FORMATS) return false;
+            formats[id].resize(length);
+            if (!in.read(formats[id].data(), length)) return false;
+        } else if (kind == ENTRY) {
+            int64_t timestampMs;
+            uint8_t severity;
+            uint16_t formatId;
+            uint8_t length;
+            if (!ReadRaw(in, timestampMs) || !ReadRaw(in, severity) || !ReadRaw(in, formatId) ||
+                !ReadRaw(in, length) || length > MAX_PAYLOAD_BYTES || formatId >= MAX_FORMATS ||
+                !in.read(reinterpret_cast<char*>(payload), length)) {
+                return false;
+            }
+
+            line.clear();
+            prefix.Append(line, timestampMs, static_cast<LogSeverity>(severity));
+            if (formatId == TEXT_FORMAT) {
+                line.append(reinterpret_cast<const char*>(payload), length);
+            } else {
+                Render(formatId == OVERFLOW_FORMAT ? OVERFLOW_TEXT : formats[formatId].c_str(), payload, length, line);
+            }
+            line += '\n';
+            out.write(line.data(), static_cast<std::streamsize>(line.size()));
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,89 @@
+// Source/BufferDepthController.cpp
+#include "../Headers/BufferDepthController.h"
+
+#include <algorithm>
+#include <cmath>
+
+BufferDepthController::BufferDepthController(double frameIntervalMs)
+    : frameInterval(frameIntervalMs), nextSlot(0), backlog(0.0), stallPercentile(0.0),
+      targetDepth(INITIAL_DEPTH), memoryCap(MAX_DEPTH), framesBelowTarget(0) {
+    stalls.reserve(WINDOW_SIZE);
+    scratch.reserve(WINDOW_SIZE);
+}
+
+void BufferDepthController::Reset(double frameIntervalMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    frameInterval = frameIntervalMs;
+    stalls.clear();
+    nextSlot = 0;
+    backlog = 0.0;
+    stallPercentile = 0.0;
+    targetDepth = INITIAL_DEPTH;
+    framesBelowTarget = 0;
+}
+
+void BufferDepthController::SetMemoryCap(int frames) {
+    std::lock_guard<std::mutex> lock(mutex);
+    memoryCap = std::clamp(frames, 1, MAX_DEPTH);
+}
+
+int BufferDepthController::DepthForStall(double stallMs) const {
+    // Kuyruk doluyken decode her kare aralığında bir kare ilerler. Birikmiş
+    // gecikme B ise kare, B + aralık kadar sonra hazır olur; gösterilmeden önce
+    // kuyrukta depth * aralık süre vardır → depth >= B / aralık + 1
+    if (frameInterval <= 0.0) return MIN_DEPTH;
+    const int frames = static_cast<int>(std::ceil(stallMs / frameInterval - 1e-9)) + 1;
+    return std::clamp(frames, MIN_DEPTH, MAX_DEPTH);
+}
+
+bool BufferDepthController::RecordDecode(double decodeMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Kare aralığından uzun süren decode'lar birikir, kısa olanlar birikeni eritir
+    backlog = std::max(0.0, backlog + decodeMs - frameInterval);
+    if (stalls.size() < WINDOW_SIZE) {
+        stalls.push_back(backlog);
+    } else {
+        stalls[nextSlot] = backlog;
+    }
+    nextSlot = (nextSlot + 1) % WINDOW_SIZE;
+
+    if (stalls.size() < WARMUP_SAMPLES) return false;
+
+    scratch.assign(stalls.begin(), stalls.end());
+    const size_t rank = static_cast<size_t>(std::ceil(STALL_PERCENTILE * scratch.size())) - 1;
+    std::nth_element(scratch.begin(), scratch.begin() + rank, scratch.end());
+    stallPercentile = scratch[rank];
+
+    const int needed = DepthForStall(stallPercentile);
+    const int previous = targetDepth;
+    if (needed >= targetDepth) {
+        targetDepth = needed;
+        framesBelowTarget = 0;
+    } else if (++framesBelowTarget >= SHRINK_AFTER) {
+        // Kısa süreli sakinlikte hemen küçülme: bir sonraki patlama yine gelebilir
+        --targetDepth;
+        framesBelowTarget = 0;
+    }
+    return targetDepth != previous;
+}
+
+int BufferDepthController::GetDepth() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::min(targetDepth, memoryCap);
+}
+
+int BufferDepthController::GetTargetDepth() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return targetDepth;
+}
+
+double BufferDepthController::GetStallPercentile() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stallPercentile;
+}
+
+double BufferDepthController::GetFrameInterval() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return frameInterval;
+}
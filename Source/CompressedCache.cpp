@@ -0,0 +1,236 @@
+// Source/CompressedCache.cpp
+#include "../Headers/CompressedCache.h"
+#include "../Headers/FastCompressor.h"
+
+CompressedCache::CompressedCache(MemoryCategory category, size_t capacityBytes)
+    : capacity(capacityBytes), residentBytes(0), rawBytes(0), compressedCount(0), stats{},
+      memory(category), broker(nullptr), budgetId(0) {
+}
+
+CompressedCache::~CompressedCache() {
+    // Callback'in artık çağrılmayacağından emin ol
+    if (broker) broker->Unregister(budgetId);
+}
+
+size_t CompressedCache::EntryBytes(const Entry& entry) const {
+    return entry.pixels ? entry.rawSize : entry.compressed.size();
+}
+
+void CompressedCache::Put(const std::wstring& key, std::vector<uint8_t> pixels, int width, int height, int stride) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto found = index.find(key);
+    if (found != index.end()) {
+        residentBytes -= EntryBytes(*found->second);
+        rawBytes -= found->second->rawSize;
+        if (!found->second->pixels) --compressedCount;
+        entries.erase(found->second);
+        index.erase(found);
+    }
+
+    Entry entry;
+    entry.key = key;
+    entry.rawSize = pixels.size();
+    entry.pixels = std::make_shared<const std::vector<uint8_t>>(std::move(pixels));
+    entry.width = width;
+    entry.height = height;
+    entry.stride = stride;
+    entry.lastAccess = Clock::now();
+
+    residentBytes += entry.rawSize;
+    rawBytes += entry.rawSize;
+    entries.push_front(std::move(entry));
+    index[key] = entries.begin();
+
+    EvictLocked(capacity);
+    memory.Set(residentBytes);
+}
+
+bool CompressedCache::Get(const std::wstring& key, Item& item) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto found = index.find(key);
+    if (found == index.end()) return false;
+
+    Entry& entry = *found->second;
+    if (!entry.pixels && !DecompressEntry(entry)) {
+        // Bozuk girdi: kaynaktan yeniden üretilsin
+        residentBytes -= EntryBytes(entry);
+        rawBytes -= entry.rawSize;
+        --compressedCount;
+        entries.erase(found->second);
+        index.erase(found);
+        memory.Set(residentBytes);
+        return false;
+    }
+
+    entry.lastAccess = Clock::now();
+    entries.splice(entries.begin(), entries, found->second);
+
+    item.pixels = entry.pixels;
+    item.width = entry.width;
+    item.height = entry.height;
+    item.stride = entry.stride;
+
+    // Açılan girdi bütçeyi aşırdıysa en eskileri at
+    EvictLocked(capacity);
+    memory.Set(residentBytes);
+    return true;
+}
+
+void CompressedCache::Remove(const std::wstring& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = index.find(key);
+    if (found == index.end()) return;
+
+    residentBytes -= EntryBytes(*found->second);
+    rawBytes -= found->second->rawSize;
+    if (!found->second->pixels) --compressedCount;
+    entries.erase(found->second);
+    index.erase(found);
+    memory.Set(residentBytes);
+}
+
+void CompressedCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    residentBytes = 0;
+    rawBytes = 0;
+    compressedCount = 0;
+    memory.Set(0);
+}
+
+bool CompressedCache::CompressEntry(Entry& entry) {
+    const auto start = Clock::now();
+
+    const std::vector<uint8_t>& raw = *entry.pixels;
+    std::vector<uint8_t> compressed(FastCompressor::MaxCompressedSize(raw.size()));
+    const size_t size = FastCompressor::Compress(raw.data(), raw.size(), compressed.data(), compressed.size());
+
+    stats.compressNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    if (size == 0 || static_cast<double>(size) > static_cast<double>(raw.size()) * (1.0 - MIN_SAVING)) {
+        return false;
+    }
+
+    compressed.resize(size);
+    compressed.shrink_to_fit();
+    entry.compressed = std::move(compressed);
+    entry.pixels.reset();
+
+    ++stats.compressions;
+    stats.rawBytesCompressed += entry.rawSize;
+    stats.compressedBytes += size;
+    return true;
+}
+
+bool CompressedCache::DecompressEntry(Entry& entry) {
+    const auto start = Clock::now();
+
+    std::vector<uint8_t> raw(entry.rawSize);
+    if (!FastCompressor::Decompress(entry.compressed.data(), entry.compressed.size(), raw.data(), raw.size())) {
+        return false;
+    }
+
+    residentBytes += entry.rawSize;
+    residentBytes -= entry.compressed.size();
+    --compressedCount;
+    entry.pixels = std::make_shared<const std::vector<uint8_t>>(std::move(raw));
+    entry.compressed = std::vector<uint8_t>();
+
+    ++stats.decompressions;
+    stats.decompressNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    return true;
+}
+
+size_t CompressedCache::CompressCold(std::chrono::milliseconds minAge) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto now = Clock::now();
+    size_t saved = 0;
+    // Sondan (en eski) başla; yeterince yeni bir girdiye gelince dur
+    for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+        if (now - it->lastAccess < minAge) break;
+        if (!it->pixels) continue;
+
+        const size_t before = it->rawSize;
+        if (CompressEntry(*it)) {
+            saved += before - it->compressed.size();
+            residentBytes -= before - it->compressed.size();
+            ++compressedCount;
+        }
+    }
+    memory.Set(residentBytes);
+    return saved;
+}
+
+void CompressedCache::EvictTo(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    EvictLocked(bytes);
+    memory.Set(residentBytes);
+}
+
+void CompressedCache::EvictLocked(size_t bytes) {
+    // En son eklenen / erişilen girdi tek başına limiti aşsa bile tutulur
+    while (residentBytes > bytes && entries.size() > 1) {
+        const Entry& oldest = entries.back();
+        residentBytes -= EntryBytes(oldest);
+        rawBytes -= oldest.rawSize;
+        if (!oldest.pixels) --compressedCount;
+        index.erase(oldest.key);
+        entries.pop_back();
+    }
+}
+
+void CompressedCache::AttachToBroker(MemoryBudgetBroker& budgetBroker, const std::string& name, int priority,
+                                     size_t minimumBytes) {
+    MemoryBudgetBroker::Consumer consumer;
+    consumer.name = name;
+    consumer.priority = priority;
+    consumer.minimumBytes = minimumBytes;
+    consumer.desiredBytes = capacity;
+    consumer.onBudget = [this](size_t budgetBytes, MemoryPressure pressure) { OnBudget(budgetBytes, pressure); };
+
+    broker = &budgetBroker;
+    budgetId = broker->Register(std::move(consumer));
+}
+
+void CompressedCache::OnBudget(size_t budgetBytes, MemoryPressure pressure) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        capacity = budgetBytes;
+    }
+
+    // Atmadan önce sıkıştır: aynı bütçede daha fazla içerik bellekte kalır
+    if (pressure == MemoryPressure::Critical) {
+        CompressCold(std::chrono::milliseconds(0));
+    } else if (pressure == MemoryPressure::Moderate || GetResidentBytes() > budgetBytes) {
+        CompressCold(std::chrono::milliseconds(DEFAULT_COLD_AGE_MS));
+    }
+    EvictTo(budgetBytes);
+}
+
+size_t CompressedCache::GetResidentBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return residentBytes;
+}
+
+size_t CompressedCache::GetRawBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return rawBytes;
+}
+
+size_t CompressedCache::GetEntryCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+size_t CompressedCache::GetCompressedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return compressedCount;
+}
+
+CompressedCache::Stats CompressedCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
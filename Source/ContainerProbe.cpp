@@ -0,0 +1,804 @@
+// Source/ContainerProbe.cpp
+#include "../Headers/ContainerProbe.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwctype>
+#include <vector>
+
+// Sınırlı okuma yapan basit dosya sarmalayıcısı
+struct ProbeFile {
+    std::FILE* file;
+    uint64_t size;
+
+    explicit ProbeFile(const std::filesystem::path& path) : file(nullptr), size(0) {
+#ifdef _WIN32
+        file = _wfopen(path.c_str(), L"rb");
+#else
+        file = std::fopen(path.c_str(), "rb");
+#endif
+        if (file) {
+            std::error_code ec;
+            size = std::filesystem::file_size(path, ec);
+            if (ec) size = 0;
+        }
+    }
+
+    ~ProbeFile() {
+        if (file) std::fclose(file);
+    }
+
+    bool ReadAt(uint64_t offset, void* buffer, size_t count) {
+        // Toplama taşabilir (64-bit largesize): çıkarma biçimi
+        if (!file || count > size || offset > size - count) return false;
+#ifdef _WIN32
+        if (_fseeki64(file, static_cast<long long>(offset), SEEK_SET) != 0) return false;
+#else
+        if (fseeko(file, static_cast<off_t>(offset), SEEK_SET) != 0) return false;
+#endif
+        return std::fread(buffer, 1, count, file) == count;
+    }
+
+    bool ReadBlock(uint64_t offset, uint64_t count, std::vector<uint8_t>& out) {
+        if (count > ContainerProbe::MAX_INDEX_READ) return false;
+        out.resize(static_cast<size_t>(count));
+        return count == 0 || ReadAt(offset, out.data(), out.size());
+    }
+};
+
+static uint16_t ReadBE16(const uint8_t* p) { return static_cast<uint16_t>((p[0] << 8) | p[1]); }
+static uint32_t ReadBE32(const uint8_t* p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+           (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+static uint64_t ReadBE64(const uint8_t* p) { return (static_cast<uint64_t>(ReadBE32(p)) << 32) | ReadBE32(p + 4); }
+static uint16_t ReadLE16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+static uint32_t ReadLE32(const uint8_t* p) {
+    return p[0] | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) |
+           (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static bool FourCCEquals(const uint8_t* p, const char* fourcc) { return std::memcmp(p, fourcc, 4) == 0; }
+
+// ISO/IEC 23091-2 matrix / primaries kodlarından renk uzayı adı
+static std::string ColorSpaceFromCodes(int matrix, int primaries) {
+    switch (matrix) {
+        case 0:  return "RGB";
+        case 1:  return "BT.709";
+        case 5:
+        case 6:  return "BT.601";
+        case 9:
+        case 10: return "BT.2020";
+    }
+    switch (primaries) {
+        case 1:  return "BT.709";
+        case 5:
+        case 6:  return "BT.601";
+        case 9:  return "BT.2020";
+    }
+    return "";
+}
+
+// Renk bilgisi yazılmamışsa decoder'ların da kullandığı kurala göre tahmin et
+static void FinalizeResult(ContainerProbe::Result& result) {
+    if (result.colorSpace.empty() && result.height > 0) {
+        result.colorSpace = result.height >= 720 ? "BT.709" : "BT.601";
+    }
+    if (result.bitDepth == 0 && !result.codec.empty()) {
+        result.bitDepth = 8;
+    }
+    if (result.duration <= 0.0 && result.fps > 0.0 && result.frameCount > 0) {
+        result.duration = result.frameCount / result.fps;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// MP4 / MOV (ISO BMFF)
+// ---------------------------------------------------------------------------
+
+struct Mp4Box {
+    const uint8_t* type;
+    const uint8_t* data;
+    size_t size;
+};
+
+// [begin, end) aralığındaki bir sonraki kutuyu çözümle
+static bool NextMp4Box(const uint8_t*& cursor, const uint8_t* end, Mp4Box& box) {
+    if (end - cursor < 8) return false;
+    uint64_t boxSize = ReadBE32(cursor);
+    size_t headerSize = 8;
+    if (boxSize == 1) {
+        if (end - cursor < 16) return false;
+        boxSize = ReadBE64(cursor + 8);
+        headerSize = 16;
+    } else if (boxSize == 0) {
+        boxSize = static_cast<uint64_t>(end - cursor);
+    }
+    if (boxSize < headerSize || boxSize > static_cast<uint64_t>(end - cursor)) return false;
+
+    box.type = cursor + 4;
+    box.data = cursor + headerSize;
+    box.size = static_cast<size_t>(boxSize - headerSize);
+    cursor += boxSize;
+    return true;
+}
+
+static bool FindMp4Child(const uint8_t* data, size_t size, const char* type, Mp4Box& found) {
+    const uint8_t* cursor = data;
+    Mp4Box box;
+    while (NextMp4Box(cursor, data + size, box)) {
+        if (FourCCEquals(box.type, type)) {
+            found = box;
+            return true;
+        }
+    }
+    return false;
+}
+
+static std::string CodecFromMp4FourCC(const uint8_t* fourcc) {
+    static const struct { const char* fourcc; const char* name; } codecs[] = {
+        { "avc1", "H.264" }, { "avc3", "H.264" },
+        { "hvc1", "HEVC" },  { "hev1", "HEVC" },
+        { "av01", "AV1" },   { "vp09", "VP9" },  { "vp08", "VP8" },
+        { "mp4v", "MPEG-4 Part 2" },
+        { "jpeg", "MJPEG" }, { "mjpa", "MJPEG" },
+        { "apch", "ProRes" }, { "apcn", "ProRes" }, { "apcs", "ProRes" },
+        { "apco", "ProRes" }, { "ap4h", "ProRes" },
+    };
+    for (const auto& codec : codecs) {
+        if (FourCCEquals(fourcc, codec.fourcc)) return codec.name;
+    }
+    return std::string(reinterpret_cast<const char*>(fourcc), 4);
+}
+
+// avcC kutusundan (High profil uzantısı varsa) bit derinliğini oku
+static int BitDepthFromAvcC(const uint8_t* data, size_t size) {
+    if (size < 7) return 0;
+    const int profile = data[1];
+    size_t pos = 5;
+    int numSps = data[pos++] & 0x1F;
+    for (int i = 0; i < numSps; ++i) {
+        if (pos + 2 > size) return 0;
+        pos += 2 + ReadBE16(data + pos);
+    }
+    if (pos >= size) return 0;
+    int numPps = data[pos++];
+    for (int i = 0; i < numPps; ++i) {
+        if (pos + 2 > size) return 0;
+        pos += 2 + ReadBE16(data + pos);
+    }
+    if ((profile == 100 || profile == 110 || profile == 122 || profile == 244) && pos + 3 <= size) {
+        return (data[pos + 1] & 0x07) + 8;
+    }
+    // Uzantı yoksa profil adı yeterli bilgi verir
+    return (profile == 110 || profile == 122 || profile == 244) ? 10 : 8;
+}
+
+static void ParseMp4SampleEntry(const Mp4Box& entry, ContainerProbe::Result& result) {
+    result.codec = CodecFromMp4FourCC(entry.type);
+
+    // VisualSampleEntry: 6 reserved + 2 data_ref + 16 pre_defined + width/height ...
+    const size_t visualHeaderSize = 78;
+    if (entry.size < visualHeaderSize) return;
+    result.width = ReadBE16(entry.data + 24);
+    result.height = ReadBE16(entry.data + 26);
+
+    int matrix = -1, primaries = -1;
+    const uint8_t* cursor = entry.data + visualHeaderSize;
+    const uint8_t* end = entry.data + entry.size;
+    Mp4Box box;
+    while (NextMp4Box(cursor, end, box)) {
+        if (FourCCEquals(box.type, "avcC")) {
+            result.bitDepth = BitDepthFromAvcC(box.data, box.size);
+        } else if (FourCCEquals(box.type, "hvcC") && box.size > 17) {
+            result.bitDepth = (box.data[17] & 0x07) + 8;
+        } else if (FourCCEquals(box.type, "av1C") && box.size > 2) {
+            const bool highBitDepth = (box.data[2] & 0x40) != 0;
+            const bool twelveBit = (box.data[2] & 0x20) != 0;
+            result.bitDepth = highBitDepth ? (twelveBit ? 12 : 10) : 8;
+        } else if (FourCCEquals(box.type, "vpcC") && box.size >= 10) {
+            // FullBox: 4 bayt version/flags
+            result.bitDepth = box.data[6] >> 4;
+            primaries = box.data[7];
+            matrix = box.data[9];
+        } else if (FourCCEquals(box.type, "colr") && box.size >= 10 &&
+                   (FourCCEquals(box.data, "nclx") || FourCCEquals(box.data, "nclc"))) {
+            primaries = ReadBE16(box.data + 4);
+            matrix = ReadBE16(box.data + 8);
+        }
+    }
+    if (matrix >= 0 || primaries >= 0) {
+        result.colorSpace = ColorSpaceFromCodes(matrix, primaries);
+    }
+}
+
+static bool ParseMp4VideoTrack(const Mp4Box& trak, ContainerProbe::Result& result) {
+    Mp4Box mdia, hdlr, mdhd, minf, stbl;
+    if (!FindMp4Child(trak.data, trak.size, "mdia", mdia)) return false;
+    if (!FindMp4Child(mdia.data, mdia.size, "hdlr", hdlr) || hdlr.size < 12) return false;
+    if (!FourCCEquals(hdlr.data + 8, "vide")) return false;
+
+    uint32_t timescale = 0;
+    if (FindMp4Child(mdia.data, mdia.size, "mdhd", mdhd) && mdhd.size >= 24) {
+        if (mdhd.data[0] == 1 && mdhd.size >= 32) {
+            timescale = ReadBE32(mdhd.data + 20);
+            if (timescale) result.duration = static_cast<double>(ReadBE64(mdhd.data + 24)) / timescale;
+        } else {
+            timescale = ReadBE32(mdhd.data + 12);
+            if (timescale) result.duration = static_cast<double>(ReadBE32(mdhd.data + 16)) / timescale;
+        }
+    }
+
+    if (!FindMp4Child(mdia.data, mdia.size, "minf", minf)) return true;
+    if (!FindMp4Child(minf.data, minf.size, "stbl", stbl)) return true;
+
+    Mp4Box stsd, stts, stss;
+    if (FindMp4Child(stbl.data, stbl.size, "stsd", stsd) && stsd.size > 8) {
+        const uint8_t* cursor = stsd.data + 8;
+        Mp4Box entry;
+        if (NextMp4Box(cursor, stsd.data + stsd.size, entry)) {
+            ParseMp4SampleEntry(entry, result);
+        }
+    }
+
+    uint64_t totalDelta = 0;
+    if (FindMp4Child(stbl.data, stbl.size, "stts", stts) && stts.size >= 8) {
+        uint32_t entryCount = ReadBE32(stts.data + 4);
+        entryCount = std::min<uint32_t>(entryCount, static_cast<uint32_t>((stts.size - 8) / 8));
+        for (uint32_t i = 0; i < entryCount; ++i) {
+            const uint8_t* entry = stts.data + 8 + i * 8;
+            const uint64_t count = ReadBE32(entry);
+            result.frameCount += count;
+            totalDelta += count * ReadBE32(entry + 4);
+        }
+    }
+    if (timescale && totalDelta) {
+        result.fps = static_cast<double>(result.frameCount) * timescale / totalDelta;
+    }
+
+    // stss yoksa tüm örnekler anahtar karedir
+    if (FindMp4Child(stbl.data, stbl.size, "stss", stss) && stss.size >= 8) {
+        result.keyframeCount = ReadBE32(stss.data + 4);
+    } else {
+        result.keyframeCount = result.frameCount;
+    }
+    return true;
+}
+
+static bool ProbeMp4(ProbeFile& file, ContainerProbe::Result& result) {
+    uint64_t offset = 0;
+    bool sawFtyp = false;
+
+    for (int i = 0; i < ContainerProbe::MAX_TOP_LEVEL_ITEMS && offset + 8 <= file.size; ++i) {
+        uint8_t header[16];
+        if (!file.ReadAt(offset, header, 8)) return false;
+
+        uint64_t boxSize = ReadBE32(header);
+        uint64_t headerSize = 8;
+        if (boxSize == 1) {
+            if (!file.ReadAt(offset + 8, header + 8, 8)) return false;
+            boxSize = ReadBE64(header + 8);
+            headerSize = 16;
+        } else if (boxSize == 0) {
+            boxSize = file.size - offset;
+        }
+        if (boxSize < headerSize || boxSize > file.size - offset) return false;
+
+        if (FourCCEquals(header + 4, "ftyp")) {
+            uint8_t brand[4];
+            if (file.ReadAt(offset + headerSize, brand, 4)) {
+                result.container = FourCCEquals(brand, "qt  ")
+                    ? ContainerProbe::Container::MOV : ContainerProbe::Container::MP4;
+            }
+            sawFtyp = true;
+        } else if (FourCCEquals(header + 4, "moov")) {
+            std::vector<uint8_t> moov;
+            if (!file.ReadBlock(offset + headerSize, boxSize - headerSize, moov)) return false;
+            if (!sawFtyp) result.container = ContainerProbe::Container::MOV;
+
+            uint32_t movieTimescale = 0;
+            uint64_t movieDuration = 0;
+            bool foundVideo = false;
+
+            const uint8_t* cursor = moov.data();
+            const uint8_t* end = moov.data() + moov.size();
+            Mp4Box box;
+            while (NextMp4Box(cursor, end, box)) {
+                if (FourCCEquals(box.type, "mvhd") && box.size >= 20) {
+                    if (box.data[0] == 1 && box.size >= 32) {
+                        movieTimescale = ReadBE32(box.data + 20);
+                        movieDuration = ReadBE64(box.data + 24);
+                    } else {
+                        movieTimescale = ReadBE32(box.data + 12);
+                        movieDuration = ReadBE32(box.data + 16);
+                    }
+                } else if (FourCCEquals(box.type, "trak") && !foundVideo) {
+                    foundVideo = ParseMp4VideoTrack(box, result);
+                }
+            }
+            if (result.duration <= 0.0 && movieTimescale) {
+                result.duration = static_cast<double>(movieDuration) / movieTimescale;
+            }
+            return foundVideo;
+        } else if (!sawFtyp && !FourCCEquals(header + 4, "wide") && !FourCCEquals(header + 4, "free") &&
+                   !FourCCEquals(header + 4, "skip") && !FourCCEquals(header + 4, "mdat")) {
+            // İlk kutu tanınmıyorsa bu bir ISO BMFF dosyası değildir
+            return false;
+        }
+        offset += boxSize;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// Matroska / WebM (EBML)
+// ---------------------------------------------------------------------------
+
+static const uint32_t EBML_ID_HEADER = 0x1A45DFA3;
+static const uint32_t EBML_ID_DOCTYPE = 0x4282;
+static const uint32_t MKV_ID_SEGMENT = 0x18538067;
+static const uint32_t MKV_ID_SEEKHEAD = 0x114D9B74;
+static const uint32_t MKV_ID_SEEK = 0x4DBB;
+static const uint32_t MKV_ID_SEEKID = 0x53AB;
+static const uint32_t MKV_ID_SEEKPOSITION = 0x53AC;
+static const uint32_t MKV_ID_INFO = 0x1549A966;
+static const uint32_t MKV_ID_TIMECODESCALE = 0x2AD7B1;
+static const uint32_t MKV_ID_DURATION = 0x4489;
+static const uint32_t MKV_ID_TRACKS = 0x1654AE6B;
+static const uint32_t MKV_ID_TRACKENTRY = 0xAE;
+static const uint32_t MKV_ID_TRACKNUMBER = 0xD7;
+static const uint32_t MKV_ID_TRACKTYPE = 0x83;
+static const uint32_t MKV_ID_CODECID = 0x86;
+static const uint32_t MKV_ID_DEFAULTDURATION = 0x23E383;
+static const uint32_t MKV_ID_VIDEO = 0xE0;
+static const uint32_t MKV_ID_PIXELWIDTH = 0xB0;
+static const uint32_t MKV_ID_PIXELHEIGHT = 0xBA;
+static const uint32_t MKV_ID_COLOUR = 0x55B0;
+static const uint32_t MKV_ID_MATRIX = 0x55B1;
+static const uint32_t MKV_ID_BITSPERCHANNEL = 0x55B2;
+static const uint32_t MKV_ID_PRIMARIES = 0x55BB;
+static const uint32_t MKV_ID_CUES = 0x1C53BB6B;
+static const uint32_t MKV_ID_CUEPOINT = 0xBB;
+static const uint32_t MKV_ID_CUETRACKPOSITIONS = 0xB7;
+static const uint32_t MKV_ID_CUETRACK = 0xF7;
+static const uint32_t MKV_ID_CLUSTER = 0x1F43B675;
+
+static const uint64_t EBML_UNKNOWN_SIZE = ~0ULL;
+
+// EBML değişken uzunluklu tamsayı; ID'lerde işaret biti korunur
+static bool ReadEbmlVint(const uint8_t*& cursor, const uint8_t* end, uint64_t& value, bool keepMarker) {
+    if (cursor >= end) return false;
+    const uint8_t first = *cursor;
+    int length = 1;
+    while (length <= 8 && !(first & (0x80 >> (length - 1)))) ++length;
+    if (length > 8 || end - cursor < length) return false;
+
+    value = keepMarker ? first : (first & (0xFF >> length));
+    bool allOnes = (value == static_cast<uint64_t>(0xFF >> length));
+    for (int i = 1; i < length; ++i) {
+        value = (value << 8) | cursor[i];
+        allOnes = allOnes && cursor[i] == 0xFF;
+    }
+    if (!keepMarker && allOnes) value = EBML_UNKNOWN_SIZE;
+    cursor += length;
+    return true;
+}
+
+struct EbmlElement {
+    uint32_t id;
+    const uint8_t* data;
+    size_t size;
+};
+
+static bool NextEbmlElement(const uint8_t*& cursor, const uint8_t* end, EbmlElement& element) {
+    uint64_t id = 0, size = 0;
+    if (!ReadEbmlVint(cursor, end, id, true)) return false;
+    if (!ReadEbmlVint(cursor, end, size, false)) return false;
+    if (size == EBML_UNKNOWN_SIZE || size > static_cast<uint64_t>(end - cursor)) return false;
+    element.id = static_cast<uint32_t>(id);
+    element.data = cursor;
+    element.size = static_cast<size_t>(size);
+    cursor += size;
+    return true;
+}
+
+static uint64_t EbmlUInt(const EbmlElement& element) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < element.size && i < 8; ++i) value = (value << 8) | element.data[i];
+    return value;
+}
+
+static double EbmlFloat(const EbmlElement& element) {
+    if (element.size == 4) {
+        uint32_t bits = ReadBE32(element.data);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    if (element.size == 8) {
+        uint64_t bits = ReadBE64(element.data);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    return 0.0;
+}
+
+static std::string CodecFromMatroskaId(const std::string& codecId) {
+    if (codecId == "V_MPEG4/ISO/AVC") return "H.264";
+    if (codecId == "V_MPEGH/ISO/HEVC") return "HEVC";
+    if (codecId == "V_AV1") return "AV1";
+    if (codecId == "V_VP9") return "VP9";
+    if (codecId == "V_VP8") return "VP8";
+    if (codecId.rfind("V_MPEG4/ISO/", 0) == 0) return "MPEG-4 Part 2";
+    if (codecId == "V_MJPEG") return "MJPEG";
+    if (codecId == "V_PRORES") return "ProRes";
+    return codecId;
+}
+
+struct MatroskaState {
+    uint64_t timecodeScale = 1000000;
+    double rawDuration = 0.0;
+    uint64_t videoTrackNumber = 0;
+    uint64_t cuesPosition = 0;      // Segment verisine göre
+    bool cuesParsed = false;
+    bool tracksParsed = false;
+};
+
+static void ParseMatroskaTracks(const uint8_t* data, size_t size, MatroskaState& state,
+                                ContainerProbe::Result& result) {
+    const uint8_t* cursor = data;
+    EbmlElement entry;
+    while (NextEbmlElement(cursor, data + size, entry)) {
+        if (entry.id != MKV_ID_TRACKENTRY) continue;
+
+        uint64_t trackNumber = 0, trackType = 0, defaultDuration = 0;
+        std::string codecId;
+        int width = 0, height = 0, bitDepth = 0, matrix = -1, primaries = -1;
+
+        const uint8_t* fieldCursor = entry.data;
+        EbmlElement field;
+        while (NextEbmlElement(fieldCursor, entry.data + entry.size, field)) {
+            switch (field.id) {
+                case MKV_ID_TRACKNUMBER: trackNumber = EbmlUInt(field); break;
+                case MKV_ID_TRACKTYPE: trackType = EbmlUInt(field); break;
+                case MKV_ID_CODECID: codecId.assign(reinterpret_cast<const char*>(field.data), field.size); break;
+                case MKV_ID_DEFAULTDURATION: defaultDuration = EbmlUInt(field); break;
+                case MKV_ID_VIDEO: {
+                    const uint8_t* videoCursor = field.data;
+                    EbmlElement video;
+                    while (NextEbmlElement(videoCursor, field.data + field.size, video)) {
+                        if (video.id == MKV_ID_PIXELWIDTH) width = static_cast<int>(EbmlUInt(video));
+                        else if (video.id == MKV_ID_PIXELHEIGHT) height = static_cast<int>(EbmlUInt(video));
+                        else if (video.id == MKV_ID_COLOUR) {
+                            const uint8_t* colourCursor = video.data;
+                            EbmlElement colour;
+                            while (NextEbmlElement(colourCursor, video.data + video.size, colour)) {
+                                if (colour.id == MKV_ID_BITSPERCHANNEL) bitDepth = static_cast<int>(EbmlUInt(colour));
+                                else if (colour.id == MKV_ID_MATRIX) matrix = static_cast<int>(EbmlUInt(colour));
+                                else if (colour.id == MKV_ID_PRIMARIES) primaries = static_cast<int>(EbmlUInt(colour));
+                            }
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+
+        // İlk video izi (TrackType 1) esas alınır
+        if (trackType == 1 && state.videoTrackNumber == 0) {
+            state.videoTrackNumber = trackNumber;
+            result.codec = CodecFromMatroskaId(codecId);
+            result.width = width;
+            result.height = height;
+            result.bitDepth = bitDepth;
+            if (defaultDuration) result.fps = 1e9 / static_cast<double>(defaultDuration);
+            if (matrix >= 0 || primaries >= 0) result.colorSpace = ColorSpaceFromCodes(matrix, primaries);
+        }
+    }
+    state.tracksParsed = true;
+}
+
+// Cues genellikle video izinin her anahtar karesi için bir CuePoint içerir
+static void ParseMatroskaCues(const uint8_t* data, size_t size, MatroskaState& state,
+                              ContainerProbe::Result& result) {
+    uint64_t keyframes = 0;
+    const uint8_t* cursor = data;
+    EbmlElement point;
+    while (NextEbmlElement(cursor, data + size, point)) {
+        if (point.id != MKV_ID_CUEPOINT) continue;
+        const uint8_t* pointCursor = point.data;
+        EbmlElement child;
+        bool matches = false;
+        while (!matches && NextEbmlElement(pointCursor, point.data + point.size, child)) {
+            if (child.id != MKV_ID_CUETRACKPOSITIONS) continue;
+            const uint8_t* posCursor = child.data;
+            EbmlElement pos;
+            while (NextEbmlElement(posCursor, child.data + child.size, pos)) {
+                if (pos.id == MKV_ID_CUETRACK &&
+                    (state.videoTrackNumber == 0 || EbmlUInt(pos) == state.videoTrackNumber)) {
+                    matches = true;
+                    break;
+                }
+            }
+        }
+        if (matches) ++keyframes;
+    }
+    result.keyframeCount = keyframes;
+    state.cuesParsed = true;
+}
+
+static void ParseMatroskaSeekHead(const uint8_t* data, size_t size, MatroskaState& state) {
+    const uint8_t* cursor = data;
+    EbmlElement seek;
+    while (NextEbmlElement(cursor, data + size, seek)) {
+        if (seek.id != MKV_ID_SEEK) continue;
+        uint64_t id = 0, position = 0;
+        const uint8_t* seekCursor = seek.data;
+        EbmlElement field;
+        while (NextEbmlElement(seekCursor, seek.data + seek.size, field)) {
+            if (field.id == MKV_ID_SEEKID) id = EbmlUInt(field);
+            else if (field.id == MKV_ID_SEEKPOSITION) position = EbmlUInt(field);
+        }
+        if (id == MKV_ID_CUES) state.cuesPosition = position;
+    }
+}
+
+// Dosyadaki bir elemanın başlığını oku (ID + boyut)
+static bool ReadEbmlHeaderAt(ProbeFile& file, uint64_t offset, uint32_t& id, uint64_t& size, uint64_t& dataOffset) {
+    uint8_t buffer[16];
+    const size_t available = static_cast<size_t>(std::min<uint64_t>(sizeof(buffer), file.size - offset));
+    if (offset >= file.size || !file.ReadAt(offset, buffer, available)) return false;
+    const uint8_t* cursor = buffer;
+    uint64_t rawId = 0;
+    if (!ReadEbmlVint(cursor, buffer + available, rawId, true)) return false;
+    if (!ReadEbmlVint(cursor, buffer + available, size, false)) return false;
+    id = static_cast<uint32_t>(rawId);
+    dataOffset = offset + (cursor - buffer);
+    return true;
+}
+
+static bool ProbeMatroska(ProbeFile& file, ContainerProbe::Result& result) {
+    uint32_t id = 0;
+    uint64_t size = 0, dataOffset = 0;
+    if (!ReadEbmlHeaderAt(file, 0, id, size, dataOffset) || id != EBML_ID_HEADER || size > 4096) return false;
+
+    std::vector<uint8_t> header;
+    if (!file.ReadBlock(dataOffset, size, header)) return false;
+    const uint8_t* cursor = header.data();
+    EbmlElement element;
+    result.container = ContainerProbe::Container::Matroska;
+    while (NextEbmlElement(cursor, header.data() + header.size(), element)) {
+        if (element.id == EBML_ID_DOCTYPE) {
+            std::string docType(reinterpret_cast<const char*>(element.data), element.size);
+            if (docType == "webm") result.container = ContainerProbe::Container::WebM;
+            else if (docType != "matroska") return false;
+        }
+    }
+
+    const uint64_t segmentOffset = dataOffset + size;
+    if (!ReadEbmlHeaderAt(file, segmentOffset, id, size, dataOffset) || id != MKV_ID_SEGMENT) return false;
+    const uint64_t segmentStart = dataOffset;
+    const uint64_t segmentEnd = (size == EBML_UNKNOWN_SIZE) ? file.size : std::min(file.size, segmentStart + size);
+
+    MatroskaState state;
+    std::vector<uint8_t> payload;
+    uint64_t offset = segmentStart;
+    for (int i = 0; i < ContainerProbe::MAX_TOP_LEVEL_ITEMS && offset < segmentEnd; ++i) {
+        if (!ReadEbmlHeaderAt(file, offset, id, size, dataOffset)) break;
+        if (id == MKV_ID_CLUSTER || size == EBML_UNKNOWN_SIZE) break;   // Medya verisi başladı
+
+        if (id == MKV_ID_INFO || id == MKV_ID_TRACKS || id == MKV_ID_SEEKHEAD || id == MKV_ID_CUES) {
+            if (!file.ReadBlock(dataOffset, size, payload)) break;
+            if (id == MKV_ID_INFO) {
+                const uint8_t* infoCursor = payload.data();
+                EbmlElement field;
+                while (NextEbmlElement(infoCursor, payload.data() + payload.size(), field)) {
+                    if (field.id == MKV_ID_TIMECODESCALE) state.timecodeScale = EbmlUInt(field);
+                    else if (field.id == MKV_ID_DURATION) state.rawDuration = EbmlFloat(field);
+                }
+            } else if (id == MKV_ID_TRACKS) {
+                ParseMatroskaTracks(payload.data(), payload.size(), state, result);
+            } else if (id == MKV_ID_SEEKHEAD) {
+                ParseMatroskaSeekHead(payload.data(), payload.size(), state);
+            } else {
+                ParseMatroskaCues(payload.data(), payload.size(), state, result);
+            }
+        }
+        offset = dataOffset + size;
+    }
+
+    // Cues genellikle dosya sonundadır; SeekHead ile doğrudan oraya atla
+    if (!state.cuesParsed && state.cuesPosition &&
+        ReadEbmlHeaderAt(file, segmentStart + state.cuesPosition, id, size, dataOffset) &&
+        id == MKV_ID_CUES && file.ReadBlock(dataOffset, size, payload)) {
+        ParseMatroskaCues(payload.data(), payload.size(), state, result);
+    }
+
+    result.duration = state.rawDuration * static_cast<double>(state.timecodeScale) / 1e9;
+    if (result.fps > 0.0 && result.duration > 0.0) {
+        result.frameCount = static_cast<uint64_t>(result.duration * result.fps + 0.5);
+    }
+    return state.tracksParsed && state.videoTrackNumber != 0;
+}
+
+// ---------------------------------------------------------------------------
+// AVI (RIFF)
+// ---------------------------------------------------------------------------
+
+static const uint32_t AVIIF_KEYFRAME = 0x10;
+
+static std::string CodecFromAviFourCC(uint32_t compression) {
+    if (compression == 0) return "RGB";
+    char fourcc[5] = {
+        static_cast<char>(compression & 0xFF), static_cast<char>((compression >> 8) & 0xFF),
+        static_cast<char>((compression >> 16) & 0xFF), static_cast<char>((compression >> 24) & 0xFF), 0
+    };
+    std::string upper(fourcc);
+    std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+
+    if (upper == "H264" || upper == "X264" || upper == "AVC1") return "H.264";
+    if (upper == "HEVC" || upper == "H265" || upper == "HEV1" || upper == "HVC1") return "HEVC";
+    if (upper == "XVID" || upper == "DIVX" || upper == "DX50" || upper == "FMP4" || upper == "MP4V") return "MPEG-4 Part 2";
+    if (upper == "MJPG") return "MJPEG";
+    if (upper == "VP80") return "VP8";
+    if (upper == "VP90") return "VP9";
+    if (upper == "AV01") return "AV1";
+    return fourcc;
+}
+
+static bool ProbeAvi(ProbeFile& file, ContainerProbe::Result& result) {
+    uint8_t riff[12];
+    if (!file.ReadAt(0, riff, sizeof(riff)) || !FourCCEquals(riff, "RIFF") || !FourCCEquals(riff + 8, "AVI ")) {
+        return false;
+    }
+    result.container = ContainerProbe::Container::AVI;
+
+    const uint64_t riffEnd = std::min<uint64_t>(file.size, 8ULL + ReadLE32(riff + 4));
+    uint64_t offset = 12;
+    int videoStreamIndex = -1;
+    bool foundVideo = false;
+
+    for (int i = 0; i < ContainerProbe::MAX_TOP_LEVEL_ITEMS && offset + 8 <= riffEnd; ++i) {
+        uint8_t chunk[12];
+        if (!file.ReadAt(offset, chunk, 8)) break;
+        const uint64_t chunkSize = ReadLE32(chunk + 4);
+        const uint64_t next = offset + 8 + chunkSize + (chunkSize & 1);
+
+        if (FourCCEquals(chunk, "LIST") && file.ReadAt(offset + 8, chunk + 8, 4)) {
+            if (FourCCEquals(chunk + 8, "hdrl")) {
+                std::vector<uint8_t> hdrl;
+                if (!file.ReadBlock(offset + 12, chunkSize - 4, hdrl)) return false;
+
+                uint32_t microSecPerFrame = 0, totalFrames = 0;
+                int streamIndex = 0;
+                size_t pos = 0;
+                while (pos + 8 <= hdrl.size()) {
+                    const uint8_t* sub = hdrl.data() + pos;
+                    const uint32_t subSize = ReadLE32(sub + 4);
+                    if (pos + 8 + subSize > hdrl.size()) break;
+
+                    if (FourCCEquals(sub, "avih") && subSize >= 40) {
+                        microSecPerFrame = ReadLE32(sub + 8);
+                        totalFrames = ReadLE32(sub + 8 + 16);
+                        result.width = static_cast<int>(ReadLE32(sub + 8 + 32));
+                        result.height = static_cast<int>(ReadLE32(sub + 8 + 36));
+                    } else if (FourCCEquals(sub, "LIST") && subSize >= 4 && FourCCEquals(sub + 8, "strl")) {
+                        // strl: strh + strf
+                        const uint8_t* strh = nullptr;
+                        const uint8_t* strf = nullptr;
+                        uint32_t strhSize = 0, strfSize = 0;
+                        size_t strlPos = 12;
+                        while (strlPos + 8 <= 8 + subSize) {
+                            const uint8_t* item = sub + strlPos;
+                            const uint32_t itemSize = ReadLE32(item + 4);
+                            if (strlPos + 8 + itemSize > 8 + subSize) break;
+                            if (FourCCEquals(item, "strh")) { strh = item + 8; strhSize = itemSize; }
+                            else if (FourCCEquals(item, "strf")) { strf = item + 8; strfSize = itemSize; }
+                            strlPos += 8 + itemSize + (itemSize & 1);
+                        }
+                        if (!foundVideo && strh && strhSize >= 36 && FourCCEquals(strh, "vids")) {
+                            const uint32_t scale = ReadLE32(strh + 20);
+                            const uint32_t rate = ReadLE32(strh + 24);
+                            if (scale) result.fps = static_cast<double>(rate) / scale;
+                            result.frameCount = ReadLE32(strh + 32);
+                            if (strf && strfSize >= 20) {
+                                result.width = static_cast<int>(ReadLE32(strf + 4));
+                                result.height = std::abs(static_cast<int>(ReadLE32(strf + 8)));
+                                const uint16_t bitCount = ReadLE16(strf + 14);
+                                const uint32_t compression = ReadLE32(strf + 16);
+                                result.codec = CodecFromAviFourCC(compression);
+                                if (compression == 0 && bitCount >= 24) result.bitDepth = 8;
+                            }
+                            videoStreamIndex = streamIndex;
+                            foundVideo = true;
+                        }
+                        ++streamIndex;
+                    }
+                    pos += 8 + subSize + (subSize & 1);
+                }
+
+                if (result.fps <= 0.0 && microSecPerFrame) result.fps = 1e6 / microSecPerFrame;
+                if (result.frameCount == 0) result.frameCount = totalFrames;
+                if (result.fps > 0.0) result.duration = result.frameCount / result.fps;
+            }
+        } else if (FourCCEquals(chunk, "idx1") && foundVideo) {
+            // Index'i sabit boyutlu parçalar halinde oku ve video anahtar karelerini say
+            const char streamDigits[3] = {
+                static_cast<char>('0' + (videoStreamIndex / 10) % 10),
+                static_cast<char>('0' + videoStreamIndex % 10), 0
+            };
+            const uint64_t indexSize = std::min<uint64_t>(chunkSize, ContainerProbe::MAX_INDEX_READ);
+            std::vector<uint8_t> block(64 * 1024);
+            uint64_t keyframes = 0;
+            for (uint64_t read = 0; read + 16 <= indexSize;) {
+                const size_t count = static_cast<size_t>(std::min<uint64_t>(block.size(), (indexSize - read) / 16 * 16));
+                if (!file.ReadAt(offset + 8 + read, block.data(), count)) break;
+                for (size_t e = 0; e + 16 <= count; e += 16) {
+                    const uint8_t* entry = block.data() + e;
+                    if (entry[0] == streamDigits[0] && entry[1] == streamDigits[1] &&
+                        (entry[2] == 'd') && (ReadLE32(entry + 4) & AVIIF_KEYFRAME)) {
+                        ++keyframes;
+                    }
+                }
+                read += count;
+            }
+            result.keyframeCount = keyframes;
+            break;
+        }
+        offset = next;
+    }
+
+    return foundVideo;
+}
+
+// ---------------------------------------------------------------------------
+
+bool ContainerProbe::Probe(const std::filesystem::path& filePath, Result& result) {
+    result = Result();
+
+    ProbeFile file(filePath);
+    if (!file.file || file.size < 12) return false;
+
+    uint8_t magic[12];
+    if (!file.ReadAt(0, magic, sizeof(magic))) return false;
+
+    bool success = false;
+    if (ReadBE32(magic) == EBML_ID_HEADER) {
+        success = ProbeMatroska(file, result);
+    } else if (FourCCEquals(magic, "RIFF")) {
+        success = ProbeAvi(file, result);
+    } else {
+        success = ProbeMp4(file, result);
+    }
+
+    if (!success) {
+        result = Result();
+        return false;
+    }
+
+    FinalizeResult(result);
+    return true;
+}
+
+const char* ContainerProbe::ContainerName(Container container) {
+    switch (container) {
+        case Container::MP4:      return "MP4";
+        case Container::MOV:      return "MOV";
+        case Container::Matroska: return "Matroska";
+        case Container::WebM:     return "WebM";
+        case Container::AVI:      return "AVI";
+        default:                  return "Unknown";
+    }
+}
+
+bool ContainerProbe::IsProbeableExtension(const std::filesystem::path& filePath) {
+    std::wstring extension = filePath.extension().wstring();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::towlower);
+
+    return (extension == L".mp4" || extension == L".m4v" || extension == L".mov" ||
+            extension == L".mkv" || extension == L".webm" || extension == L".avi");
+}
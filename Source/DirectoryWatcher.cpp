@@ -0,0 +1,385 @@
+// Source/DirectoryWatcher.cpp
+#include "../Headers/DirectoryWatcher.h"
+
+#include <algorithm>
+#include <cerrno>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+static std::string ChangeKey(const std::filesystem::path& path) {
+    return path.lexically_normal().generic_string();
+}
+
+// ---------------------------------------------------------------------------
+// Coalescer
+// ---------------------------------------------------------------------------
+
+void DirectoryWatcher::Coalescer::Put(const Change& change) {
+    auto& slot = pending[ChangeKey(change.path)];
+    slot.sequence = nextSequence++;
+    slot.change = change;
+}
+
+void DirectoryWatcher::Coalescer::Add(ChangeType type, const std::filesystem::path& path,
+                                      const std::filesystem::path& oldPath) {
+    const std::string key = ChangeKey(path);
+    auto existing = pending.find(key);
+
+    switch (type) {
+        case ChangeType::Added:
+            if (existing == pending.end()) {
+                Put({ ChangeType::Added, path, {} });
+            } else if (existing->second.change.type == ChangeType::Removed) {
+                // Sil + yeniden oluştur = içerik değişti
+                existing->second.change = { ChangeType::Modified, path, {} };
+            }
+            break;
+
+        case ChangeType::Modified:
+            if (existing == pending.end()) {
+                Put({ ChangeType::Modified, path, {} });
+            } else if (existing->second.change.type == ChangeType::Removed) {
+                existing->second.change = { ChangeType::Modified, path, {} };
+            }
+            // Added / Renamed / Modified zaten yeniden okunmayı gerektirir
+            break;
+
+        case ChangeType::Removed:
+            if (existing == pending.end()) {
+                Put({ ChangeType::Removed, path, {} });
+            } else if (existing->second.change.type == ChangeType::Added) {
+                pending.erase(existing);          // Geçici dosya; hiç görünmedi say
+            } else if (existing->second.change.type == ChangeType::Renamed) {
+                const std::filesystem::path original = existing->second.change.oldPath;
+                pending.erase(existing);
+                Put({ ChangeType::Removed, original, {} });
+            } else {
+                existing->second.change = { ChangeType::Removed, path, {} };
+            }
+            break;
+
+        case ChangeType::Renamed: {
+            auto source = pending.find(ChangeKey(oldPath));
+            if (source == pending.end()) {
+                Put({ ChangeType::Renamed, path, oldPath });
+                break;
+            }
+
+            const Change previous = source->second.change;
+            pending.erase(source);
+            if (previous.type == ChangeType::Added) {
+                Put({ ChangeType::Added, path, {} });
+            } else if (previous.type == ChangeType::Renamed) {
+                if (ChangeKey(previous.oldPath) == key) {
+                    Put({ ChangeType::Modified, path, {} });   // A->B->A
+                } else {
+                    Put({ ChangeType::Renamed, path, previous.oldPath });
+                }
+            } else {
+                Put({ ChangeType::Renamed, path, oldPath });
+            }
+            break;
+        }
+    }
+}
+
+std::vector<DirectoryWatcher::Change> DirectoryWatcher::Coalescer::Take() {
+    std::vector<std::pair<uint64_t, Change>> ordered;
+    ordered.reserve(pending.size());
+    for (auto& pair : pending) {
+        ordered.emplace_back(pair.second.sequence, std::move(pair.second.change));
+    }
+    pending.clear();
+
+    std::sort(ordered.begin(), ordered.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<Change> changes;
+    changes.reserve(ordered.size());
+    for (auto& pair : ordered) {
+        changes.push_back(std::move(pair.second));
+    }
+    return changes;
+}
+
+// ---------------------------------------------------------------------------
+// Platform durumu
+// ---------------------------------------------------------------------------
+
+#ifdef _WIN32
+struct DirectoryWatcher::PlatformState {
+    HANDLE directoryHandle = INVALID_HANDLE_VALUE;
+    HANDLE stopEvent = nullptr;
+    HANDLE ioEvent = nullptr;
+    OVERLAPPED overlapped = {};
+    alignas(DWORD) BYTE buffer[64 * 1024];
+
+    ~PlatformState() {
+        if (directoryHandle != INVALID_HANDLE_VALUE) CloseHandle(directoryHandle);
+        if (stopEvent) CloseHandle(stopEvent);
+        if (ioEvent) CloseHandle(ioEvent);
+    }
+
+    bool IssueRead() {
+        ResetEvent(ioEvent);
+        overlapped = {};
+        overlapped.hEvent = ioEvent;
+        return ReadDirectoryChangesW(directoryHandle, buffer, sizeof(buffer), FALSE,
+                                     FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE |
+                                     FILE_NOTIFY_CHANGE_SIZE,
+                                     nullptr, &overlapped, nullptr) != FALSE;
+    }
+};
+#else
+struct DirectoryWatcher::PlatformState {
+    int inotifyFd = -1;
+    int stopFd = -1;
+    int watchDescriptor = -1;
+
+    ~PlatformState() {
+        if (inotifyFd >= 0) close(inotifyFd);
+        if (stopFd >= 0) close(stopFd);
+    }
+};
+#endif
+
+DirectoryWatcher::DirectoryWatcher()
+    : debounce(DEFAULT_DEBOUNCE_MS)
+    , isRunning(false)
+    , shouldStop(false) {
+}
+
+DirectoryWatcher::~DirectoryWatcher() {
+    Stop();
+}
+
+bool DirectoryWatcher::Start(const std::filesystem::path& watchDirectory, ChangeCallback changeCallback,
+                             std::chrono::milliseconds debounceInterval) {
+    Stop();
+
+    directory = watchDirectory;
+    callback = std::move(changeCallback);
+    debounce = debounceInterval;
+    platform = std::make_unique<PlatformState>();
+
+#ifdef _WIN32
+    platform->directoryHandle = CreateFileW(directory.c_str(), FILE_LIST_DIRECTORY,
+                                            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                            nullptr, OPEN_EXISTING,
+                                            FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    platform->stopEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    platform->ioEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    if (platform->directoryHandle == INVALID_HANDLE_VALUE || !platform->stopEvent ||
+        !platform->ioEvent || !platform->IssueRead()) {
+        platform.reset();
+        return false;
+    }
+#else
+    platform->inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    platform->stopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (platform->inotifyFd < 0 || platform->stopFd < 0) {
+        platform.reset();
+        return false;
+    }
+    // IN_MODIFY yerine IN_CLOSE_WRITE: yazma sırasında olay yağmuru oluşmaz
+    platform->watchDescriptor = inotify_add_watch(platform->inotifyFd, directory.c_str(),
+                                                  IN_CREATE | IN_CLOSE_WRITE | IN_DELETE |
+                                                  IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF);
+    if (platform->watchDescriptor < 0) {
+        platform.reset();
+        return false;
+    }
+#endif
+
+    shouldStop = false;
+    isRunning = true;
+    watchThread = std::make_unique<std::thread>(&DirectoryWatcher::WatchLoop, this);
+    return true;
+}
+
+void DirectoryWatcher::Stop() {
+    if (!watchThread) return;
+
+    shouldStop = true;
+#ifdef _WIN32
+    SetEvent(platform->stopEvent);
+#else
+    const uint64_t one = 1;
+    ssize_t written = write(platform->stopFd, &one, sizeof(one));
+    (void)written;
+#endif
+
+    if (watchThread->joinable()) {
+        watchThread->join();
+    }
+    watchThread.reset();
+
+#ifdef _WIN32
+    // Buffer serbest bırakılmadan önce bekleyen okuma tamamlanmalı
+    DWORD bytes = 0;
+    if (CancelIoEx(platform->directoryHandle, &platform->overlapped) || GetLastError() != ERROR_NOT_FOUND) {
+        GetOverlappedResult(platform->directoryHandle, &platform->overlapped, &bytes, TRUE);
+    }
+#endif
+    platform.reset();
+    isRunning = false;
+}
+
+void DirectoryWatcher::WatchLoop() {
+    using Clock = std::chrono::steady_clock;
+
+    Coalescer coalescer;
+    Clock::time_point firstEvent, lastEvent;
+
+#ifndef _WIN32
+    // Eşleşmemiş IN_MOVED_FROM olayları (cookie -> eski yol)
+    std::unordered_map<uint32_t, std::filesystem::path> movedFrom;
+    alignas(struct inotify_event) char buffer[16 * 1024];
+#endif
+
+    while (!shouldStop) {
+        bool hasPending = !coalescer.Empty();
+#ifndef _WIN32
+        hasPending = hasPending || !movedFrom.empty();
+#endif
+
+        // Bekleyen olay yoksa süresiz bekle: boşta hiç uyanma olmaz
+        int timeoutMs = -1;
+        if (hasPending) {
+            const auto deadline = std::min(lastEvent + debounce, firstEvent + std::chrono::milliseconds(MAX_LATENCY_MS));
+            timeoutMs = static_cast<int>(std::max<int64_t>(0,
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count()));
+        }
+
+        bool gotEvents = false;
+        bool lost = false;      // İzlenen klasör artık izlenemiyor
+
+#ifdef _WIN32
+        HANDLE handles[2] = { platform->stopEvent, platform->ioEvent };
+        DWORD wait = WaitForMultipleObjects(2, handles, FALSE, timeoutMs < 0 ? INFINITE : static_cast<DWORD>(timeoutMs));
+        if (wait == WAIT_OBJECT_0) break;
+        if (wait == WAIT_FAILED) lost = true;
+        if (wait == WAIT_OBJECT_0 + 1) {
+            DWORD bytes = 0;
+            const bool completed = GetOverlappedResult(platform->directoryHandle, &platform->overlapped, &bytes, FALSE) != FALSE;
+            if (completed && bytes > 0) {
+                std::filesystem::path renamedFrom;
+                const BYTE* cursor = platform->buffer;
+                for (;;) {
+                    const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(cursor);
+                    const std::filesystem::path path =
+                        directory / std::wstring(info->FileName, info->FileNameLength / sizeof(WCHAR));
+                    switch (info->Action) {
+                        case FILE_ACTION_ADDED:            coalescer.Add(ChangeType::Added, path); break;
+                        case FILE_ACTION_REMOVED:          coalescer.Add(ChangeType::Removed, path); break;
+                        case FILE_ACTION_MODIFIED:         coalescer.Add(ChangeType::Modified, path); break;
+                        case FILE_ACTION_RENAMED_OLD_NAME: renamedFrom = path; break;
+                        case FILE_ACTION_RENAMED_NEW_NAME:
+                            if (renamedFrom.empty()) coalescer.Add(ChangeType::Added, path);
+                            else coalescer.Add(ChangeType::Renamed, path, renamedFrom);
+                            renamedFrom.clear();
+                            break;
+                    }
+                    gotEvents = true;
+                    if (info->NextEntryOffset == 0) break;
+                    cursor += info->NextEntryOffset;
+                }
+            } else if (completed) {
+                // Buffer taştı; olaylar kayboldu. Tüm klasörü "değişti" say.
+                coalescer.Add(ChangeType::Modified, directory);
+                gotEvents = true;
+            } else {
+                // Klasör silindi veya sürücü çıkarıldı (ERROR_ACCESS_DENIED vb.)
+                lost = true;
+            }
+            if (!lost && !platform->IssueRead()) lost = true;
+        }
+#else
+        pollfd fds[2] = {
+            { platform->stopFd, POLLIN, 0 },
+            { platform->inotifyFd, POLLIN, 0 },
+        };
+        const int ready = poll(fds, 2, timeoutMs);
+        if (ready < 0 && errno != EINTR) break;
+        if (fds[0].revents & POLLIN) break;
+
+        if (ready > 0 && (fds[1].revents & (POLLERR | POLLHUP))) lost = true;
+        if (ready > 0 && (fds[1].revents & POLLIN)) {
+            for (;;) {
+                const ssize_t length = read(platform->inotifyFd, buffer, sizeof(buffer));
+                if (length <= 0) break;
+
+                for (char* cursor = buffer; cursor < buffer + length;) {
+                    const auto* event = reinterpret_cast<const struct inotify_event*>(cursor);
+                    cursor += sizeof(struct inotify_event) + event->len;
+                    gotEvents = true;
+
+                    if (event->mask & IN_Q_OVERFLOW) {
+                        coalescer.Add(ChangeType::Modified, directory);
+                        continue;
+                    }
+                    // Klasörün kendisi silindi, taşındı ya da bağlantısı kesildi:
+                    // isimsiz olay, len == 0 filtresinden önce yakalanmalı
+                    if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_UNMOUNT | IN_IGNORED)) {
+                        lost = true;
+                        continue;
+                    }
+                    if ((event->mask & IN_ISDIR) || event->len == 0) continue;
+
+                    const std::filesystem::path path = directory / event->name;
+                    if (event->mask & IN_CREATE) coalescer.Add(ChangeType::Added, path);
+                    if (event->mask & IN_CLOSE_WRITE) coalescer.Add(ChangeType::Modified, path);
+                    if (event->mask & IN_DELETE) coalescer.Add(ChangeType::Removed, path);
+                    if (event->mask & IN_MOVED_FROM) movedFrom[event->cookie] = path;
+                    if (event->mask & IN_MOVED_TO) {
+                        auto source = movedFrom.find(event->cookie);
+                        if (source != movedFrom.end()) {
+                            coalescer.Add(ChangeType::Renamed, path, source->second);
+                            movedFrom.erase(source);
+                        } else {
+                            coalescer.Add(ChangeType::Added, path);   // Başka klasörden taşındı
+                        }
+                    }
+                }
+            }
+        }
+#endif
+
+        const auto now = Clock::now();
+        if (gotEvents) {
+            if (!hasPending) firstEvent = now;
+            lastEvent = now;
+        }
+        if (lost) coalescer.Add(ChangeType::Removed, directory);
+
+        // Sessizlik süresi dolduysa (veya maksimum gecikmeye ulaşıldıysa) bildir;
+        // izleme bittiyse bekleyenler hemen verilir
+        const bool quiet = lost || now - lastEvent >= debounce;
+        const bool overdue = now - firstEvent >= std::chrono::milliseconds(MAX_LATENCY_MS);
+#ifndef _WIN32
+        if ((quiet || overdue) && !movedFrom.empty()) {
+            // Eşi gelmeyen taşımalar klasörden çıkarılmış dosyalardır
+            for (const auto& pair : movedFrom) {
+                coalescer.Add(ChangeType::Removed, pair.second);
+            }
+            movedFrom.clear();
+        }
+#endif
+        if (!coalescer.Empty() && (quiet || overdue)) {
+            std::vector<Change> changes = coalescer.Take();
+            if (callback) {
+                callback(changes);
+            }
+        }
+        if (lost) break;
+    }
+    // Stop dışında bir nedenle çıkıldıysa (izleme kaybı, okuma hatası) durumu yansıt
+    isRunning = false;
+}
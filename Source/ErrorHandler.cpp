@@ -1,26 +1,22 @@
 #include "../Headers/ErrorHandler.h"
 #include <comdef.h>
+#include <cstdio>
 #include <locale>
 #include <codecvt>
 
-ErrorHandler::ErrorHandler(const std::string& logFilePath) {
-    m_logFile.open(logFilePath, std::ios_base::app);
-    if (!m_logFile.is_open()) {
+ErrorHandler::ErrorHandler(const std::string& logFilePath) : clearedBefore(0) {
+    // Boyut/yaş sınırında döndürülür, eski dosyalar arka planda sıkıştırılır
+    if (!Logger::GetInstance().SetLogFile(logFilePath)) {
         std::cerr << "Failed to open log file: " << logFilePath << std::endl;
     }
 }
 
 ErrorHandler::~ErrorHandler() {
-    if (m_logFile.is_open()) {
-        m_logFile.close();
-    }
+    // Dosya Logger'a ait; kuyruktakiler Logger kapanırken yazılır
 }
 
 void ErrorHandler::HandleError(const std::string& errorMessage, ErrorLevel level) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    Error error = { errorMessage, level, std::chrono::system_clock::now() };
-    m_errors.push_back(error);
-    LogError(error);
+    LogError(errorMessage, level);
 }
 
 void ErrorHandler::HandleError(const std::wstring& errorMessage, ErrorLevel level) {
@@ -43,37 +39,79 @@ void ErrorHandler::HandleError(HRESULT hr, const std::wstring& functionName, Err
     HandleError(errorMessage, level);
 }
 
-void ErrorHandler::LogError(const Error& error) {
-    if (!m_logFile.is_open()) return;
+void ErrorHandler::LogError(const std::string& message, ErrorLevel level) {
+    Logger::GetInstance().Log(ToSeverity(level), message);
+}
 
-    std::string levelStr;
-    switch (error.level) {
-    case ErrorLevel::INFO:
-        levelStr = "INFO";
-        break;
-    case ErrorLevel::WARNING:
-        levelStr = "WARNING";
-        break;
-    case ErrorLevel::CRITICAL:
-        levelStr = "CRITICAL";
-        break;
-    }
+void ErrorHandler::LogInfo(const std::string& message, InfoLevel level) {
+    Logger::GetInstance().Log(ToSeverity(level), message);
+}
 
-    auto time_t = std::chrono::system_clock::to_time_t(error.timestamp);
-    struct tm timeinfo;
-    localtime_s(&timeinfo, &time_t);
+void ErrorHandler::ShowInfoDialog(const std::string& message, const std::string& title) {
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
+    MessageBoxW(nullptr, converter.from_bytes(message).c_str(), converter.from_bytes(title).c_str(),
+                MB_OK | MB_ICONINFORMATION);
+}
 
-    std::stringstream ss;
-    ss << std::put_time(&timeinfo, "%Y-%m-%d %H:%M:%S");
+std::string ErrorHandler::HRESULTToString(HRESULT hr) {
+    _com_error err(hr);
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
+    char code[16];
+    std::snprintf(code, sizeof(code), "0x%08lX", static_cast<unsigned long>(hr));
+    return std::string(code) + " - " + converter.to_bytes(err.ErrorMessage());
+}
 
-    m_logFile << "[" << ss.str() << "] [" << levelStr << "] " << error.message << std::endl;
+std::string ErrorHandler::GetLastErrorAsString() {
+    const DWORD error = GetLastError();
+    if (error == 0) return std::string();
+    
+    LPWSTR buffer = nullptr;
+    const DWORD length = FormatMessageW(FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+                                        nullptr, error, MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
+                                        reinterpret_cast<LPWSTR>(&buffer), 0, nullptr);
+    std::wstring message(buffer ? buffer : L"", length);
+    LocalFree(buffer);
+    // Sistem mesajları satır sonuyla biter
+    while (!message.empty() && (message.back() == L'\r' || message.back() == L'\n')) message.pop_back();
+    
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
+    return converter.to_bytes(message) + " (" + std::to_string(error) + ")";
+}
+
+LogSeverity ErrorHandler::ToSeverity(ErrorLevel level) {
+    switch (level) {
+    case ErrorLevel::WARNING:  return LogSeverity::Warning;
+    case ErrorLevel::ERROR:    return LogSeverity::Error;
+    case ErrorLevel::CRITICAL: return LogSeverity::Critical;
+    default:                   return LogSeverity::Info;
+    }
 }
 
-const std::vector<Error>& ErrorHandler::GetErrors() const {
-    return m_errors;
+LogSeverity ErrorHandler::ToSeverity(InfoLevel level) {
+    switch (level) {
+    case InfoLevel::TRACE:   return LogSeverity::Trace;
+    case InfoLevel::DEBUG:   return LogSeverity::Debug;
+    case InfoLevel::WARNING: return LogSeverity::Warning;
+    default:                 return LogSeverity::Info;
+    }
+}
+
+std::vector<Error> ErrorHandler::GetErrors() const {
+    std::vector<Error> errors;
+    const uint64_t visibleFrom = clearedBefore.load(std::memory_order_relaxed);
+    for (auto& entry : Logger::GetInstance().GetHistorySink().GetHistory().Snapshot()) {
+        if (entry.severity < LogSeverity::Warning || entry.sequence < visibleFrom) continue;
+        const ErrorLevel level = entry.severity >= LogSeverity::Critical ? ErrorLevel::CRITICAL
+                               : entry.severity >= LogSeverity::Error ? ErrorLevel::ERROR : ErrorLevel::WARNING;
+        errors.push_back({ std::move(entry.message), level,
+                           std::chrono::system_clock::time_point(std::chrono::milliseconds(entry.timestampMs)) });
+    }
+    return errors;
 }
 
 void ErrorHandler::ClearErrors() {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_errors.clear();
+    // Kuyruktaki (temizlemeden önce yazılmış) kayıtlar önce geçmişe ulaşır
+    Logger& logger = Logger::GetInstance();
+    logger.Flush();
+    clearedBefore.store(logger.GetHistorySink().GetHistory().GetAppendedCount(), std::memory_order_relaxed);
 }
@@ -0,0 +1,172 @@
+// Source/FastCompressor.cpp
+#include "../Headers/FastCompressor.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+static constexpr int HASH_LOG = 14;
+static constexpr size_t LAST_LITERALS = 5;     // Blok sonundaki son 5 bayt her zaman literal
+static constexpr size_t MATCH_FIND_LIMIT = 12; // Son eşleşme bloğun sonundan en az 12 bayt önce başlar
+static constexpr int SKIP_TRIGGER = 6;         // Eşleşme bulunamadıkça adım büyür (sıkıştırılamaz veride hızlı geç)
+
+static inline uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint32_t Hash(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - HASH_LOG);
+}
+
+// 15 ve üzeri uzunluklar token'dan sonra 255'lik baytlarla devam eder
+static inline bool WriteLength(size_t length, uint8_t*& out, const uint8_t* end) {
+    while (length >= 255) {
+        if (out >= end) return false;
+        *out++ = 255;
+        length -= 255;
+    }
+    if (out >= end) return false;
+    *out++ = static_cast<uint8_t>(length);
+    return true;
+}
+
+static bool WriteSequence(const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength,
+                          uint8_t*& out, const uint8_t* end, bool last) {
+    if (out >= end) return false;
+    uint8_t* token = out++;
+    *token = static_cast<uint8_t>(std::min<size_t>(literalLength, 15) << 4);
+    if (literalLength >= 15 && !WriteLength(literalLength - 15, out, end)) return false;
+
+    if (static_cast<size_t>(end - out) < literalLength) return false;
+    // Boş girdide literals null olabilir; memcpy'ye null vermek tanımsız
+    if (literalLength > 0) std::memcpy(out, literals, literalLength);
+    out += literalLength;
+    if (last) return true;
+
+    if (end - out < 2) return false;
+    *out++ = static_cast<uint8_t>(offset);
+    *out++ = static_cast<uint8_t>(offset >> 8);
+
+    const size_t code = matchLength - FastCompressor::MIN_MATCH;
+    *token |= static_cast<uint8_t>(std::min<size_t>(code, 15));
+    if (code >= 15 && !WriteLength(code - 15, out, end)) return false;
+    return true;
+}
+
+size_t FastCompressor::Compress(const uint8_t* source, size_t size, uint8_t* destination, size_t capacity) {
+    uint8_t* out = destination;
+    const uint8_t* end = destination + capacity;
+
+    size_t anchor = 0;
+    if (size > MATCH_FIND_LIMIT) {
+        // Thread başına tablo: her çağrıda 64 KB ayırmamak için
+        thread_local std::vector<uint32_t> table;
+        table.assign(size_t(1) << HASH_LOG, 0);
+
+        const size_t matchLimit = size - MATCH_FIND_LIMIT;
+        const size_t matchEnd = size - LAST_LITERALS;
+        size_t ip = 1;
+        table[Hash(Read32(source))] = 0;
+
+        while (ip < matchLimit) {
+            // Eşleşme ara
+            size_t reference = 0;
+            size_t searchCount = size_t(1) << SKIP_TRIGGER;
+            bool found = false;
+            while (ip < matchLimit) {
+                const uint32_t sequence = Read32(source + ip);
+                const uint32_t h = Hash(sequence);
+                reference = table[h];
+                table[h] = static_cast<uint32_t>(ip);
+                if (reference < ip && ip - reference <= MAX_OFFSET && Read32(source + reference) == sequence) {
+                    found = true;
+                    break;
+                }
+                ip += searchCount++ >> SKIP_TRIGGER;
+            }
+            if (!found) break;
+
+            // Geriye doğru uzat
+            while (ip > anchor && reference > 0 && source[ip - 1] == source[reference - 1]) {
+                --ip;
+                --reference;
+            }
+
+            // İleriye doğru uzat
+            size_t length = MIN_MATCH;
+            while (ip + length < matchEnd && source[ip + length] == source[reference + length]) {
+                ++length;
+            }
+
+            if (!WriteSequence(source + anchor, ip - anchor, ip - reference, length, out, end, false)) return 0;
+            ip += length;
+            anchor = ip;
+
+            // Eşleşmenin sonundaki konumu da tabloya ekle: ardışık eşleşmeler kaçmasın
+            if (ip < matchLimit) {
+                table[Hash(Read32(source + ip - 2))] = static_cast<uint32_t>(ip - 2);
+            }
+        }
+    }
+
+    if (!WriteSequence(source + anchor, size - anchor, 0, 0, out, end, true)) return 0;
+    return static_cast<size_t>(out - destination);
+}
+
+bool FastCompressor::Decompress(const uint8_t* source, size_t size, uint8_t* destination, size_t rawSize) {
+    size_t ip = 0;
+    size_t op = 0;
+
+    auto readLength = [&](size_t& length) {
+        uint8_t byte;
+        do {
+            if (ip >= size) return false;
+            byte = source[ip++];
+            length += byte;
+        } while (byte == 255);
+        return true;
+    };
+
+    while (ip < size) {
+        const uint8_t token = source[ip++];
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(literalLength)) return false;
+        if (literalLength > size - ip || literalLength > rawSize - op) return false;
+        if (literalLength > 0) std::memcpy(destination + op, source + ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        // Son dizide eşleşme yoktur
+        if (ip == size) break;
+
+        if (size - ip < 2) return false;
+        const size_t offset = source[ip] | (static_cast<size_t>(source[ip + 1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) return false;
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(matchLength)) return false;
+        matchLength += MIN_MATCH;
+        if (matchLength > rawSize - op) return false;
+
+        uint8_t* target = destination + op;
+        const uint8_t* match = target - offset;
+        if (offset >= matchLength) {
+            std::memcpy(target, match, matchLength);
+        } else {
+            // Örtüşen kopya (tekrar eden desen): kopyalanan bölge her adımda
+            // periyodun katı kadar büyür, bayt bayt kopyalamaya gerek kalmaz
+            size_t done = 0;
+            while (done < matchLength) {
+                const size_t chunk = std::min(done + offset, matchLength - done);
+                std::memcpy(target + done, match, chunk);
+                done += chunk;
+            }
+        }
+        op += matchLength;
+    }
+    return op == rawSize;
+}
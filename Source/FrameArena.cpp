@@ -0,0 +1,114 @@
+// Source/FrameArena.cpp
+#include "../Headers/FrameArena.h"
+
+#include <algorithm>
+
+FrameArena::Scope::Scope(FrameArena& arena)
+    : arena(arena), block(arena.currentBlock), offset(arena.currentOffset) {
+    ++arena.openScopes;
+}
+
+FrameArena::Scope::~Scope() {
+    // En dıştaki kare bitti ve öncesinde ayırma yoktu: birleştirme fırsatı
+    if (--arena.openScopes == 0 && block == 0 && offset == 0) {
+        arena.Reset();
+    } else {
+        arena.RewindTo(block, offset);
+    }
+}
+
+FrameArena::FrameArena(size_t initialBytes)
+    : currentBlock(0)
+    , currentOffset(0)
+    , capacity(0)
+    , peakBytes(0)
+    , blockAllocations(0)
+    , openScopes(0)
+    , memory(MemoryCategory::Scratch) {
+    // İlk blok ilk ayırmada alınır: hiç kullanmayan thread'ler bellek tutmaz
+    blocks.reserve(8);
+    blocks.push_back(Block{ nullptr, std::max<size_t>(initialBytes, 64) });
+}
+
+FrameArena::~FrameArena() = default;
+
+FrameArena& FrameArena::ForCurrentThread() {
+    thread_local FrameArena arena;
+    return arena;
+}
+
+void* FrameArena::Allocate(size_t bytes, size_t alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) alignment = alignof(std::max_align_t);
+    for (;;) {
+        Block& block = blocks[currentBlock];
+        if (block.memory) {
+            const uintptr_t base = reinterpret_cast<uintptr_t>(block.memory.get());
+            const uintptr_t aligned = (base + currentOffset + alignment - 1) & ~(uintptr_t(alignment) - 1);
+            const size_t end = static_cast<size_t>(aligned - base) + bytes;
+            if (end <= block.size) {
+                currentOffset = end;
+                peakBytes = std::max(peakBytes, GetUsedBytes());
+                return reinterpret_cast<void*>(aligned);
+            }
+            if (currentBlock + 1 < blocks.size()) {
+                ++currentBlock;
+                currentOffset = 0;
+                continue;
+            }
+        } else {
+            // İlk kullanımda veya birleştirmeden sonra ayrılmamış blok
+            block.size = std::max(block.size, bytes + alignment);
+            block.memory.reset(new uint8_t[block.size]);
+            capacity += block.size;
+            memory.Set(capacity);
+            ++blockAllocations;
+            continue;
+        }
+        AddBlock(bytes + alignment);
+    }
+}
+
+void FrameArena::Reset() {
+    RewindTo(0, 0);
+    if (openScopes > 0 || blocks.size() <= 1) return;
+
+    // Bir karenin tamamı tek bloğa sığsın: taşma bloklarını birleştir
+    const size_t total = capacity;
+    blocks.clear();
+    blocks.push_back(Block{ nullptr, total });
+    capacity = 0;
+    memory.Set(0);
+}
+
+size_t FrameArena::GetUsedBytes() const {
+    size_t used = currentOffset;
+    for (size_t i = 0; i < currentBlock; ++i) used += blocks[i].size;
+    return used;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    return Allocate(bytes, alignment);
+}
+
+void FrameArena::do_deallocate(void*, size_t, size_t) {
+    // Tek yönlü: bellek kare sınırında toptan geri alınır
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+void FrameArena::AddBlock(size_t minimumBytes) {
+    const size_t size = std::max(minimumBytes, blocks.back().size * 2);
+    blocks.push_back(Block{ std::unique_ptr<uint8_t[]>(new uint8_t[size]), size });
+    currentBlock = blocks.size() - 1;
+    currentOffset = 0;
+    capacity += size;
+    memory.Set(capacity);
+    ++blockAllocations;
+}
+
+void FrameArena::RewindTo(size_t block, size_t offset) {
+    currentBlock = std::min(block, blocks.size() - 1);
+    currentOffset = block < blocks.size() ? offset : 0;
+}
@@ -0,0 +1,188 @@
+// Source/FramePipeline.cpp
+#include "../Headers/FramePipeline.h"
+#include "../Headers/FrameArena.h"
+#include "../Headers/TraceRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+
+FramePipeline::Frame::Frame()
+    : index(0), timestampMs(0), width(0), height(0), stride(0), surface(nullptr), surfaceBytes(0),
+      memory(MemoryCategory::Frames) {}
+
+FramePipeline::FramePipeline(double frameIntervalMs)
+    : depthController(frameIntervalMs), queue(), freeSlots(), queueHead(0), queueCount(0), freeCount(0),
+      nextIndex(0), presentedCount(0) {
+    for (int slot = SLOT_COUNT - 1; slot >= 0; --slot) freeSlots[freeCount++] = slot;
+}
+
+FramePipeline::~FramePipeline() {
+    Clear();
+}
+
+void FramePipeline::SetDecoder(Decoder newDecoder) {
+    std::lock_guard<std::mutex> lock(mutex);
+    decoder = std::move(newDecoder);
+}
+
+void FramePipeline::SetPresenter(Presenter newPresenter) {
+    std::lock_guard<std::mutex> lock(mutex);
+    presenter = std::move(newPresenter);
+}
+
+void FramePipeline::SetSurfaceReleaser(SurfaceReleaser releaser) {
+    std::lock_guard<std::mutex> lock(mutex);
+    surfaceReleaser = std::move(releaser);
+}
+
+void FramePipeline::SetLargePages(LargePages::Mode mode) {
+    std::lock_guard<std::mutex> lock(mutex);
+    TrimTo(0);
+    ReleaseIdleSlots(0);
+    for (Frame& frame : slots) frame.pixels = PixelBuffer(LargePageAllocator<uint8_t>(mode));
+}
+
+LargePages::Mode FramePipeline::GetLargePages() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return slots[0].pixels.get_allocator().GetMode();
+}
+
+bool FramePipeline::Step() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!decoder) return false;
+    // Kare sınırı: decoder ve presenter'ın geçici ayırmaları burada geri alınır
+    FrameArena::Scope scope;
+    TraceRecorder::Span stepSpan("Kare");
+    const uint64_t stepStart = FrameTelemetry::Now();
+
+    const int depth = depthController.GetDepth();
+    while (queueCount > 0 && queueCount >= depth) {
+        const int slot = PopOldest();
+        if (presenter) {
+            FrameTelemetry::ScopedStage present(&telemetry, FrameTelemetry::Stage::Present);
+            presenter(slots[slot]);
+        }
+        ++presentedCount;
+        Recycle(slot);
+    }
+
+    const int slot = freeSlots[--freeCount];
+    Frame& frame = slots[slot];
+    const auto decodeStart = std::chrono::steady_clock::now();
+    if (!decoder(frame)) {
+        Recycle(slot);
+        return false;
+    }
+    const double decodeMs =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - decodeStart).count();
+
+    frame.index = nextIndex++;
+    frame.memory.Set(frame.pixels.capacity() + frame.surfaceBytes);
+    queue[(queueHead + queueCount) % SLOT_COUNT] = slot;
+    ++queueCount;
+    const bool depthChanged = depthController.RecordDecode(decodeMs);
+
+    const uint64_t stepNs = FrameTelemetry::Now() - stepStart;
+    const bool late = stepNs > depthController.GetFrameInterval() * 1e6;
+    telemetry.RecordFrame(stepNs, late);
+    telemetry.RecordQueueDepth(queueCount);
+    TraceRecorder& trace = TraceRecorder::GetInstance();
+    trace.Counter("Kuyruk derinliği", queueCount);
+    // Takılmanın öncesi zaman çizelgesinde: iz kaydı açıksa döküm arka planda yazılır
+    if (late) trace.OnMissedDeadline("Kare süresi aşıldı");
+    return depthChanged;
+}
+
+void FramePipeline::Reset(double frameIntervalMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    TrimTo(0);
+    ReleaseIdleSlots(0);
+    depthController.Reset(frameIntervalMs);
+    telemetry.Reset();
+    nextIndex = 0;
+    presentedCount = 0;
+}
+
+void FramePipeline::SetMemoryCap(int frames) {
+    depthController.SetMemoryCap(frames);
+    std::lock_guard<std::mutex> lock(mutex);
+    const int depth = depthController.GetDepth();
+    // Bütçe kırpması sunulmamış kareleri atar: düşürülmüş sayılır
+    telemetry.RecordDropped(TrimTo(depth));
+    // Step sunumdan sonra en fazla depth slot kullanır: fazlası boşta kalır
+    ReleaseIdleSlots(std::max(depth - queueCount, 0));
+}
+
+size_t FramePipeline::DropOlderThan(uint32_t nowMs, uint32_t maxAgeMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Kuyruk zaman sırasında: en eskiden başlayıp ilk genç karede dur
+    size_t dropped = 0;
+    while (queueCount > 0 && nowMs - slots[queue[queueHead]].timestampMs > maxAgeMs) {
+        const int slot = PopOldest();
+        ReleaseSlot(slot);
+        RecycleCold(slot);
+        ++dropped;
+    }
+    telemetry.RecordDropped(dropped);
+    return dropped;
+}
+
+void FramePipeline::Clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    TrimTo(0);
+    ReleaseIdleSlots(0);
+}
+
+size_t FramePipeline::GetQueuedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<size_t>(queueCount);
+}
+
+uint64_t FramePipeline::GetPresentedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return presentedCount;
+}
+
+int FramePipeline::PopOldest() {
+    const int slot = queue[queueHead];
+    queueHead = (queueHead + 1) % SLOT_COUNT;
+    --queueCount;
+    return slot;
+}
+
+void FramePipeline::Recycle(int slot) {
+    freeSlots[freeCount++] = slot;
+}
+
+void FramePipeline::RecycleCold(int slot) {
+    // Belleği bırakılmış slot yığının dibine: sıcak slotlar önce kullanılmaya devam eder
+    std::copy_backward(freeSlots.begin(), freeSlots.begin() + freeCount, freeSlots.begin() + freeCount + 1);
+    freeSlots[0] = slot;
+    ++freeCount;
+}
+
+void FramePipeline::ReleaseSlot(int slot) {
+    Frame& frame = slots[slot];
+    if (frame.surface && surfaceReleaser) surfaceReleaser(frame.surface);
+    frame.surface = nullptr;
+    frame.surfaceBytes = 0;
+    PixelBuffer(frame.pixels.get_allocator()).swap(frame.pixels);
+    frame.memory.Set(0);
+}
+
+void FramePipeline::ReleaseIdleSlots(int keep) {
+    // En sıcak slotlar (LIFO'nun üstü) korunur. Derinlik tekrar artarsa
+    // bırakılan slotlar ilk decode'da yeniden ayrılır
+    for (int i = 0; i < freeCount - keep; ++i) ReleaseSlot(freeSlots[i]);
+}
+
+size_t FramePipeline::TrimTo(int frames) {
+    size_t trimmed = 0;
+    while (queueCount > frames) {
+        const int slot = PopOldest();
+        ReleaseSlot(slot);
+        RecycleCold(slot);
+        ++trimmed;
+    }
+    return trimmed;
+}
@@ -0,0 +1,146 @@
+// Source/FrameTelemetry.cpp
+#include "../Headers/FrameTelemetry.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+HdrHistogram::HdrHistogram()
+    : count(0), sum(0), max(0) {
+    for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+}
+
+size_t HdrHistogram::GetBucketIndex(uint64_t value) {
+    value = std::min(value, MAX_VALUE);
+    if (value < SUB_BUCKET_COUNT) return static_cast<size_t>(value);
+    // İlk aralık tam çözünürlüklü; sonrakiler en anlamlı SUB_BUCKET_BITS + 1 bitle ayrılır
+    const int shift = std::bit_width(value) - 1 - SUB_BUCKET_BITS;
+    return static_cast<size_t>(shift) * SUB_BUCKET_COUNT + static_cast<size_t>(value >> shift);
+}
+
+uint64_t HdrHistogram::GetBucketLowest(size_t index) {
+    if (index < SUB_BUCKET_COUNT) return index;
+    const size_t shift = index / SUB_BUCKET_COUNT - 1;
+    return static_cast<uint64_t>(index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT) << shift;
+}
+
+uint64_t HdrHistogram::GetBucketHighest(size_t index) {
+    if (index < SUB_BUCKET_COUNT) return index;
+    const size_t shift = index / SUB_BUCKET_COUNT - 1;
+    return GetBucketLowest(index) + (uint64_t(1) << shift) - 1;
+}
+
+void HdrHistogram::Record(uint64_t value) {
+    buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+    uint64_t observed = max.load(std::memory_order_relaxed);
+    while (value > observed && !max.compare_exchange_weak(observed, value, std::memory_order_relaxed)) {
+    }
+}
+
+void HdrHistogram::Reset() {
+    for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t HdrHistogram::Load(Counts& counts) const {
+    // Toplam kovalardan: yüzdelik sıraları kopyayla tutarlı kalır
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        counts[i] = buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    return total;
+}
+
+uint64_t HdrHistogram::ValueAtRank(const Counts& counts, uint64_t rank, uint64_t observedMax) {
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += counts[i];
+        if (seen >= rank) return std::min(GetBucketHighest(i), observedMax);
+    }
+    return observedMax;
+}
+
+uint64_t HdrHistogram::GetValueAtPercentile(double percentile) const {
+    Counts counts;
+    const uint64_t total = Load(counts);
+    if (total == 0) return 0;
+    const uint64_t rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(percentile / 100.0 * total)), 1);
+    return ValueAtRank(counts, rank, max.load(std::memory_order_relaxed));
+}
+
+HdrHistogram::Summary HdrHistogram::Summarize() const {
+    Summary summary;
+    Counts counts;
+    const uint64_t total = Load(counts);
+    if (total == 0) return summary;
+
+    const uint64_t observedMax = max.load(std::memory_order_relaxed);
+    const auto at = [&](double percentile) {
+        const uint64_t rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(percentile / 100.0 * total)), 1);
+        return ValueAtRank(counts, rank, observedMax);
+    };
+    summary.count = total;
+    summary.mean = static_cast<double>(sum.load(std::memory_order_relaxed)) /
+                   static_cast<double>(std::max<uint64_t>(count.load(std::memory_order_relaxed), 1));
+    summary.p50 = at(50.0);
+    summary.p90 = at(90.0);
+    summary.p99 = at(99.0);
+    summary.p999 = at(99.9);
+    summary.max = observedMax;
+    return summary;
+}
+
+FrameTelemetry::FrameTelemetry()
+    : currentQueueDepth(0), droppedFrames(0), lateFrames(0) {
+}
+
+void FrameTelemetry::RecordStage(Stage stage, uint64_t nanoseconds) {
+    stages[static_cast<size_t>(stage)].Record(nanoseconds);
+}
+
+void FrameTelemetry::RecordFrame(uint64_t nanoseconds, bool late) {
+    frame.Record(nanoseconds);
+    if (late) lateFrames.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FrameTelemetry::RecordQueueDepth(int depth) {
+    queueDepth.Record(static_cast<uint64_t>(std::max(depth, 0)));
+    currentQueueDepth.store(depth, std::memory_order_relaxed);
+}
+
+void FrameTelemetry::RecordDropped(uint64_t frames) {
+    droppedFrames.fetch_add(frames, std::memory_order_relaxed);
+}
+
+void FrameTelemetry::Reset() {
+    for (auto& stage : stages) stage.Reset();
+    frame.Reset();
+    queueDepth.Reset();
+    currentQueueDepth.store(0, std::memory_order_relaxed);
+    droppedFrames.store(0, std::memory_order_relaxed);
+    lateFrames.store(0, std::memory_order_relaxed);
+}
+
+FrameTelemetry::Snapshot FrameTelemetry::GetSnapshot() const {
+    Snapshot snapshot;
+    for (size_t i = 0; i < STAGE_COUNT; ++i) snapshot.stages[i] = stages[i].Summarize();
+    snapshot.frame = frame.Summarize();
+    snapshot.queueDepth = queueDepth.Summarize();
+    snapshot.currentQueueDepth = currentQueueDepth.load(std::memory_order_relaxed);
+    snapshot.droppedFrames = droppedFrames.load(std::memory_order_relaxed);
+    snapshot.lateFrames = lateFrames.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+const char* FrameTelemetry::GetStageName(Stage stage) {
+    switch (stage) {
+        case Stage::Decode:  return "Decode";
+        case Stage::Present: return "Sunum";
+        default:             return "?";
+    }
+}
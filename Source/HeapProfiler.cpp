@@ -0,0 +1,383 @@
+// Source/HeapProfiler.cpp
+#include "../Headers/HeapProfiler.h"
+#include "../Headers/AllocationHooks.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+#if defined(_MSC_VER)
+#define HEAP_PROFILER_NOINLINE __declspec(noinline)
+#else
+#define HEAP_PROFILER_NOINLINE __attribute__((noinline))
+#endif
+
+namespace {
+
+constexpr int FILTER_BITS_LOG = 16;
+constexpr size_t FILTER_WORDS = (size_t(1) << FILTER_BITS_LOG) / 64;
+
+struct StackKey {
+    std::array<void*, HeapProfiler::MAX_STACK_DEPTH> frames;   // Yaprak önce
+    int depth;
+
+    bool operator==(const StackKey& other) const {
+        return depth == other.depth && std::equal(frames.begin(), frames.begin() + depth, other.frames.begin());
+    }
+};
+
+struct StackKeyHash {
+    size_t operator()(const StackKey& key) const {
+        uint64_t hash = 1469598103934665603ull;
+        for (int i = 0; i < key.depth; ++i) {
+            hash = (hash ^ reinterpret_cast<uintptr_t>(key.frames[i])) * 1099511628211ull;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
+
+// Ham değerler pprof içindir (örneklemeyi pprof kendisi geri alır);
+// tahminler katlanmış stack ve GetTopSites içindir
+struct SiteData {
+    StackKey stack;
+    uint64_t sampledAllocCount;
+    uint64_t sampledAllocBytes;
+    uint64_t sampledInUseCount;
+    uint64_t sampledInUseBytes;
+    double allocCount;
+    double allocBytes;
+    double inUseCount;
+    double inUseBytes;
+};
+
+struct LiveSample {
+    SiteData* site;
+    size_t size;
+    double weight;
+};
+
+struct ProfilerState {
+    std::mutex mutex;
+    std::unordered_map<StackKey, SiteData, StackKeyHash> sites;
+    std::unordered_map<void*, LiveSample> live;
+    uint64_t sampleCount = 0;
+};
+
+// operator new'den statik başlatma bitmeden de çağrılabilir: hepsi sabit başlatılır
+std::atomic<size_t> g_samplingBytes{ HeapProfiler::DEFAULT_SAMPLING_BYTES };
+std::atomic<uint32_t> g_generation{ 1 };
+std::atomic<uint64_t> g_filter[FILTER_WORDS];
+// Yok edilmez: çıkışta statik yıkımdan sonra gelen delete'ler de güvenli kalır
+ProfilerState* g_state = nullptr;
+std::mutex g_controlMutex;
+std::string g_environmentPrefix;
+
+struct ThreadSampler {
+    int64_t bytesUntilSample;
+    uint64_t random;
+    uint32_t generation;
+    bool inHook;   // Profilerin kendi ayırmaları örneklenmez
+};
+thread_local ThreadSampler t_sampler;
+
+class HookGuard {
+public:
+    HookGuard() : previous(t_sampler.inHook) { t_sampler.inHook = true; }
+    ~HookGuard() { t_sampler.inHook = previous; }
+private:
+    bool previous;
+};
+
+size_t FilterBit(const void* pointer) {
+    return static_cast<size_t>((reinterpret_cast<uintptr_t>(pointer) >> 4) * 0x9E3779B97F4A7C15ull >> (64 - FILTER_BITS_LOG));
+}
+
+int64_t NextInterval(ThreadSampler& sampler) {
+    // Üstel dağılımlı aralık: her bayt eşit olasılıkla seçilir, ayırma
+    // boyutlarındaki düzenli desenler örneklemeyi kaydırmaz
+    if (sampler.random == 0) {
+        sampler.random = reinterpret_cast<uintptr_t>(&sampler) ^ 0x2545F4914F6CDD1Dull;
+    }
+    sampler.random ^= sampler.random << 13;
+    sampler.random ^= sampler.random >> 7;
+    sampler.random ^= sampler.random << 17;
+    const double uniform = (static_cast<double>(sampler.random >> 11) + 1.0) / 9007199254740993.0;
+    const double interval = -std::log(uniform) * static_cast<double>(g_samplingBytes.load(std::memory_order_relaxed));
+    return static_cast<int64_t>(std::min(interval, 9.0e18)) + 1;
+}
+
+HEAP_PROFILER_NOINLINE void RecordSample(void* pointer, size_t size) {
+    StackKey key;
+    key.depth = AllocationHooks::CaptureCallerStack(key.frames.data(), HeapProfiler::MAX_STACK_DEPTH);
+
+    ProfilerState& state = *g_state;
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    // Örneklenme olasılığı 1 - e^(-boyut/aralık): her örnek 1/olasılık ayırmayı temsil eder
+    const double rate = static_cast<double>(g_samplingBytes.load(std::memory_order_relaxed));
+    const double weight = 1.0 / (1.0 - std::exp(-static_cast<double>(size) / rate));
+
+    auto inserted = state.sites.try_emplace(key);
+    SiteData& site = inserted.first->second;
+    if (inserted.second) site.stack = key;
+    ++site.sampledAllocCount;
+    site.sampledAllocBytes += size;
+    ++site.sampledInUseCount;
+    site.sampledInUseBytes += size;
+    site.allocCount += weight;
+    site.allocBytes += weight * static_cast<double>(size);
+    site.inUseCount += weight;
+    site.inUseBytes += weight * static_cast<double>(size);
+
+    state.live[pointer] = LiveSample{ &site, size, weight };
+    const size_t bit = FilterBit(pointer);
+    g_filter[bit / 64].fetch_or(uint64_t(1) << (bit % 64), std::memory_order_relaxed);
+    ++state.sampleCount;
+}
+
+HEAP_PROFILER_NOINLINE void OnAllocation(void* pointer, size_t size) {
+    ThreadSampler& sampler = t_sampler;
+    if (sampler.inHook) return;
+
+    const uint32_t generation = g_generation.load(std::memory_order_relaxed);
+    if (sampler.generation != generation) {
+        sampler.generation = generation;
+        sampler.bytesUntilSample = NextInterval(sampler);
+    }
+
+    sampler.bytesUntilSample -= static_cast<int64_t>(size);
+    if (sampler.bytesUntilSample > 0) return;
+
+    sampler.inHook = true;
+    sampler.bytesUntilSample = NextInterval(sampler);
+    RecordSample(pointer, size);
+    sampler.inHook = false;
+}
+
+HEAP_PROFILER_NOINLINE void OnFree(void* pointer) {
+    ThreadSampler& sampler = t_sampler;
+    if (sampler.inHook || !pointer) return;
+
+    // Örneklenmemiş işaretçilerin büyük çoğunluğu kilitsiz bu testte elenir
+    const size_t bit = FilterBit(pointer);
+    if (!(g_filter[bit / 64].load(std::memory_order_relaxed) & (uint64_t(1) << (bit % 64)))) return;
+
+    HookGuard guard;
+    ProfilerState& state = *g_state;
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto found = state.live.find(pointer);
+    if (found == state.live.end()) return;
+
+    SiteData& site = *found->second.site;
+    --site.sampledInUseCount;
+    site.sampledInUseBytes -= found->second.size;
+    site.inUseCount -= found->second.weight;
+    site.inUseBytes -= found->second.weight * static_cast<double>(found->second.size);
+    state.live.erase(found);
+}
+
+double MetricValue(const SiteData& site, HeapProfiler::Metric metric) {
+    return metric == HeapProfiler::Metric::InUseBytes ? site.inUseBytes : site.allocBytes;
+}
+
+std::vector<const SiteData*> SortedSites(const ProfilerState& state, HeapProfiler::Metric metric) {
+    std::vector<const SiteData*> sorted;
+    sorted.reserve(state.sites.size());
+    for (const auto& entry : state.sites) sorted.push_back(&entry.second);
+    std::sort(sorted.begin(), sorted.end(), [metric](const SiteData* a, const SiteData* b) {
+        return MetricValue(*a, metric) > MetricValue(*b, metric);
+    });
+    return sorted;
+}
+
+std::string MappedLibraries() {
+#ifdef _WIN32
+    // /proc/self/maps biçiminde modül listesi
+    std::ostringstream out;
+    HMODULE modules[1024];
+    DWORD needed = 0;
+    if (EnumProcessModules(GetCurrentProcess(), modules, sizeof(modules), &needed)) {
+        const DWORD count = std::min<DWORD>(needed / sizeof(HMODULE), 1024);
+        for (DWORD i = 0; i < count; ++i) {
+            MODULEINFO info = {};
+            char path[MAX_PATH] = {};
+            if (!GetModuleInformation(GetCurrentProcess(), modules[i], &info, sizeof(info))) continue;
+            GetModuleFileNameA(modules[i], path, MAX_PATH);
+            const uintptr_t base = reinterpret_cast<uintptr_t>(info.lpBaseOfDll);
+            out << std::hex << base << "-" << (base + info.SizeOfImage) << " r-xp 00000000 00:00 0 " << path << "\n";
+        }
+    }
+    return out.str();
+#else
+    std::ifstream maps("/proc/self/maps");
+    std::ostringstream out;
+    out << maps.rdbuf();
+    return out.str();
+#endif
+}
+
+void WriteEnvironmentProfile() {
+    HeapProfiler::Stop();
+    HeapProfiler::WritePprof(g_environmentPrefix + ".heap");
+    HeapProfiler::WriteCollapsed(g_environmentPrefix + ".folded", HeapProfiler::Metric::InUseBytes);
+}
+
+}  // namespace
+
+bool HeapProfiler::Start(size_t samplingBytes) {
+    std::lock_guard<std::mutex> control(g_controlMutex);
+    HookGuard guard;
+
+    AllocationHooks::Disable(AllocationHooks::Hook::HeapProfiler);
+    if (!g_state) g_state = new ProfilerState();
+    {
+        std::lock_guard<std::mutex> lock(g_state->mutex);
+        g_state->sites.clear();
+        g_state->live.clear();
+        g_state->sampleCount = 0;
+    }
+    for (auto& word : g_filter) word.store(0, std::memory_order_relaxed);
+
+    g_samplingBytes.store(std::max<size_t>(samplingBytes, 1), std::memory_order_relaxed);
+    g_generation.fetch_add(1, std::memory_order_relaxed);
+    AllocationHooks::Enable(AllocationHooks::Hook::HeapProfiler, OnAllocation, OnFree);
+    return true;
+}
+
+void HeapProfiler::Stop() {
+    std::lock_guard<std::mutex> control(g_controlMutex);
+    AllocationHooks::Disable(AllocationHooks::Hook::HeapProfiler);
+}
+
+bool HeapProfiler::IsRunning() {
+    return AllocationHooks::IsEnabled(AllocationHooks::Hook::HeapProfiler);
+}
+
+bool HeapProfiler::StartFromEnvironment() {
+    const char* prefix = std::getenv("LMW_HEAP_PROFILE");
+    if (!prefix || !*prefix) return false;
+
+    size_t samplingBytes = DEFAULT_SAMPLING_BYTES;
+    if (const char* rate = std::getenv("LMW_HEAP_PROFILE_RATE")) {
+        const unsigned long long parsed = std::strtoull(rate, nullptr, 10);
+        if (parsed > 0) samplingBytes = static_cast<size_t>(parsed);
+    }
+
+    static bool registered = false;
+    {
+        HookGuard guard;
+        g_environmentPrefix = prefix;
+    }
+    if (!Start(samplingBytes)) return false;
+    if (!registered) {
+        registered = true;
+        std::atexit(WriteEnvironmentProfile);
+    }
+    return true;
+}
+
+bool HeapProfiler::WritePprof(const std::string& path) {
+    if (!g_state) return false;
+    HookGuard guard;
+
+    std::ostringstream body;
+    uint64_t inUseCount = 0, inUseBytes = 0, allocCount = 0, allocBytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_state->mutex);
+        for (const SiteData* site : SortedSites(*g_state, Metric::InUseBytes)) {
+            inUseCount += site->sampledInUseCount;
+            inUseBytes += site->sampledInUseBytes;
+            allocCount += site->sampledAllocCount;
+            allocBytes += site->sampledAllocBytes;
+            body << site->sampledInUseCount << ": " << site->sampledInUseBytes << " [" << site->sampledAllocCount << ": "
+                 << site->sampledAllocBytes << "] @";
+            for (int i = 0; i < site->stack.depth; ++i) {
+                body << " 0x" << std::hex << reinterpret_cast<uintptr_t>(site->stack.frames[i]) << std::dec;
+            }
+            body << "\n";
+        }
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    // heap_v2/<aralık>: pprof değerleri örnekleme aralığına göre kendisi ölçekler
+    file << "heap profile: " << inUseCount << ": " << inUseBytes << " [" << allocCount << ": " << allocBytes
+         << "] @ heap_v2/" << g_samplingBytes.load(std::memory_order_relaxed) << "\n";
+    file << body.str();
+    file << "\nMAPPED_LIBRARIES:\n" << MappedLibraries();
+    return static_cast<bool>(file);
+}
+
+bool HeapProfiler::WriteCollapsed(const std::string& path, Metric metric) {
+    if (!g_state) return false;
+    HookGuard guard;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    for (const Site& site : GetTopSites(SIZE_MAX, metric)) {
+        const uint64_t value = metric == Metric::InUseBytes ? site.inUseBytes : site.allocBytes;
+        if (value == 0) continue;
+        for (size_t i = 0; i < site.frames.size(); ++i) {
+            if (i) file << ';';
+            file << site.frames[i];
+        }
+        file << ' ' << value << "\n";
+    }
+    return static_cast<bool>(file);
+}
+
+std::vector<HeapProfiler::Site> HeapProfiler::GetTopSites(size_t count, Metric metric) {
+    std::vector<Site> result;
+    if (!g_state) return result;
+    HookGuard guard;
+
+    std::vector<SiteData> copies;
+    {
+        std::lock_guard<std::mutex> lock(g_state->mutex);
+        for (const SiteData* site : SortedSites(*g_state, metric)) {
+            if (copies.size() >= count) break;
+            copies.push_back(*site);
+        }
+    }
+
+    // Sembol çözümü kilit dışında: yavaş olabilir
+    std::unordered_map<void*, std::string> names;
+    for (const SiteData& data : copies) {
+        Site site;
+        for (int i = data.stack.depth - 1; i >= 0; --i) {
+            void* frame = data.stack.frames[i];
+            auto found = names.find(frame);
+            if (found == names.end()) found = names.emplace(frame, AllocationHooks::DescribeFrame(frame)).first;
+            site.frames.push_back(found->second);
+        }
+        site.allocCount = static_cast<uint64_t>(std::llround(data.allocCount));
+        site.allocBytes = static_cast<uint64_t>(std::llround(data.allocBytes));
+        site.inUseCount = static_cast<uint64_t>(std::llround(std::max(0.0, data.inUseCount)));
+        site.inUseBytes = static_cast<uint64_t>(std::llround(std::max(0.0, data.inUseBytes)));
+        result.push_back(std::move(site));
+    }
+    return result;
+}
+
+uint64_t HeapProfiler::GetSampleCount() {
+    if (!g_state) return 0;
+    HookGuard guard;
+    std::lock_guard<std::mutex> lock(g_state->mutex);
+    return g_state->sampleCount;
+}
+
+size_t HeapProfiler::GetSamplingBytes() {
+    return g_samplingBytes.load(std::memory_order_relaxed);
+}
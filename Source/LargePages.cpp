@@ -0,0 +1,197 @@
+// Source/LargePages.cpp
+#include "../Headers/LargePages.h"
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+constexpr size_t BACKING_COUNT = static_cast<size_t>(LargePages::Backing::Count);
+constexpr size_t DEFAULT_LARGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+struct Mapping {
+    size_t length;
+    LargePages::Backing backing;
+};
+
+std::atomic<size_t> g_bytes[BACKING_COUNT];
+std::mutex g_mappingMutex;
+// Eşlemeler seyrek (kare slotu başına bir): Free'de türü bulmak için
+std::unordered_map<void*, Mapping>& Mappings() {
+    static std::unordered_map<void*, Mapping> mappings;
+    return mappings;
+}
+
+size_t RoundUp(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+void Count(LargePages::Backing backing, size_t bytes, bool add) {
+    auto& counter = g_bytes[static_cast<size_t>(backing)];
+    if (add) {
+        counter.fetch_add(bytes, std::memory_order_relaxed);
+    } else {
+        counter.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+}
+
+#ifdef _WIN32
+// MEM_LARGE_PAGES için kullanıcının "Bellekte sayfaları kilitle" hakkı olmalı;
+// hak atanmışsa bile süreç belirtecinde etkinleştirilmesi gerekir
+bool EnableLockMemoryPrivilege() {
+    HANDLE token = nullptr;
+    if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token)) return false;
+
+    TOKEN_PRIVILEGES privileges = {};
+    privileges.PrivilegeCount = 1;
+    privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+    bool enabled = LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) &&
+                   AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) &&
+                   GetLastError() == ERROR_SUCCESS;
+    CloseHandle(token);
+    return enabled;
+}
+
+void* MapPages(size_t length, LargePages::Mode, LargePages::Backing& backing) {
+    static const bool privileged = EnableLockMemoryPrivilege();
+    if (privileged) {
+        void* pointer = VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        if (pointer) {
+            backing = LargePages::Backing::Explicit;
+            return pointer;
+        }
+    }
+    backing = LargePages::Backing::Regular;
+    return VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+void UnmapPages(void* pointer, size_t) {
+    VirtualFree(pointer, 0, MEM_RELEASE);
+}
+#else
+// "[never]" seçiliyse madvise başarılı döner ama hiçbir şey yapmaz
+bool IsTransparentHugePageAvailable() {
+    std::ifstream file("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string modes;
+    std::getline(file, modes);
+    return !modes.empty() && modes.find("[never]") == std::string::npos;
+}
+
+void* MapPages(size_t length, LargePages::Mode mode, LargePages::Backing& backing) {
+    if (mode == LargePages::Mode::Explicit) {
+        // Havuz (vm.nr_hugepages) boşsa hemen başarısız olur
+        void* pointer = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (pointer != MAP_FAILED) {
+            backing = LargePages::Backing::Explicit;
+            return pointer;
+        }
+    }
+
+    // THP sadece büyük sayfa sınırına hizalı bölgeleri birleştirir: fazlasını
+    // eşleyip baştaki ve sondaki artığı geri ver
+    const size_t pageSize = LargePages::GetLargePageSize();
+    void* raw = mmap(nullptr, length + pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return nullptr;
+    const uintptr_t rawStart = reinterpret_cast<uintptr_t>(raw);
+    const uintptr_t start = RoundUp(rawStart, pageSize);
+    const size_t head = start - rawStart;
+    if (head > 0) munmap(raw, head);
+    if (pageSize - head > 0) munmap(reinterpret_cast<void*>(start + length), pageSize - head);
+
+    static const bool transparentAvailable = IsTransparentHugePageAvailable();
+    void* pointer = reinterpret_cast<void*>(start);
+    backing = transparentAvailable && madvise(pointer, length, MADV_HUGEPAGE) == 0
+        ? LargePages::Backing::Transparent : LargePages::Backing::Regular;
+    return pointer;
+}
+
+void UnmapPages(void* pointer, size_t length) {
+    munmap(pointer, length);
+}
+#endif
+
+}  // namespace
+
+size_t LargePages::GetLargePageSize() {
+#ifdef _WIN32
+    static const size_t size = GetLargePageMinimum();
+    return size;
+#else
+    static const size_t size = [] {
+        std::ifstream meminfo("/proc/meminfo");
+        std::string key;
+        size_t kilobytes = 0;
+        while (meminfo >> key) {
+            if (key == "Hugepagesize:" && meminfo >> kilobytes) return kilobytes * 1024;
+            meminfo.ignore(256, '\n');
+        }
+        return DEFAULT_LARGE_PAGE_SIZE;
+    }();
+    return size;
+#endif
+}
+
+void* LargePages::Allocate(size_t bytes, Mode mode, Backing* backing) {
+    const size_t pageSize = GetLargePageSize();
+    if (mode == Mode::Off || bytes < MINIMUM_BYTES || pageSize == 0) {
+        if (backing) *backing = Backing::Heap;
+        Count(Backing::Heap, bytes, true);
+        return ::operator new(bytes, std::nothrow);
+    }
+
+    const size_t length = RoundUp(bytes, pageSize);
+    Backing obtained = Backing::Regular;
+    void* pointer = MapPages(length, mode, obtained);
+    if (!pointer) return nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(g_mappingMutex);
+        Mappings()[pointer] = Mapping{ length, obtained };
+    }
+    Count(obtained, length, true);
+    if (backing) *backing = obtained;
+    return pointer;
+}
+
+void LargePages::Free(void* pointer, size_t bytes, Mode mode) {
+    if (!pointer) return;
+    if (mode == Mode::Off || bytes < MINIMUM_BYTES || GetLargePageSize() == 0) {
+        Count(Backing::Heap, bytes, false);
+        ::operator delete(pointer);
+        return;
+    }
+
+    Mapping mapping;
+    {
+        std::lock_guard<std::mutex> lock(g_mappingMutex);
+        auto found = Mappings().find(pointer);
+        if (found == Mappings().end()) return;
+        mapping = found->second;
+        Mappings().erase(found);
+    }
+    Count(mapping.backing, mapping.length, false);
+    UnmapPages(pointer, mapping.length);
+}
+
+size_t LargePages::GetBytes(Backing backing) {
+    return g_bytes[static_cast<size_t>(backing)].load(std::memory_order_relaxed);
+}
+
+const char* LargePages::GetBackingName(Backing backing) {
+    switch (backing) {
+        case Backing::Heap:        return "Heap";
+        case Backing::Regular:     return "Regular";
+        case Backing::Transparent: return "Transparent";
+        case Backing::Explicit:    return "Explicit";
+        default:                   return "Unknown";
+    }
+}
@@ -0,0 +1,83 @@
+// Source/LogHistory.cpp
+#include "../Headers/LogHistory.h"
+#include "../Headers/LogText.h"
+
+#include <algorithm>
+#include <cstring>
+
+LogHistory::Capacities LogHistory::DefaultCapacities() {
+    return Capacities{ 64, 128, 256, 256, 256, 64 };
+}
+
+LogHistory::LogHistory(const Capacities& capacities)
+    : nextSequence(0), clearedBefore(0), memory(MemoryCategory::Logging) {
+    size_t bytes = 0;
+    for (size_t level = 0; level < rings.size(); ++level) {
+        Ring& ring = rings[level];
+        ring.capacity = capacities[level];
+        ring.slots.reset(ring.capacity > 0 ? new Slot[ring.capacity] : nullptr);
+        for (size_t i = 0; i < ring.capacity; ++i) ring.slots[i].version.store(0, std::memory_order_relaxed);
+        ring.head.store(0, std::memory_order_relaxed);
+        bytes += ring.capacity * sizeof(Slot);
+    }
+    memory.Set(bytes);
+}
+
+void LogHistory::Append(LogSeverity severity, std::string_view message, int64_t timestampMs) {
+    Ring& ring = rings[static_cast<size_t>(severity)];
+    const uint64_t sequence = nextSequence.fetch_add(1, std::memory_order_relaxed);
+    if (ring.capacity == 0) return;
+
+    Slot& slot = ring.slots[ring.head.fetch_add(1, std::memory_order_relaxed) % ring.capacity];
+    // Aynı hücreye iki yazıcı ancak biri tam bir tur geride kaldıysa düşer: kısa bekleme
+    uint64_t version = slot.version.load(std::memory_order_relaxed);
+    while ((version & 1) != 0 ||
+           !slot.version.compare_exchange_weak(version, version + 1, std::memory_order_acquire)) {
+        version = slot.version.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.sequence = sequence;
+    slot.timestampMs = timestampMs;
+    slot.length = static_cast<uint8_t>(CopyLogText(slot.text, MAX_MESSAGE_BYTES, message.data(), message.size()));
+    slot.version.store(version + 2, std::memory_order_release);
+}
+
+std::vector<LogHistory::Entry> LogHistory::Snapshot() const {
+    const uint64_t end = nextSequence.load(std::memory_order_acquire);
+    const uint64_t begin = clearedBefore.load(std::memory_order_acquire);
+
+    std::vector<Entry> entries;
+    Slot copy;
+    for (size_t level = 0; level < rings.size(); ++level) {
+        const Ring& ring = rings[level];
+        const size_t used = static_cast<size_t>(std::min<uint64_t>(ring.head.load(std::memory_order_acquire), ring.capacity));
+        for (size_t i = 0; i < used; ++i) {
+            const Slot& slot = ring.slots[i];
+            const uint64_t before = slot.version.load(std::memory_order_acquire);
+            if ((before & 1) != 0 || before == 0) continue;
+            copy.sequence = slot.sequence;
+            copy.timestampMs = slot.timestampMs;
+            copy.length = std::min<uint8_t>(slot.length, static_cast<uint8_t>(MAX_MESSAGE_BYTES));
+            std::memcpy(copy.text, slot.text, copy.length);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // Kopyalarken üzerine yazıldıysa yarım kayıt alınmaz
+            if (slot.version.load(std::memory_order_relaxed) != before) continue;
+            if (copy.sequence < begin || copy.sequence >= end) continue;
+
+            entries.push_back(Entry{ copy.sequence, copy.timestampMs, static_cast<LogSeverity>(level),
+                                     std::string(copy.text, copy.length) });
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.sequence < b.sequence; });
+    return entries;
+}
+
+void LogHistory::Clear() {
+    clearedBefore.store(nextSequence.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+size_t LogHistory::GetCapacity(LogSeverity severity) const {
+    return rings[static_cast<size_t>(severity)].capacity;
+}
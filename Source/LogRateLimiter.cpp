@@ -0,0 +1,204 @@
+// Source/LogRateLimiter.cpp
+#include "../Headers/LogRateLimiter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace {
+
+// Canlı limiter'lar. Makrolardaki limiter'lar fonksiyon içi static: kayıt defteri
+// ilk limiter'ın kurulumu sırasında oluşur, dolayısıyla hepsinden sonra yıkılır
+std::mutex& RegistryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<LogRateLimiter*>& Registry() {
+    static std::vector<LogRateLimiter*> limiters;
+    return limiters;
+}
+
+void WriteSummary(AsyncLog& output, LogSeverity severity, const LogRateLimiter::Decision& decision) {
+    if (decision.repeated > 0) BinaryLog::Write(output, severity, LogRateLimiter::GetRepeatedFormat(), decision.repeated);
+    if (decision.suppressed > 0) BinaryLog::Write(output, severity, LogRateLimiter::GetSuppressedFormat(), decision.suppressed);
+}
+
+}  // namespace
+
+LogRateLimiter::LogRateLimiter(double burst, double ratePerSecond, int64_t summaryIntervalMs)
+    : burst(std::max(burst, 1.0)),
+      ratePerSecond(std::max(ratePerSecond, 0.0)),
+      summaryIntervalMs(summaryIntervalMs),
+      tokens(std::max(burst, 1.0)),
+      lastRefillMs(-1),
+      lastOutputMs(0),
+      lastHash(0),
+      hasLast(false),
+      repeated(0),
+      suppressed(0),
+      emittedTotal(0),
+      suppressedTotal(0),
+      output(nullptr),
+      severity(LogSeverity::Info) {
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+    Registry().push_back(this);
+}
+
+LogRateLimiter::~LogRateLimiter() {
+    std::lock_guard<std::mutex> registryLock(RegistryMutex());
+    auto& limiters = Registry();
+    limiters.erase(std::find(limiters.begin(), limiters.end(), this));
+    if (output) WriteSummary(*output, severity, TakePending(NowMs(), false));
+}
+
+LogRateLimiter::Decision LogRateLimiter::Admit(const BinaryLog::Encoder& message) {
+    return Admit(Hash(message), NowMs());
+}
+
+LogRateLimiter::Decision LogRateLimiter::Admit(const BinaryLog::Encoder& message, AsyncLog& summaryOutput,
+                                               LogSeverity summarySeverity) {
+    const uint64_t messageHash = Hash(message);
+    const int64_t nowMs = NowMs();
+    std::lock_guard<std::mutex> lock(mutex);
+    output = &summaryOutput;
+    severity = summarySeverity;
+    return AdmitLocked(messageHash, nowMs);
+}
+
+LogRateLimiter::Decision LogRateLimiter::Admit(uint64_t messageHash, int64_t nowMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return AdmitLocked(messageHash, nowMs);
+}
+
+LogRateLimiter::Decision LogRateLimiter::TakePending(int64_t nowMs, bool dueOnly) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Decision decision;
+    if (!dueOnly || SummaryDue(nowMs)) TakeSummary(decision, nowMs);
+    return decision;
+}
+
+void LogRateLimiter::FlushDue(AsyncLog& log, int64_t nowMs) {
+    std::lock_guard<std::mutex> registryLock(RegistryMutex());
+    for (LogRateLimiter* limiter : Registry()) {
+        Decision decision;
+        LogSeverity summarySeverity;
+        {
+            std::lock_guard<std::mutex> lock(limiter->mutex);
+            if (limiter->output != &log || !limiter->SummaryDue(nowMs)) continue;
+            summarySeverity = limiter->severity;
+            limiter->TakeSummary(decision, nowMs);
+        }
+        // AsyncLog::Push hiç beklemez: yazıcı thread'inden çağrılabilir
+        WriteSummary(log, summarySeverity, decision);
+    }
+}
+
+void LogRateLimiter::FlushAll(AsyncLog& log) {
+    const int64_t nowMs = NowMs();
+    std::lock_guard<std::mutex> registryLock(RegistryMutex());
+    for (LogRateLimiter* limiter : Registry()) {
+        Decision decision;
+        LogSeverity summarySeverity;
+        {
+            std::lock_guard<std::mutex> lock(limiter->mutex);
+            if (limiter->output != &log) continue;
+            limiter->output = nullptr;
+            summarySeverity = limiter->severity;
+            limiter->TakeSummary(decision, nowMs);
+        }
+        WriteSummary(log, summarySeverity, decision);
+    }
+}
+
+int64_t LogRateLimiter::NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+LogRateLimiter::Decision LogRateLimiter::AdmitLocked(uint64_t messageHash, int64_t nowMs) {
+    Refill(nowMs);
+    Decision decision;
+
+    // Aynı mesaj: tekrar sayılır. Uzun sessizlikten sonra gelen ilk tekrar yeni mesaj gibi yazılır
+    const bool repeat = hasLast && messageHash == lastHash &&
+                        (repeated > 0 || nowMs - lastOutputMs < summaryIntervalMs);
+    if (repeat || tokens < 1.0) {
+        if (repeat) {
+            ++repeated;
+        } else {
+            ++suppressed;
+        }
+        ++suppressedTotal;
+        if (SummaryDue(nowMs)) TakeSummary(decision, nowMs);
+        return decision;
+    }
+
+    tokens -= 1.0;
+    // Bekleyen özetler mesajdan önce yazılır; sıra korunur
+    TakeSummary(decision, nowMs);
+    decision.emit = true;
+    lastHash = messageHash;
+    hasLast = true;
+    lastOutputMs = nowMs;
+    ++emittedTotal;
+    return decision;
+}
+
+uint64_t LogRateLimiter::GetEmittedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return emittedTotal;
+}
+
+uint64_t LogRateLimiter::GetSuppressedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return suppressedTotal;
+}
+
+uint64_t LogRateLimiter::GetPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<uint64_t>(repeated) + suppressed;
+}
+
+uint64_t LogRateLimiter::Hash(const BinaryLog::Encoder& message) {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    const uint8_t* data = message.GetData();
+    for (size_t i = 0; i < message.GetLength(); ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+const BinaryLog::Format& LogRateLimiter::GetRepeatedFormat() {
+    static const BinaryLog::Format format("Son mesaj {} kez tekrarlandı");
+    return format;
+}
+
+const BinaryLog::Format& LogRateLimiter::GetSuppressedFormat() {
+    static const BinaryLog::Format format("{} mesaj hız sınırıyla bastırıldı");
+    return format;
+}
+
+void LogRateLimiter::Refill(int64_t nowMs) {
+    if (lastRefillMs < 0 || nowMs < lastRefillMs) {
+        lastRefillMs = nowMs;
+        return;
+    }
+    tokens = std::min(burst, tokens + static_cast<double>(nowMs - lastRefillMs) * ratePerSecond / 1000.0);
+    lastRefillMs = nowMs;
+}
+
+bool LogRateLimiter::SummaryDue(int64_t nowMs) const {
+    return (repeated > 0 || suppressed > 0) && nowMs - lastOutputMs >= summaryIntervalMs;
+}
+
+void LogRateLimiter::TakeSummary(Decision& decision, int64_t nowMs) {
+    if (repeated == 0 && suppressed == 0) return;
+    decision.repeated = repeated;
+    decision.suppressed = suppressed;
+    repeated = 0;
+    suppressed = 0;
+    lastOutputMs = nowMs;
+}
@@ -0,0 +1,300 @@
+// Source/LogRotation.cpp
+#include "../Headers/LogRotation.h"
+#include "../Headers/FastCompressor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <ostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+// "20240131-235959-123-000004"
+constexpr size_t STAMP_LENGTH = 26;
+
+std::string MakeStamp(int64_t nowMs, uint64_t sequence) {
+    const std::time_t time = static_cast<std::time_t>(nowMs / 1000);
+    std::tm local = {};
+#ifdef _WIN32
+    localtime_s(&local, &time);
+#else
+    localtime_r(&time, &local);
+#endif
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y%m%d-%H%M%S", &local);
+    char stamp[48];
+    std::snprintf(stamp, sizeof(stamp), "%s-%03d-%06llu", date, static_cast<int>(nowMs % 1000),
+                  static_cast<unsigned long long>(sequence % 1000000));
+    return stamp;
+}
+
+bool IsStamp(const std::string& text) {
+    if (text.size() != STAMP_LENGTH) return false;
+    for (size_t i = 0; i < text.size(); ++i) {
+        const bool dash = i == 8 || i == 15 || i == 19;
+        if (dash ? text[i] != '-' : !std::isdigit(static_cast<unsigned char>(text[i]))) return false;
+    }
+    return true;
+}
+
+bool EndsWith(const std::string& text, const std::string& suffix) {
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Arşiv adındaki zaman damgası; arşiv değilse boş
+std::string ArchiveStamp(const std::string& fileName, const std::string& stem, const std::string& extension) {
+    std::string name = fileName;
+    if (EndsWith(name, LogRotation::COMPRESSED_EXTENSION)) {
+        name.resize(name.size() - std::strlen(LogRotation::COMPRESSED_EXTENSION));
+    }
+    if (name.size() != stem.size() + 1 + STAMP_LENGTH + extension.size()) return std::string();
+    if (name.compare(0, stem.size(), stem) != 0 || name[stem.size()] != '.' || !EndsWith(name, extension)) {
+        return std::string();
+    }
+    const std::string stamp = name.substr(stem.size() + 1, STAMP_LENGTH);
+    return IsStamp(stamp) ? stamp : std::string();
+}
+
+// Damga başına arşiv dosyaları (sıkıştırma yarıda kaldıysa ikisi birden olabilir)
+std::map<std::string, std::vector<std::filesystem::path>> FindArchives(const std::string& activePath) {
+    std::map<std::string, std::vector<std::filesystem::path>> archives;
+    const std::filesystem::path active(activePath);
+    std::filesystem::path directory = active.parent_path();
+    if (directory.empty()) directory = ".";
+    const std::string stem = active.stem().string();
+    const std::string extension = active.extension().string();
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        if (!entry.is_regular_file(ec)) continue;
+        const std::string stamp = ArchiveStamp(entry.path().filename().string(), stem, extension);
+        if (!stamp.empty()) archives[stamp].push_back(entry.path());
+    }
+    return archives;
+}
+
+void LowerCurrentThreadPriority() {
+#ifdef _WIN32
+    // CPU ve disk G/Ç önceliğini birlikte düşürür
+    SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN);
+#elif defined(__linux__)
+    // Linux'ta PRIO_PROCESS + 0 yalnızca çağıran thread'i etkiler
+    setpriority(PRIO_PROCESS, 0, 19);
+#endif
+}
+
+template <typename T>
+void WriteRaw(std::ostream& out, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.write(bytes, sizeof(T));
+}
+
+template <typename T>
+bool ReadRaw(std::istream& in, T& value) {
+    char bytes[sizeof(T)];
+    if (!in.read(bytes, sizeof(T))) return false;
+    std::memcpy(&value, bytes, sizeof(T));
+    return true;
+}
+
+}  // namespace
+
+LogRotation::LogRotation()
+    : busy(false),
+      stopping(false),
+      sequence(0),
+      rotatedCount(0),
+      compressedCount(0) {
+    policy.maxBytes = 0;
+    policy.maxAgeMs = 0;
+}
+
+LogRotation::~LogRotation() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobCondition.notify_one();
+    if (compressor.joinable()) compressor.join();
+}
+
+void LogRotation::SetPolicy(const Policy& newPolicy) {
+    std::lock_guard<std::mutex> lock(mutex);
+    policy = newPolicy;
+    policy.retainCount = std::max(policy.retainCount, 0);
+}
+
+LogRotation::Policy LogRotation::GetPolicy() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return policy;
+}
+
+bool LogRotation::IsDue(uint64_t fileBytes, int64_t openedAtMs, int64_t nowMs) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Boş dosya döndürülmez: yaş sınırında boş arşivler birikmesin
+    if (fileBytes == 0) return false;
+    if (policy.maxBytes > 0 && fileBytes >= policy.maxBytes) return true;
+    return policy.maxAgeMs > 0 && nowMs - openedAtMs >= policy.maxAgeMs;
+}
+
+uint64_t LogRotation::GetRemainingBytes(uint64_t fileBytes) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (policy.maxBytes == 0) return UINT64_MAX;
+    return fileBytes >= policy.maxBytes ? 0 : policy.maxBytes - fileBytes;
+}
+
+bool LogRotation::Retire(const std::string& activePath, int64_t nowMs) {
+    const std::filesystem::path active(activePath);
+    std::unique_lock<std::mutex> lock(mutex);
+    const std::filesystem::path archive = active.parent_path() /
+        (active.stem().string() + "." + MakeStamp(nowMs, sequence++) + active.extension().string());
+
+    std::error_code ec;
+    std::filesystem::rename(active, archive, ec);
+    if (ec) return false;
+    ++rotatedCount;
+
+    // Sıkıştırma kapalıyken de temizlik arka planda yapılır
+    jobs.push_back({ activePath, archive });
+    if (!compressor.joinable()) compressor = std::thread(&LogRotation::CompressorLoop, this);
+    lock.unlock();
+    jobCondition.notify_one();
+    return true;
+}
+
+void LogRotation::WaitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idleCondition.wait(lock, [this] { return jobs.empty() && !busy; });
+}
+
+uint64_t LogRotation::GetRotatedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return rotatedCount;
+}
+
+uint64_t LogRotation::GetCompressedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return compressedCount;
+}
+
+std::vector<std::filesystem::path> LogRotation::ListArchives(const std::string& activePath) {
+    std::vector<std::filesystem::path> result;
+    for (const auto& [stamp, files] : FindArchives(activePath)) {
+        // Sıkıştırma biterken kısa bir an ikisi birden bulunur; ikisi de tam
+        const auto plain = std::find_if(files.begin(), files.end(), [](const std::filesystem::path& path) {
+            return path.extension() != COMPRESSED_EXTENSION;
+        });
+        result.push_back(plain != files.end() ? *plain : files.front());
+    }
+    return result;
+}
+
+bool LogRotation::CompressFile(const std::filesystem::path& source, const std::filesystem::path& destination) {
+    std::ifstream in(source, std::ios::binary);
+    if (!in) return false;
+    // Geçici adla yazılır: yarım arşiv hiçbir zaman .lmz adını taşımaz
+    std::filesystem::path temporary = destination;
+    temporary += ".tmp";
+    bool ok;
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+
+        std::vector<uint8_t> raw(CHUNK_BYTES);
+        std::vector<uint8_t> packed(FastCompressor::MaxCompressedSize(CHUNK_BYTES));
+        ok = static_cast<bool>(out);
+        while (ok && in) {
+            in.read(reinterpret_cast<char*>(raw.data()), static_cast<std::streamsize>(raw.size()));
+            const size_t rawSize = static_cast<size_t>(in.gcount());
+            if (rawSize == 0) break;
+            const size_t packedSize = FastCompressor::Compress(raw.data(), rawSize, packed.data(), packed.size());
+            WriteRaw(out, static_cast<uint32_t>(rawSize));
+            WriteRaw(out, static_cast<uint32_t>(packedSize));
+            out.write(reinterpret_cast<const char*>(packed.data()), static_cast<std::streamsize>(packedSize));
+            ok = packedSize != 0 && static_cast<bool>(out);
+        }
+        ok = ok && !in.bad();
+    }
+    std::error_code ec;
+    if (ok) std::filesystem::rename(temporary, destination, ec);
+    if (!ok || ec) {
+        std::filesystem::remove(temporary, ec);
+        return false;
+    }
+    return true;
+}
+
+bool LogRotation::DecompressFile(const std::filesystem::path& source, std::ostream& out) {
+    std::ifstream in(source, std::ios::binary);
+    char magic[sizeof(FILE_MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0) return false;
+
+    std::vector<uint8_t> raw(CHUNK_BYTES);
+    std::vector<uint8_t> packed(FastCompressor::MaxCompressedSize(CHUNK_BYTES));
+    uint32_t rawSize;
+    while (ReadRaw(in, rawSize)) {
+        uint32_t packedSize;
+        if (!ReadRaw(in, packedSize) || rawSize > raw.size() || packedSize > packed.size() ||
+            !in.read(reinterpret_cast<char*>(packed.data()), packedSize) ||
+            !FastCompressor::Decompress(packed.data(), packedSize, raw.data(), rawSize)) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(raw.data()), rawSize);
+    }
+    return in.eof() && in.gcount() == 0;
+}
+
+void LogRotation::CompressorLoop() {
+    LowerCurrentThreadPriority();
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        jobCondition.wait(lock, [this] { return stopping || !jobs.empty(); });
+        if (jobs.empty()) break;
+        const Job job = jobs.front();
+        jobs.pop_front();
+        const bool compress = policy.compress;
+        const int retainCount = policy.retainCount;
+        busy = true;
+        lock.unlock();
+
+        bool compressed = false;
+        if (compress) {
+            std::filesystem::path destination = job.archivePath;
+            destination += COMPRESSED_EXTENSION;
+            std::error_code ec;
+            compressed = CompressFile(job.archivePath, destination) && std::filesystem::remove(job.archivePath, ec);
+        }
+        EnforceRetention(job.activePath, retainCount);
+
+        lock.lock();
+        if (compressed) ++compressedCount;
+        busy = false;
+        if (jobs.empty()) idleCondition.notify_all();
+    }
+}
+
+void LogRotation::EnforceRetention(const std::string& activePath, int retainCount) {
+    auto archives = FindArchives(activePath);
+    std::error_code ec;
+    // Damgalar eskiden yeniye sıralı
+    while (archives.size() > static_cast<size_t>(retainCount)) {
+        for (const auto& path : archives.begin()->second) {
+            std::filesystem::remove(path, ec);
+            // Yarım kalmış sıkıştırma artığı
+            std::filesystem::path temporary = path;
+            temporary += std::string(COMPRESSED_EXTENSION) + ".tmp";
+            std::filesystem::remove(temporary, ec);
+        }
+        archives.erase(archives.begin());
+    }
+}
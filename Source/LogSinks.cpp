@@ -0,0 +1,204 @@
+// Source/LogSinks.cpp
+#include "../Headers/LogSinks.h"
+#include "../Headers/BinaryLog.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace {
+
+int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+void LogLinePrefix::Append(std::string& out, int64_t timestampMs, LogSeverity severity) {
+    // 1970 öncesi / bozuk zaman damgası negatif olabilir: aşağı yuvarlayarak böl
+    const int64_t millisecond = (timestampMs % 1000 + 1000) % 1000;
+    const int64_t second = (timestampMs - millisecond) / 1000;
+    if (second != cachedSecond) {
+        const std::time_t time = static_cast<std::time_t>(second);
+        std::tm local = {};
+#ifdef _WIN32
+        localtime_s(&local, &time);
+#else
+        localtime_r(&time, &local);
+#endif
+        std::strftime(date, sizeof(date), "[%Y-%m-%d %H:%M:%S", &local);
+        cachedSecond = second;
+    }
+    char millis[16];
+    std::snprintf(millis, sizeof(millis), ".%03d] [", static_cast<int>(millisecond));
+    out += date;
+    out += millis;
+    out += GetLogSeverityName(severity);
+    out += "] ";
+}
+
+const std::string& LogRecord::GetText() const {
+    if (!rendered) {
+        text.clear();
+        if (formatId == BinaryLog::TEXT_FORMAT) {
+            text.append(reinterpret_cast<const char*>(payload), length);
+        } else {
+            BinaryLog::Render(BinaryLog::GetFormat(formatId), payload, length, text);
+        }
+        rendered = true;
+    }
+    return text;
+}
+
+LogFileSink::LogFileSink()
+    : file(nullptr),
+      fileBytes(0),
+      fileOpenedMs(0),
+      limit(UINT64_MAX),
+      encoding(Encoding::Text) {
+}
+
+LogFileSink::~LogFileSink() {
+    WriteBatch();
+    if (file) std::fclose(file);
+}
+
+bool LogFileSink::Open(const std::string& newFilePath, Encoding newEncoding) {
+    WriteBatch();
+    if (file) {
+        std::fclose(file);
+        file = nullptr;
+    }
+    encoding = newEncoding;
+    filePath = newFilePath;
+    if (filePath.empty()) return true;
+    return OpenFile();
+}
+
+bool LogFileSink::OpenFile() {
+    definedFormats.assign(BinaryLog::MAX_FORMATS, false);
+    fileBytes = 0;
+    fileOpenedMs = NowMs();
+    file = std::fopen(filePath.c_str(), "ab");
+    if (!file) return false;
+    // Toplu yazım zaten tek fwrite: stdio'nun kendi buffer'ı araya girmesin
+    std::setvbuf(file, nullptr, _IONBF, 0);
+
+    // Var olan ikili dosyaya eklenirken başlık tekrar yazılmaz; biçimler yeniden tanımlanır
+    std::fseek(file, 0, SEEK_END);
+    fileBytes = static_cast<uint64_t>(std::max<long>(std::ftell(file), 0));
+    if (encoding == Encoding::Binary && fileBytes == 0) {
+        std::string header;
+        BinaryLog::AppendFileHeader(header);
+        std::fwrite(header.data(), 1, header.size(), file);
+        fileBytes = header.size();
+    }
+    return true;
+}
+
+void LogFileSink::Rotate() {
+    std::fclose(file);
+    file = nullptr;
+    // Taşınamazsa (ör. dosya başka süreçte açık) aynı dosyaya devam edilir
+    rotation.Retire(filePath, NowMs());
+    OpenFile();
+}
+
+void LogFileSink::UpdateLimit() {
+    limit = file ? rotation.GetRemainingBytes(fileBytes) : UINT64_MAX;
+    // Döndürülemediyse sınır yok sayılır; her kayıtta yeniden denenmez
+    if (limit == 0) limit = UINT64_MAX;
+}
+
+void LogFileSink::BeginBatch() {
+    if (file && rotation.IsDue(fileBytes, fileOpenedMs, NowMs())) Rotate();
+    UpdateLimit();
+}
+
+void LogFileSink::Consume(const LogRecord& record) {
+    if (encoding == Encoding::Binary) {
+        const uint16_t formatId = record.GetFormatId();
+        if (formatId != BinaryLog::TEXT_FORMAT && !definedFormats[formatId]) {
+            BinaryLog::AppendFormatDefinition(batch, formatId);
+            definedFormats[formatId] = true;
+        }
+        BinaryLog::AppendRecord(batch, record.GetTimestampMs(), record.GetSeverity(), formatId, record.GetPayload(),
+                                record.GetLength());
+    } else {
+        linePrefix.Append(batch, record.GetTimestampMs(), record.GetSeverity());
+        batch += record.GetText();
+        batch += '\n';
+    }
+
+    // Boyut sınırında batch bölünür: dosya sınırı en fazla bir kayıt aşar
+    if (batch.size() >= limit) {
+        WriteBatch();
+        if (file && rotation.IsDue(fileBytes, fileOpenedMs, record.GetTimestampMs())) Rotate();
+        UpdateLimit();
+    }
+}
+
+void LogFileSink::EndBatch() {
+    WriteBatch();
+}
+
+void LogFileSink::WriteBatch() {
+    if (file && !batch.empty()) {
+        std::fwrite(batch.data(), 1, batch.size(), file);
+        std::fflush(file);
+        fileBytes += batch.size();
+    }
+    batch.clear();
+}
+
+void LogHistorySink::Consume(const LogRecord& record) {
+    history.Append(record.GetSeverity(), record.GetText(), record.GetTimestampMs());
+}
+
+void LogDebuggerSink::Consume(const LogRecord& record) {
+    linePrefix.Append(lines, record.GetTimestampMs(), record.GetSeverity());
+    lines += record.GetText();
+    lines += '\n';
+}
+
+void LogDebuggerSink::EndBatch() {
+    if (lines.empty()) return;
+    if (stream) {
+        std::fwrite(lines.data(), 1, lines.size(), stream);
+        std::fflush(stream);
+    } else {
+#ifdef _WIN32
+        OutputDebugStringA(lines.c_str());
+#else
+        std::fwrite(lines.data(), 1, lines.size(), stderr);
+#endif
+    }
+    lines.clear();
+}
+
+LogMetricsSink::LogMetricsSink(LogSeverity minimumSeverity)
+    : LogSink(minimumSeverity),
+      payloadBytes(0) {
+    for (auto& count : counts) count.store(0, std::memory_order_relaxed);
+}
+
+void LogMetricsSink::Consume(const LogRecord& record) {
+    counts[static_cast<size_t>(record.GetSeverity())].fetch_add(1, std::memory_order_relaxed);
+    payloadBytes.fetch_add(record.GetLength(), std::memory_order_relaxed);
+}
+
+uint64_t LogMetricsSink::GetCount(LogSeverity severity) const {
+    return counts[static_cast<size_t>(severity)].load(std::memory_order_relaxed);
+}
+
+uint64_t LogMetricsSink::GetTotalCount() const {
+    uint64_t total = 0;
+    for (const auto& count : counts) total += count.load(std::memory_order_relaxed);
+    return total;
+}
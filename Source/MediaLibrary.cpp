@@ -0,0 +1,614 @@
+// Source/MediaLibrary.cpp
+#include "../Headers/MediaLibrary.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cwctype>
+#include <fstream>
+#include <thread>
+#include <unordered_set>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
+static std::string PathToUtf8(const std::filesystem::path& filePath) {
+    const std::u8string text = filePath.generic_u8string();
+    return std::string(text.begin(), text.end());
+}
+
+static std::filesystem::path PathFromUtf8(const std::string& text) {
+    return std::filesystem::path(std::u8string(text.begin(), text.end()));
+}
+
+// [0, count) aralığını worker thread'lere eşit parçalar halinde dağıt
+template <typename Function>
+static void ParallelFor(size_t count, unsigned workers, size_t minimumPerWorker, Function function) {
+    workers = static_cast<unsigned>(std::min<size_t>(workers, (count + minimumPerWorker - 1) / minimumPerWorker));
+    if (workers <= 1) {
+        function(0, count);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers);
+    const size_t chunk = (count + workers - 1) / workers;
+    for (unsigned w = 0; w < workers; ++w) {
+        const size_t begin = w * chunk;
+        const size_t end = std::min(count, begin + chunk);
+        if (begin >= end) break;
+        threads.emplace_back([&function, begin, end]() { function(begin, end); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// İkili depo kodlaması (little endian, uzunluk önekli string'ler)
+// ---------------------------------------------------------------------------
+
+class StoreWriter {
+public:
+    std::string buffer;
+
+    template <typename T>
+    void Put(T value) {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        buffer.append(bytes, sizeof(T));
+    }
+
+    void PutString(const std::string& text) {
+        const uint16_t length = static_cast<uint16_t>(std::min<size_t>(text.size(), 0xFFFF));
+        Put(length);
+        buffer.append(text.data(), length);
+    }
+};
+
+// Boş dizgelerle bir v1 kaydı; dosyadaki kayıt sayısının üst sınırı için
+static constexpr size_t MIN_STORE_RECORD_BYTES = 2 + 8 + 8 + 8 + 1 + 1 + 2 + 4 + 4 + 8 + 8 + 4 + 2 + 8 + 8 + 2;
+
+class StoreReader {
+public:
+    StoreReader(const std::string& data) : data(data), position(0), failed(false) {}
+
+    template <typename T>
+    T Get() {
+        T value{};
+        if (position + sizeof(T) > data.size()) {
+            failed = true;
+            return value;
+        }
+        std::memcpy(&value, data.data() + position, sizeof(T));
+        position += sizeof(T);
+        return value;
+    }
+
+    std::string GetString() {
+        const uint16_t length = Get<uint16_t>();
+        if (failed || position + length > data.size()) {
+            failed = true;
+            return std::string();
+        }
+        std::string text = data.substr(position, length);
+        position += length;
+        return text;
+    }
+
+    bool Failed() const { return failed; }
+    size_t GetRemaining() const { return data.size() - position; }
+
+private:
+    const std::string& data;
+    size_t position;
+    bool failed;
+};
+
+// ---------------------------------------------------------------------------
+
+MediaLibrary::MediaLibrary()
+    : workerCount(std::clamp(std::thread::hardware_concurrency(), 1u, 8u))
+    , hashIndexDirty(true) {
+}
+
+MediaLibrary::~MediaLibrary() {
+}
+
+std::string MediaLibrary::MakeKey(const std::filesystem::path& filePath) {
+    return PathToUtf8(filePath.lexically_normal());
+}
+
+bool MediaLibrary::ReadFileIdentity(const std::filesystem::path& filePath, FileIdentity& identity) {
+#ifdef _WIN32
+    HANDLE hFile = CreateFileW(filePath.c_str(), FILE_READ_ATTRIBUTES,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE) return false;
+
+    BY_HANDLE_FILE_INFORMATION fileInfo;
+    const bool success = GetFileInformationByHandle(hFile, &fileInfo) != FALSE;
+    CloseHandle(hFile);
+    if (!success || (fileInfo.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) return false;
+
+    identity.size = (static_cast<uint64_t>(fileInfo.nFileSizeHigh) << 32) | fileInfo.nFileSizeLow;
+    identity.modifiedTime = static_cast<int64_t>((static_cast<uint64_t>(fileInfo.ftLastWriteTime.dwHighDateTime) << 32) |
+                                                 fileInfo.ftLastWriteTime.dwLowDateTime);
+    identity.fileId = (static_cast<uint64_t>(fileInfo.nFileIndexHigh) << 32) | fileInfo.nFileIndexLow;
+    return true;
+#else
+    struct stat fileStat;
+    if (stat(filePath.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) return false;
+
+    identity.size = static_cast<uint64_t>(fileStat.st_size);
+    identity.modifiedTime = static_cast<int64_t>(fileStat.st_mtim.tv_sec) * 1000000000LL + fileStat.st_mtim.tv_nsec;
+    identity.fileId = static_cast<uint64_t>(fileStat.st_ino);
+    return true;
+#endif
+}
+
+bool MediaLibrary::IsLibraryExtension(const std::filesystem::path& filePath) {
+    if (ContainerProbe::IsProbeableExtension(filePath)) return true;
+
+    // WMV probe edilemez ama kütüphanede (DirectShow ile oynatılmak üzere) yer alır
+    std::wstring extension = filePath.extension().wstring();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::towlower);
+    return extension == L".wmv";
+}
+
+MediaLibrary::ScanStats MediaLibrary::Rescan(const std::filesystem::path& directory, bool recursive) {
+    const auto startTime = std::chrono::steady_clock::now();
+    ScanStats stats;
+
+    // 1. Dizini listele (sadece isimler; stat işi paralel yapılacak)
+    std::vector<std::filesystem::path> paths;
+    std::error_code ec;
+    if (recursive) {
+        for (auto it = std::filesystem::recursive_directory_iterator(directory, ec);
+             !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+            if (IsLibraryExtension(it->path())) paths.push_back(it->path());
+        }
+    } else {
+        for (auto it = std::filesystem::directory_iterator(directory, ec);
+             !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+            if (IsLibraryExtension(it->path())) paths.push_back(it->path());
+        }
+    }
+
+    // 2. Kimlikleri paralel oku ve mevcut kayıtlarla karşılaştır
+    std::vector<FileIdentity> identities(paths.size());
+    std::vector<std::string> keys(paths.size());
+    std::vector<uint8_t> status(paths.size(), 0);   // 0 = yok, 1 = aynı, 2 = yeni, 3 = değişti
+    ParallelFor(paths.size(), workerCount, 256, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            keys[i] = MakeKey(paths[i]);
+            status[i] = ReadFileIdentity(paths[i], identities[i]) ? 2 : 0;
+        }
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < paths.size(); ++i) {
+            if (status[i] == 0) continue;
+            auto it = entries.find(keys[i]);
+            if (it != entries.end()) {
+                status[i] = (it->second.identity == identities[i]) ? 1 : 3;
+            }
+        }
+    }
+
+    // 3. Sadece yeni veya değişmiş dosyaları paralel probe et
+    std::vector<size_t> toProbe;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (status[i] >= 2) toProbe.push_back(i);
+    }
+    std::vector<Entry> probed(toProbe.size());
+    ParallelFor(toProbe.size(), workerCount, 8, [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j) {
+            const size_t i = toProbe[j];
+            probed[j].path = paths[i];
+            probed[j].identity = identities[i];
+            probed[j].probed = ContainerProbe::Probe(paths[i], probed[j].info);
+        }
+    });
+
+    // 4. Sonuçları birleştir; dizinde artık olmayan kayıtları sil
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t j = 0; j < toProbe.size(); ++j) {
+        const size_t i = toProbe[j];
+        if (status[i] == 2) {
+            ++stats.added;
+        } else {
+            ++stats.changed;
+        }
+        // Dosya değiştiyse eski thumbnail geçersizdir
+        entries[keys[i]] = std::move(probed[j]);
+    }
+
+    std::unordered_set<std::string> seen;
+    seen.reserve(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (status[i] != 0) seen.insert(keys[i]);
+        if (status[i] == 1) ++stats.unchanged;
+    }
+
+    // "C:/Videos/" ile "C:/Videos" aynı kapsam: sondaki ayırıcı kayıtların üst dizininde yok
+    const std::filesystem::path normalizedDirectory = (directory.lexically_normal() / "").parent_path();
+    const std::string directoryPrefix = PathToUtf8(normalizedDirectory / "");
+    for (auto it = entries.begin(); it != entries.end();) {
+        const std::filesystem::path parent = it->second.path.lexically_normal().parent_path();
+        const bool inScope = (parent == normalizedDirectory) ||
+                             (recursive && it->first.rfind(directoryPrefix, 0) == 0);
+        if (inScope && seen.find(it->first) == seen.end()) {
+            it = entries.erase(it);
+            ++stats.removed;
+        } else {
+            ++it;
+        }
+    }
+
+    if (stats.added + stats.changed + stats.removed > 0) hashIndexDirty = true;
+    stats.total = seen.size();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return stats;
+}
+
+std::vector<MediaLibrary::Update> MediaLibrary::ApplyChanges(const std::vector<DirectoryWatcher::Change>& changes) {
+    std::vector<Update> updates;
+    updates.reserve(changes.size());
+
+    for (const auto& change : changes) {
+        std::error_code ec;
+        if (std::filesystem::is_directory(change.path, ec)) {
+            // Olay kuyruğu taştı; bu klasör için tek seferlik tam tarama
+            Rescan(change.path);
+            updates.push_back({ Update::Kind::Rescanned, change.path, {} });
+            continue;
+        }
+        if (change.type == DirectoryWatcher::ChangeType::Removed && !IsLibraryExtension(change.path)) {
+            // İzlenen klasörün kendisi silindi: boş tarama altındaki kayıtları düşürür
+            if (Rescan(change.path).removed > 0) updates.push_back({ Update::Kind::Rescanned, change.path, {} });
+            continue;
+        }
+
+        Update update;
+        switch (change.type) {
+            case DirectoryWatcher::ChangeType::Added:
+            case DirectoryWatcher::ChangeType::Modified:
+                if (RefreshEntry(change.path, update)) updates.push_back(update);
+                break;
+
+            case DirectoryWatcher::ChangeType::Removed:
+                if (RemoveEntry(change.path)) updates.push_back({ Update::Kind::Removed, change.path, {} });
+                break;
+
+            case DirectoryWatcher::ChangeType::Renamed: {
+                FileIdentity identity;
+                const bool readable = ReadFileIdentity(change.path, identity);
+                bool moved = false;
+                if (readable && IsLibraryExtension(change.path)) {
+                    // Aynı dosya yeni isimle: probe ve thumbnail korunur
+                    std::lock_guard<std::mutex> lock(mutex);
+                    auto it = entries.find(MakeKey(change.oldPath));
+                    if (it != entries.end() && it->second.identity == identity) {
+                        Entry entry = std::move(it->second);
+                        entries.erase(it);
+                        entry.path = change.path;
+                        entries[MakeKey(change.path)] = std::move(entry);
+                        hashIndexDirty = true;
+                        moved = true;
+                    }
+                }
+                if (moved) {
+                    updates.push_back({ Update::Kind::Renamed, change.path, change.oldPath });
+                    break;
+                }
+                if (RemoveEntry(change.oldPath)) {
+                    updates.push_back({ Update::Kind::Removed, change.oldPath, {} });
+                }
+                if (RefreshEntry(change.path, update)) updates.push_back(update);
+                break;
+            }
+        }
+    }
+    return updates;
+}
+
+bool MediaLibrary::RefreshEntry(const std::filesystem::path& filePath, Update& update) {
+    if (!IsLibraryExtension(filePath)) return false;
+
+    Entry entry;
+    if (!ReadFileIdentity(filePath, entry.identity)) {
+        // Olay geldi ama dosya artık yok
+        if (RemoveEntry(filePath)) {
+            update = { Update::Kind::Removed, filePath, {} };
+            return true;
+        }
+        return false;
+    }
+
+    const std::string key = MakeKey(filePath);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it != entries.end() && it->second.identity == entry.identity) return false;
+    }
+
+    // Probe kilit dışında yapılır
+    entry.path = filePath;
+    entry.probed = ContainerProbe::Probe(filePath, entry.info);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const bool existed = entries.find(key) != entries.end();
+    entries[key] = std::move(entry);
+    hashIndexDirty = true;
+    update = { existed ? Update::Kind::Changed : Update::Kind::Added, filePath, {} };
+    return true;
+}
+
+bool MediaLibrary::RemoveEntry(const std::filesystem::path& filePath) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (entries.erase(MakeKey(filePath)) == 0) return false;
+    hashIndexDirty = true;
+    return true;
+}
+
+bool MediaLibrary::GetEntry(const std::filesystem::path& filePath, Entry& entry) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(MakeKey(filePath));
+    if (it == entries.end()) return false;
+    entry = it->second;
+    return true;
+}
+
+std::vector<MediaLibrary::Entry> MediaLibrary::GetEntries() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<Entry> result;
+    result.reserve(entries.size());
+    for (const auto& pair : entries) {
+        result.push_back(pair.second);
+    }
+    std::sort(result.begin(), result.end(), [](const Entry& a, const Entry& b) { return a.path < b.path; });
+    return result;
+}
+
+size_t MediaLibrary::GetEntryCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+bool MediaLibrary::GetVideoInfo(const std::filesystem::path& filePath, ContainerProbe::Result& info) const {
+    FileIdentity identity;
+    if (!ReadFileIdentity(filePath, identity)) return false;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(MakeKey(filePath));
+    if (it == entries.end() || !it->second.probed || it->second.identity != identity) return false;
+    info = it->second.info;
+    return true;
+}
+
+bool MediaLibrary::SetThumbnail(const std::filesystem::path& filePath, const std::filesystem::path& thumbnailPath) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(MakeKey(filePath));
+    if (it == entries.end()) return false;
+    it->second.thumbnailPath = thumbnailPath;
+    return true;
+}
+
+bool MediaLibrary::SetAnimatedPreview(const std::filesystem::path& filePath, const std::filesystem::path& previewPath) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(MakeKey(filePath));
+    if (it == entries.end()) return false;
+    it->second.previewPath = previewPath;
+    return true;
+}
+
+bool MediaLibrary::SetFrameHashes(const std::filesystem::path& filePath, const std::vector<uint64_t>& frameHashes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(MakeKey(filePath));
+    if (it == entries.end()) return false;
+    it->second.frameHashes = frameHashes;
+    hashIndexDirty = true;
+    return true;
+}
+
+void MediaLibrary::RebuildHashIndex() const {
+    // mutex tutulurken çağrılır
+    if (!hashIndexDirty) return;
+
+    hashIndex.Clear();
+    hashOwners.clear();
+    for (const auto& pair : entries) {
+        for (uint64_t hash : pair.second.frameHashes) {
+            hashIndex.Insert(hash, static_cast<uint32_t>(hashOwners.size()));
+            hashOwners.push_back(&pair.second);
+        }
+    }
+    hashIndexDirty = false;
+}
+
+bool MediaLibrary::FindDuplicate(const std::filesystem::path& filePath, const std::vector<uint64_t>& frameHashes,
+                                 Entry& original, int maxDistance) const {
+    if (frameHashes.empty()) return false;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    RebuildHashIndex();
+
+    // Adaylar: herhangi bir karesi yakın olan, thumbnail'i hazır kayıtlar
+    const std::string key = MakeKey(filePath);
+    std::vector<HashIndex::Match> matches;
+    std::unordered_set<const Entry*> candidates;
+    for (uint64_t hash : frameHashes) {
+        matches.clear();
+        hashIndex.Query(hash, maxDistance, matches);
+        for (const auto& match : matches) {
+            const Entry* candidate = hashOwners[match.id];
+            if (!candidate->thumbnailPath.empty() && MakeKey(candidate->path) != key) {
+                candidates.insert(candidate);
+            }
+        }
+    }
+
+    for (const Entry* candidate : candidates) {
+        if (PerceptualHash::IsDuplicate(frameHashes, candidate->frameHashes, maxDistance)) {
+            original = *candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<std::vector<std::filesystem::path>> MediaLibrary::FindDuplicateGroups(int maxDistance) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    RebuildHashIndex();
+
+    // Kayıtlar üzerinde union-find
+    std::unordered_map<const Entry*, size_t> slots;
+    std::vector<const Entry*> owners;
+    for (const Entry* owner : hashOwners) {
+        if (slots.emplace(owner, owners.size()).second) owners.push_back(owner);
+    }
+    std::vector<size_t> parent(owners.size());
+    for (size_t i = 0; i < parent.size(); ++i) parent[i] = i;
+    auto find = [&parent](size_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    std::vector<HashIndex::Match> matches;
+    for (size_t i = 0; i < owners.size(); ++i) {
+        for (uint64_t hash : owners[i]->frameHashes) {
+            matches.clear();
+            hashIndex.Query(hash, maxDistance, matches);
+            for (const auto& match : matches) {
+                const size_t j = slots[hashOwners[match.id]];
+                if (j <= i || find(i) == find(j)) continue;
+                if (PerceptualHash::IsDuplicate(owners[i]->frameHashes, owners[j]->frameHashes, maxDistance)) {
+                    parent[find(j)] = find(i);
+                }
+            }
+        }
+    }
+
+    std::unordered_map<size_t, std::vector<std::filesystem::path>> groups;
+    for (size_t i = 0; i < owners.size(); ++i) {
+        groups[find(i)].push_back(owners[i]->path);
+    }
+
+    std::vector<std::vector<std::filesystem::path>> result;
+    for (auto& pair : groups) {
+        if (pair.second.size() < 2) continue;
+        std::sort(pair.second.begin(), pair.second.end());
+        result.push_back(std::move(pair.second));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+bool MediaLibrary::Save(const std::filesystem::path& storePath) const {
+    StoreWriter writer;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        writer.buffer.reserve(64 + entries.size() * 128);
+        writer.Put(STORE_MAGIC);
+        writer.Put(STORE_VERSION);
+        writer.Put(static_cast<uint32_t>(entries.size()));
+
+        for (const auto& pair : entries) {
+            const Entry& entry = pair.second;
+            writer.PutString(PathToUtf8(entry.path));
+            writer.Put(entry.identity.size);
+            writer.Put(entry.identity.modifiedTime);
+            writer.Put(entry.identity.fileId);
+            writer.Put(static_cast<uint8_t>(entry.probed ? 1 : 0));
+            writer.Put(static_cast<uint8_t>(entry.info.container));
+            writer.PutString(entry.info.codec);
+            writer.Put(static_cast<int32_t>(entry.info.width));
+            writer.Put(static_cast<int32_t>(entry.info.height));
+            writer.Put(entry.info.duration);
+            writer.Put(entry.info.fps);
+            writer.Put(static_cast<int32_t>(entry.info.bitDepth));
+            writer.PutString(entry.info.colorSpace);
+            writer.Put(entry.info.frameCount);
+            writer.Put(entry.info.keyframeCount);
+            writer.PutString(PathToUtf8(entry.thumbnailPath));
+            writer.Put(static_cast<uint8_t>(std::min<size_t>(entry.frameHashes.size(), 0xFF)));
+            for (size_t h = 0; h < entry.frameHashes.size() && h < 0xFF; ++h) {
+                writer.Put(entry.frameHashes[h]);
+            }
+            writer.PutString(PathToUtf8(entry.previewPath));
+        }
+    }
+
+    // Yarım kalmış yazma mevcut depoyu bozmasın diye önce geçici dosyaya yaz
+    std::filesystem::path tempPath = storePath;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+        file.write(writer.buffer.data(), static_cast<std::streamsize>(writer.buffer.size()));
+        if (!file.good()) return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, storePath, ec);
+    return !ec;
+}
+
+bool MediaLibrary::Load(const std::filesystem::path& storePath) {
+    std::ifstream file(storePath, std::ios::binary);
+    if (!file.is_open()) return false;
+    const std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    StoreReader reader(data);
+    if (reader.Get<uint32_t>() != STORE_MAGIC) return false;
+    const uint32_t version = reader.Get<uint32_t>();
+    if (version < 1 || version > STORE_VERSION) return false;
+    const uint32_t count = reader.Get<uint32_t>();
+
+    // Bozuk sayı dev bir ayırmaya yol açmasın: kalan bayt sayısıyla sınırla
+    std::unordered_map<std::string, Entry> loaded;
+    loaded.reserve(std::min<size_t>(count, reader.GetRemaining() / MIN_STORE_RECORD_BYTES));
+    for (uint32_t i = 0; i < count && !reader.Failed(); ++i) {
+        Entry entry;
+        entry.path = PathFromUtf8(reader.GetString());
+        entry.identity.size = reader.Get<uint64_t>();
+        entry.identity.modifiedTime = reader.Get<int64_t>();
+        entry.identity.fileId = reader.Get<uint64_t>();
+        entry.probed = reader.Get<uint8_t>() != 0;
+        entry.info.container = static_cast<ContainerProbe::Container>(reader.Get<uint8_t>());
+        entry.info.codec = reader.GetString();
+        entry.info.width = reader.Get<int32_t>();
+        entry.info.height = reader.Get<int32_t>();
+        entry.info.duration = reader.Get<double>();
+        entry.info.fps = reader.Get<double>();
+        entry.info.bitDepth = reader.Get<int32_t>();
+        entry.info.colorSpace = reader.GetString();
+        entry.info.frameCount = reader.Get<uint64_t>();
+        entry.info.keyframeCount = reader.Get<uint64_t>();
+        entry.thumbnailPath = PathFromUtf8(reader.GetString());
+        if (version >= 2) {
+            const uint8_t hashCount = reader.Get<uint8_t>();
+            for (uint8_t h = 0; h < hashCount && !reader.Failed(); ++h) {
+                entry.frameHashes.push_back(reader.Get<uint64_t>());
+            }
+        }
+        if (version >= 3) {
+            entry.previewPath = PathFromUtf8(reader.GetString());
+        }
+        loaded.emplace(MakeKey(entry.path), std::move(entry));
+    }
+    if (reader.Failed()) return false;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.swap(loaded);
+    hashIndexDirty = true;
+    return true;
+}
@@ -0,0 +1,107 @@
+// Source/MemoryAccounting.cpp
+#include "../Headers/MemoryAccounting.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+std::array<MemoryAccounting::Counter, MemoryAccounting::CATEGORY_COUNT> MemoryAccounting::counters;
+
+MemoryAccounting::CategoryUsage MemoryAccounting::GetUsage(MemoryCategory category) {
+    const Counter& counter = counters[static_cast<size_t>(category)];
+    CategoryUsage usage;
+    usage.currentBytes = counter.current.load(std::memory_order_relaxed);
+    usage.peakBytes = counter.peak.load(std::memory_order_relaxed);
+    usage.allocations = counter.allocations.load(std::memory_order_relaxed);
+    return usage;
+}
+
+MemoryAccounting::Snapshot MemoryAccounting::TakeSnapshot() {
+    // Kategoriler ayrı ayrı okunur; toplam tam tutarlı olmak zorunda değil
+    Snapshot snapshot;
+    snapshot.trackedBytes = 0;
+    for (size_t i = 0; i < CATEGORY_COUNT; ++i) {
+        snapshot.categories[i] = GetUsage(static_cast<MemoryCategory>(i));
+        snapshot.trackedBytes += snapshot.categories[i].currentBytes;
+    }
+    return snapshot;
+}
+
+void MemoryAccounting::ResetPeaks() {
+    for (Counter& counter : counters) {
+        counter.peak.store(counter.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+const char* MemoryAccounting::GetCategoryName(MemoryCategory category) {
+    switch (category) {
+        case MemoryCategory::Frames:     return "Frames";
+        case MemoryCategory::ImageCache: return "ImageCache";
+        case MemoryCategory::Thumbnails: return "Thumbnails";
+        case MemoryCategory::Decoder:    return "Decoder";
+        case MemoryCategory::Logging:    return "Logging";
+        case MemoryCategory::Scratch:    return "Scratch";
+        default:                         return "Unknown";
+    }
+}
+
+bool MemoryAccounting::ParseSmapsRollup(const std::string& text, ProcessMemory& memory) {
+    memory = ProcessMemory();
+    bool foundRss = false;
+
+    // Satır biçimi: "Anahtar:     1234 kB"
+    std::istringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line)) {
+        const size_t colon = line.find(':');
+        if (colon == std::string::npos) continue;
+
+        const char* value = line.c_str() + colon + 1;
+        char* end = nullptr;
+        const unsigned long long kilobytes = std::strtoull(value, &end, 10);
+        if (end == value) continue;
+        const size_t bytes = static_cast<size_t>(kilobytes) * 1024;
+
+        const std::string key = line.substr(0, colon);
+        if (key == "Rss") {
+            memory.residentBytes = bytes;
+            foundRss = true;
+        } else if (key == "Private_Clean" || key == "Private_Dirty") {
+            memory.privateBytes += bytes;
+        } else if (key == "Anonymous") {
+            memory.anonymousBytes = bytes;
+        } else if (key == "Swap") {
+            memory.swapBytes = bytes;
+        }
+    }
+    return foundRss;
+}
+
+bool MemoryAccounting::QueryProcessMemory(ProcessMemory& memory) {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS_EX counters = {};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters),
+                              sizeof(counters))) {
+        return false;
+    }
+    memory = ProcessMemory();
+    memory.residentBytes = counters.WorkingSetSize;
+    memory.privateBytes = counters.PrivateUsage;
+    // Windows commit'i dosyaya dayanmayan özel sayfalardır
+    memory.anonymousBytes = counters.PrivateUsage;
+    return true;
+#else
+    // smaps_rollup tek okumada tüm eşlemelerin toplamını verir (smaps'ı dolaşmaktan çok ucuz)
+    std::ifstream file("/proc/self/smaps_rollup");
+    if (!file) return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return ParseSmapsRollup(buffer.str(), memory);
+#endif
+}
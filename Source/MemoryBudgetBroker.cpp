@@ -0,0 +1,267 @@
+// Source/MemoryBudgetBroker.cpp
+#include "../Headers/MemoryBudgetBroker.h"
+
+#include <algorithm>
+#include <numeric>
+
+MemoryBudgetBroker::MemoryBudgetBroker(size_t totalBudget)
+    : nextId(1), totalBudget(totalBudget), usedBytes(0),
+      usagePressure(MemoryPressure::Normal), externalPressure(MemoryPressure::Normal) {
+}
+
+MemoryBudgetBroker& MemoryBudgetBroker::GetInstance() {
+    static MemoryBudgetBroker instance(200 * 1024 * 1024);   // MemoryOptimizer varsayılan limiti
+    return instance;
+}
+
+MemoryBudgetBroker::ConsumerId MemoryBudgetBroker::Register(Consumer consumer) {
+    ConsumerId id;
+    std::vector<ConsumerId> changed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        id = nextId++;
+        consumer.desiredBytes = std::max(consumer.desiredBytes, consumer.minimumBytes);
+        consumers.push_back({ id, std::move(consumer), 0, MemoryPressure::Normal, false });
+        changed = RebalanceLocked();
+    }
+    Dispatch(changed);
+    return id;
+}
+
+void MemoryBudgetBroker::Unregister(ConsumerId id) {
+    std::vector<ConsumerId> changed;
+    {
+        // Süren bir bildirimin bitmesini bekle
+        std::lock_guard<std::recursive_mutex> dispatchLock(dispatchMutex);
+        std::lock_guard<std::mutex> lock(mutex);
+        consumers.erase(std::remove_if(consumers.begin(), consumers.end(),
+                                       [id](const Entry& entry) { return entry.id == id; }),
+                        consumers.end());
+        changed = RebalanceLocked();
+    }
+    Dispatch(changed);
+}
+
+void MemoryBudgetBroker::UpdateDemand(ConsumerId id, size_t minimumBytes, size_t desiredBytes) {
+    std::vector<ConsumerId> changed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (Entry& entry : consumers) {
+            if (entry.id == id) {
+                entry.consumer.minimumBytes = minimumBytes;
+                entry.consumer.desiredBytes = std::max(desiredBytes, minimumBytes);
+            }
+        }
+        changed = RebalanceLocked();
+    }
+    Dispatch(changed);
+}
+
+void MemoryBudgetBroker::SetTotalBudget(size_t bytes) {
+    std::vector<ConsumerId> changed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (totalBudget == bytes) return;
+        totalBudget = bytes;
+        changed = RebalanceLocked();
+    }
+    Dispatch(changed);
+}
+
+void MemoryBudgetBroker::UpdateUsage(size_t bytes) {
+    std::vector<ConsumerId> changed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        usedBytes = bytes;
+        const double ratio = totalBudget > 0 ? static_cast<double>(bytes) / static_cast<double>(totalBudget) : 1.0;
+
+        // Seviye, giriş eşiğini geçince yükselir ve ancak daha düşük çıkış
+        // eşiğinin altına inince düşer; eşik etrafında salınım bildirim üretmez
+        switch (usagePressure) {
+            case MemoryPressure::Normal:
+                if (ratio >= CRITICAL_ENTER) usagePressure = MemoryPressure::Critical;
+                else if (ratio >= MODERATE_ENTER) usagePressure = MemoryPressure::Moderate;
+                break;
+            case MemoryPressure::Moderate:
+                if (ratio >= CRITICAL_ENTER) usagePressure = MemoryPressure::Critical;
+                else if (ratio < MODERATE_EXIT) usagePressure = MemoryPressure::Normal;
+                break;
+            case MemoryPressure::Critical:
+                if (ratio < MODERATE_EXIT) usagePressure = MemoryPressure::Normal;
+                else if (ratio < CRITICAL_EXIT) usagePressure = MemoryPressure::Moderate;
+                break;
+        }
+        changed = RebalanceLocked();
+    }
+    Dispatch(changed);
+}
+
+void MemoryBudgetBroker::SetExternalPressure(MemoryPressure pressure) {
+    std::vector<ConsumerId> changed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (externalPressure == pressure) return;
+        externalPressure = pressure;
+        changed = RebalanceLocked();
+    }
+    Dispatch(changed);
+}
+
+void MemoryBudgetBroker::Rebalance() {
+    std::vector<ConsumerId> changed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        changed = RebalanceLocked();
+    }
+    Dispatch(changed);
+}
+
+size_t MemoryBudgetBroker::GetGrant(ConsumerId id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const Entry& entry : consumers) {
+        if (entry.id == id) return entry.grant;
+    }
+    return 0;
+}
+
+size_t MemoryBudgetBroker::GetAvailableFor(ConsumerId id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    const MemoryPressure pressure = EffectivePressure();
+    auto self = std::find_if(consumers.begin(), consumers.end(), [id](const Entry& entry) { return entry.id == id; });
+    if (pressure == MemoryPressure::Critical) return self != consumers.end() ? self->consumer.minimumBytes : 0;
+
+    size_t available = pressure == MemoryPressure::Moderate
+        ? static_cast<size_t>(static_cast<double>(totalBudget) * MODERATE_BUDGET_SCALE)
+        : totalBudget;
+    const int priority = self != consumers.end() ? self->consumer.priority : 0;
+    for (const Entry& entry : consumers) {
+        if (entry.id == id) continue;
+        size_t reserved = entry.consumer.minimumBytes;
+        if (entry.consumer.priority > priority) reserved = entry.consumer.desiredBytes;
+        available = available > reserved ? available - reserved : 0;
+    }
+    return available;
+}
+
+size_t MemoryBudgetBroker::GetTotalBudget() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return totalBudget;
+}
+
+MemoryPressure MemoryBudgetBroker::GetPressure() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return EffectivePressure();
+}
+
+const char* MemoryBudgetBroker::GetPressureName(MemoryPressure pressure) {
+    switch (pressure) {
+        case MemoryPressure::Normal:   return "Normal";
+        case MemoryPressure::Moderate: return "Moderate";
+        case MemoryPressure::Critical: return "Critical";
+        default:                       return "Unknown";
+    }
+}
+
+MemoryPressure MemoryBudgetBroker::EffectivePressure() const {
+    return std::max(usagePressure, externalPressure);
+}
+
+std::vector<size_t> MemoryBudgetBroker::Allocate(MemoryPressure pressure) const {
+    std::vector<size_t> grants(consumers.size());
+    size_t minimumTotal = 0;
+    for (size_t i = 0; i < consumers.size(); ++i) {
+        grants[i] = consumers[i].consumer.minimumBytes;
+        minimumTotal += grants[i];
+    }
+
+    // Kritik baskıda herkes minimumuna iner
+    if (pressure == MemoryPressure::Critical) return grants;
+
+    const size_t available = pressure == MemoryPressure::Moderate
+        ? static_cast<size_t>(static_cast<double>(totalBudget) * MODERATE_BUDGET_SCALE)
+        : totalBudget;
+    size_t remaining = available > minimumTotal ? available - minimumTotal : 0;
+
+    // Yüksek öncelikten başlayarak fazlalığı dağıt; aynı öncelikteki
+    // tüketiciler eksiklerinin oranında paylaşır
+    std::vector<size_t> order(consumers.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return consumers[a].consumer.priority > consumers[b].consumer.priority;
+    });
+
+    for (size_t begin = 0; begin < order.size() && remaining > 0;) {
+        const int priority = consumers[order[begin]].consumer.priority;
+        size_t end = begin;
+        size_t demand = 0;
+        while (end < order.size() && consumers[order[end]].consumer.priority == priority) {
+            const Consumer& consumer = consumers[order[end]].consumer;
+            demand += consumer.desiredBytes - consumer.minimumBytes;
+            ++end;
+        }
+
+        if (demand <= remaining) {
+            for (size_t k = begin; k < end; ++k) {
+                grants[order[k]] = consumers[order[k]].consumer.desiredBytes;
+            }
+            remaining -= demand;
+        } else {
+            for (size_t k = begin; k < end; ++k) {
+                const Consumer& consumer = consumers[order[k]].consumer;
+                const double share = static_cast<double>(consumer.desiredBytes - consumer.minimumBytes) / demand;
+                grants[order[k]] += static_cast<size_t>(share * static_cast<double>(remaining));
+            }
+            remaining = 0;
+        }
+        begin = end;
+    }
+    return grants;
+}
+
+std::vector<MemoryBudgetBroker::ConsumerId> MemoryBudgetBroker::RebalanceLocked() {
+    const MemoryPressure pressure = EffectivePressure();
+    const std::vector<size_t> targets = Allocate(pressure);
+
+    std::vector<ConsumerId> changed;
+    for (size_t i = 0; i < consumers.size(); ++i) {
+        Entry& entry = consumers[i];
+        const size_t target = targets[i];
+
+        // Küçülme hemen uygulanır; büyüme ancak belirgin veya isteği
+        // tamamlıyorsa (küçük dalgalanmalar buffer'ları boşuna yeniden kurdurmasın)
+        const bool grow = target > entry.grant &&
+            (target >= entry.grant + static_cast<size_t>(entry.grant * GROW_HYSTERESIS) ||
+             target >= entry.consumer.desiredBytes);
+        const bool shrink = target < entry.grant;
+
+        if (!entry.notified || grow || shrink || entry.notifiedPressure != pressure) {
+            if (!entry.notified || grow || shrink) entry.grant = target;
+            entry.notifiedPressure = pressure;
+            entry.notified = true;
+            changed.push_back(entry.id);
+        }
+    }
+    return changed;
+}
+
+void MemoryBudgetBroker::Dispatch(const std::vector<ConsumerId>& changed) {
+    if (changed.empty()) return;
+
+    std::lock_guard<std::recursive_mutex> dispatchLock(dispatchMutex);
+    for (ConsumerId id : changed) {
+        // Güncel değerler okunur: araya giren bir yeniden dağıtım eski bütçeyi bildirmesin
+        BudgetCallback callback;
+        size_t grant = 0;
+        MemoryPressure pressure = MemoryPressure::Normal;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = std::find_if(consumers.begin(), consumers.end(),
+                                   [id](const Entry& entry) { return entry.id == id; });
+            if (it == consumers.end()) continue;
+            callback = it->consumer.onBudget;
+            grant = it->grant;
+            pressure = it->notifiedPressure;
+        }
+        if (callback) callback(grant, pressure);
+    }
+}
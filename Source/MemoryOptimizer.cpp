@@ -1,24 +1,47 @@
 // Source/MemoryOptimizer.cpp
 #include "../Headers/MemoryOptimizer.h"
 #include "../Headers/VideoPlayer.h"
+#include "../Logger.h"
+#include "../Headers/TraceRecorder.h"
+
+#include <algorithm>
 
 MemoryOptimizer::MemoryOptimizer() 
     : currentMemoryUsage(0)
     , peakMemoryUsage(0)
     , memoryLimit(200 * 1024 * 1024) // 200MB default limit
+    , pressureNotifications(false)
     , isRunning(true) {
     
-    // Başlangıç bellek kullanımını ölç
+    // Kategori başına varsayılan limitler
+    SetCategoryLimit(MemoryCategory::Frames, 96 * 1024 * 1024);
+    SetCategoryLimit(MemoryCategory::ImageCache, 48 * 1024 * 1024);
+    SetCategoryLimit(MemoryCategory::Thumbnails, 24 * 1024 * 1024);
+    SetCategoryLimit(MemoryCategory::Decoder, 64 * 1024 * 1024);
+    SetCategoryLimit(MemoryCategory::Logging, 4 * 1024 * 1024);
+    SetCategoryLimit(MemoryCategory::Scratch, 16 * 1024 * 1024);
+    
+    // Başlangıç bellek kullanımını ölç ve broker'a bildir
     MonitorMemoryUsage();
+    DynamicBufferResize();
     
-    // Cleanup thread'ini başlat
+    // Baskı bildirimleri varsa temizlik onlarla tetiklenir ve thread sadece seyrek
+    // limit kontrolü için uyanır (sistem baskısı olmadan 200 MB aşılabilir);
+    // yoksa aynı thread sık yoklama yapar
+    pressureNotifications = pressureMonitor.Start([this](MemoryPressure pressure) { OnMemoryPressure(pressure); });
     cleanupThread = std::make_unique<std::thread>(&MemoryOptimizer::CleanupLoop, this);
-    
-    ErrorHandler::LogInfo("MemoryOptimizer başlatıldı", InfoLevel::INFO);
+    ErrorHandler::LogInfo(pressureNotifications ? "MemoryOptimizer başlatıldı (baskı bildirimleri)"
+                                                : "MemoryOptimizer başlatıldı (yoklama)", InfoLevel::INFO);
 }
 
 MemoryOptimizer::~MemoryOptimizer() {
-    isRunning = false;
+    pressureMonitor.Stop();
+    
+    {
+        std::lock_guard<std::mutex> lock(stopMutex);
+        isRunning = false;
+    }
+    stopCondition.notify_all();
     
     if (cleanupThread && cleanupThread->joinable()) {
         cleanupThread->join();
@@ -27,23 +50,41 @@ MemoryOptimizer::~MemoryOptimizer() {
     ErrorHandler::LogInfo("MemoryOptimizer sonlandırıldı", InfoLevel::INFO);
 }
 
+static std::string FormatMB(size_t bytes) {
+    return std::to_string(static_cast<int>(bytes / (1024.0 * 1024.0))) + " MB";
+}
+
 void MemoryOptimizer::MonitorMemoryUsage() {
-    PROCESS_MEMORY_COUNTERS pmc;
-    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
-        size_t current = pmc.WorkingSetSize;
-        currentMemoryUsage = current;
-        
-        if (current > peakMemoryUsage) {
-            peakMemoryUsage = current;
-        }
-        
-        // Bellek kullanımını log'la (sadece önemli değişiklikler)
-        static size_t lastLogged = 0;
-        if (current > lastLogged + (10 * 1024 * 1024) || current < lastLogged - (10 * 1024 * 1024)) {
-            double memoryMB = current / (1024.0 * 1024.0);
-            ErrorHandler::LogInfo("Bellek kullanımı: " + std::to_string(static_cast<int>(memoryMB)) + " MB", InfoLevel::TRACE);
-            lastLogged = current;
+    MemoryAccounting::Snapshot snapshot = MemoryAccounting::TakeSnapshot();
+    MemoryAccounting::ProcessMemory process;
+    MemoryAccounting::QueryProcessMemory(process);
+    
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        lastSnapshot = snapshot;
+        processMemory = process;
+    }
+    
+    size_t current = snapshot.trackedBytes;
+    currentMemoryUsage = current;
+    
+    if (current > peakMemoryUsage) {
+        peakMemoryUsage = current;
+    }
+    
+    // Bellek kullanımını log'la (sadece önemli değişiklikler). Release'te Trace derlenmez
+    static size_t lastLogged = 0;
+    if (LMW_LOG_IS_ON(Logger::GetInstance(), Trace) &&
+        (current > lastLogged + (10 * 1024 * 1024) || current + (10 * 1024 * 1024) < lastLogged)) {
+        std::string breakdown;
+        for (size_t i = 0; i < MemoryAccounting::CATEGORY_COUNT; ++i) {
+            const auto category = static_cast<MemoryCategory>(i);
+            breakdown += std::string(" ") + MemoryAccounting::GetCategoryName(category) + "=" +
+                         FormatMB(snapshot[category].currentBytes);
         }
+        LMW_LOG_TRACE(Logger::GetInstance(), "Bellek kullanımı: {} ({}, özel {})", FormatMB(current),
+                      breakdown.substr(1), FormatMB(process.privateBytes));
+        lastLogged = current;
     }
 }
 
@@ -52,22 +93,58 @@ size_t MemoryOptimizer::GetCurrentMemoryUsage() {
     return currentMemoryUsage;
 }
 
-void MemoryOptimizer::AutoCleanup() {
+MemoryAccounting::Snapshot MemoryOptimizer::GetSnapshot() {
     MonitorMemoryUsage();
+    std::lock_guard<std::mutex> lock(mutex);
+    return lastSnapshot;
+}
+
+size_t MemoryOptimizer::GetUntrackedMemory() {
+    MonitorMemoryUsage();
+    std::lock_guard<std::mutex> lock(mutex);
+    return processMemory.privateBytes > lastSnapshot.trackedBytes
+        ? processMemory.privateBytes - lastSnapshot.trackedBytes : 0;
+}
+
+bool MemoryOptimizer::IsOverLimit(const MemoryAccounting::Snapshot& snapshot, MemoryCategory category) const {
+    return snapshot[category].currentBytes > GetCategoryLimit(category);
+}
+
+void MemoryOptimizer::AutoCleanup() {
+    // Yoklama thread'inden de baskı bildiriminden de çağrılır: iz her iki yolda görünür
+    TraceRecorder::Span span("AutoCleanup");
+    std::lock_guard<std::mutex> cleanupLock(cleanupMutex);
+    const MemoryAccounting::Snapshot snapshot = GetSnapshot();
     
-    if (currentMemoryUsage > memoryLimit) {
-        ErrorHandler::LogInfo("Bellek limiti aşıldı, otomatik temizlik başlatılıyor", InfoLevel::WARNING);
-        
+    bool cleaned = false;
+    for (size_t i = 0; i < MemoryAccounting::CATEGORY_COUNT; ++i) {
+        const auto category = static_cast<MemoryCategory>(i);
+        if (IsOverLimit(snapshot, category)) {
+            ErrorHandler::LogInfo(std::string("Kategori limiti aşıldı: ") + MemoryAccounting::GetCategoryName(category) +
+                                  " " + FormatMB(snapshot[category].currentBytes) + " / " +
+                                  FormatMB(GetCategoryLimit(category)), InfoLevel::WARNING);
+        }
+    }
+    
+    // Kare buffer'ları: doğrudan geri alınabilen tek büyük kategori
+    if (IsOverLimit(snapshot, MemoryCategory::Frames) || snapshot.trackedBytes > memoryLimit) {
         ClearUnusedFrames();
-        DynamicBufferResize();
+        cleaned = true;
+    }
+    DynamicBufferResize();
+    
+    // Etiketlenmemiş özel bellek büyükse (çözücü içi havuzlar, heap parçalanması)
+    // heap'i sıkıştırmak işe yarar; çalışma kümesini kırpmak sadece sayfa hatası üretir
+    const size_t untracked = GetUntrackedMemory();
+    if (untracked > memoryLimit) {
+        ErrorHandler::LogInfo("Etiketlenmemiş bellek yüksek: " + FormatMB(untracked), InfoLevel::WARNING);
         OptimizeMemoryAllocation();
-        
-        // Sistem seviyesinde temizlik
-        SetProcessWorkingSetSize(GetCurrentProcess(), -1, -1);
-        
+        cleaned = true;
+    }
+    
+    if (cleaned) {
         MonitorMemoryUsage();
-        double memoryMB = currentMemoryUsage / (1024.0 * 1024.0);
-        ErrorHandler::LogInfo("Temizlik sonrası bellek kullanımı: " + std::to_string(static_cast<int>(memoryMB)) + " MB", InfoLevel::INFO);
+        ErrorHandler::LogInfo("Temizlik sonrası bellek kullanımı: " + FormatMB(currentMemoryUsage), InfoLevel::INFO);
     }
 }
 
@@ -82,21 +159,22 @@ void MemoryOptimizer::ClearUnusedFrames() {
         }
     }
     
-    ErrorHandler::LogInfo("Kullanılmayan frame'ler temizlendi", InfoLevel::DEBUG);
+    LMW_LOG_DEBUG(Logger::GetInstance(), "Kullanılmayan frame'ler temizlendi");
 }
 
 void MemoryOptimizer::DynamicBufferResize() {
-    MonitorMemoryUsage();
+    // Buffer boyutlarını tüketiciler kendileri ayarlar: broker bütçeyi
+    // önceliğe göre böler ve değişen bütçeyi/baskı seviyesini bildirir
+    MemoryBudgetBroker& broker = MemoryBudgetBroker::GetInstance();
+    const MemoryPressure before = broker.GetPressure();
     
-    // Bellek kullanımına göre buffer boyutunu ayarla
-    if (currentMemoryUsage > memoryLimit * 0.8) { // %80'i aşınca
-        VideoPlayer::SetMaxBufferFrames(2); // Buffer boyutunu küçült
-        ErrorHandler::LogInfo("Buffer boyutu küçültüldü (2 frame)", InfoLevel::DEBUG);
-    } else if (currentMemoryUsage < memoryLimit * 0.5) { // %50'nin altındaysa
-        VideoPlayer::SetMaxBufferFrames(5); // Buffer boyutunu büyüt
-        ErrorHandler::LogInfo("Buffer boyutu büyütüldü (5 frame)", InfoLevel::DEBUG);
-    } else {
-        VideoPlayer::SetMaxBufferFrames(3); // Normal boyut
+    broker.SetTotalBudget(memoryLimit);
+    broker.UpdateUsage(currentMemoryUsage);
+    
+    const MemoryPressure after = broker.GetPressure();
+    if (after != before) {
+        ErrorHandler::LogInfo(std::string("Bellek baskısı: ") + MemoryBudgetBroker::GetPressureName(before) +
+                              " -> " + MemoryBudgetBroker::GetPressureName(after), InfoLevel::INFO);
     }
 }
 
@@ -112,25 +190,51 @@ void MemoryOptimizer::OptimizeMemoryAllocation() {
     _heapmin();
     #endif
     
-    ErrorHandler::LogInfo("Bellek tahsisi optimize edildi", InfoLevel::DEBUG);
+    LMW_LOG_DEBUG(Logger::GetInstance(), "Bellek tahsisi optimize edildi");
+}
+
+void MemoryOptimizer::OnMemoryPressure(MemoryPressure pressure) {
+    if (pressure == MemoryPressure::Normal) {
+        LMW_LOG_DEBUG(Logger::GetInstance(), "Sistem bellek baskısı: {}", MemoryBudgetBroker::GetPressureName(pressure));
+    } else {
+        LMW_LOG_WARNING(Logger::GetInstance(), "Sistem bellek baskısı: {}", MemoryBudgetBroker::GetPressureName(pressure));
+    }
+    
+    try {
+        // Baskı seviyesi broker üzerinden tüm tüketicilere iletilir
+        MemoryBudgetBroker::GetInstance().SetExternalPressure(pressure);
+        
+        if (pressure != MemoryPressure::Normal) {
+            AutoCleanup();
+        }
+        if (pressure == MemoryPressure::Critical) {
+            OptimizeMemoryAllocation();
+        }
+    } catch (const std::exception& e) {
+        LMW_LOG_LIMITED(Logger::GetInstance(), Error, "MemoryOptimizer baskı işleme hatası: {}", e.what());
+    }
 }
 
 void MemoryOptimizer::CleanupLoop() {
-    const auto cleanupInterval = std::chrono::seconds(10); // 10 saniyede bir kontrol
+    const auto cleanupInterval = std::chrono::seconds(pressureNotifications ? LIMIT_CHECK_INTERVAL_SECONDS
+                                                                             : POLL_INTERVAL_SECONDS);
     
-    ErrorHandler::LogInfo("MemoryOptimizer cleanup thread başladı", InfoLevel::DEBUG);
+    LMW_LOG_DEBUG(Logger::GetInstance(), "MemoryOptimizer cleanup thread başladı");
+    TraceRecorder::GetInstance().SetThreadName("Bellek temizliği");
     
     while (isRunning) {
+        auto interval = cleanupInterval;
         try {
             AutoCleanup();
-            
-            std::this_thread::sleep_for(cleanupInterval);
-            
         } catch (const std::exception& e) {
-            ErrorHandler::LogError("MemoryOptimizer cleanup hatası: " + std::string(e.what()), ErrorLevel::ERROR);
-            std::this_thread::sleep_for(std::chrono::seconds(30)); // Hata durumunda daha uzun bekle
+            LMW_LOG_LIMITED(Logger::GetInstance(), Error, "MemoryOptimizer cleanup hatası: {}", e.what());
+            interval = std::max(interval, std::chrono::seconds(30)); // Hata durumunda daha uzun bekle
         }
+        
+        // Kapanışta tüm aralığı beklemeden çık
+        std::unique_lock<std::mutex> lock(stopMutex);
+        stopCondition.wait_for(lock, interval, [this] { return !isRunning; });
     }
     
-    ErrorHandler::LogInfo("MemoryOptimizer cleanup thread sonlandı", InfoLevel::DEBUG);
-}
\ No newline at end of file
+    LMW_LOG_DEBUG(Logger::GetInstance(), "MemoryOptimizer cleanup thread sonlandı");
+}
@@ -0,0 +1,264 @@
+// Source/MemoryPressureMonitor.cpp
+#include "../Headers/MemoryPressureMonitor.h"
+#include "../Headers/TraceRecorder.h"
+
+#include <algorithm>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// Platform durumu
+// ---------------------------------------------------------------------------
+
+#ifdef _WIN32
+struct MemoryPressureMonitor::PlatformState {
+    HANDLE stopEvent = nullptr;
+    HANDLE wakeEvent = nullptr;
+    HANDLE lowMemory = nullptr;   // Sistem düşük bellekteyken sinyalli kalır
+
+    ~PlatformState() {
+        if (stopEvent) CloseHandle(stopEvent);
+        if (wakeEvent) CloseHandle(wakeEvent);
+        if (lowMemory) CloseHandle(lowMemory);
+    }
+
+    bool IsLowMemory() const {
+        BOOL state = FALSE;
+        return lowMemory && QueryMemoryResourceNotification(lowMemory, &state) && state;
+    }
+};
+#else
+struct MemoryPressureMonitor::PlatformState {
+    int wakeFd = -1;
+    int moderateFd = -1;   // PSI "some" tetikleyicisi
+    int criticalFd = -1;   // PSI "full" tetikleyicisi
+
+    ~PlatformState() {
+        if (wakeFd >= 0) close(wakeFd);
+        if (moderateFd >= 0) close(moderateFd);
+        if (criticalFd >= 0) close(criticalFd);
+    }
+
+    // Her tetikleyici ayrı bir dosya tanımlayıcısı ister; eşik aşılınca POLLPRI gelir
+    static int OpenTrigger(const char* kind, int stallUs) {
+        const int fd = open("/proc/pressure/memory", O_RDWR | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0) return -1;
+
+        const std::string trigger = std::string(kind) + " " + std::to_string(stallUs) + " " +
+                                    std::to_string(PSI_WINDOW_US);
+        if (write(fd, trigger.c_str(), trigger.size() + 1) < 0) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+};
+#endif
+
+MemoryPressureMonitor::MemoryPressureMonitor()
+    : isRunning(false)
+    , shouldStop(false)
+    , level(MemoryPressure::Normal)
+    , injected(-1)
+    , wakeupCount(0) {
+}
+
+MemoryPressureMonitor::~MemoryPressureMonitor() {
+    Stop();
+}
+
+bool MemoryPressureMonitor::Start(PressureCallback pressureCallback, const Options& monitorOptions) {
+    Stop();
+
+    callback = std::move(pressureCallback);
+    options = monitorOptions;
+    level = MemoryPressure::Normal;
+    injected = -1;
+    platform = std::make_unique<PlatformState>();
+
+#ifdef _WIN32
+    platform->stopEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    platform->wakeEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (!platform->stopEvent || !platform->wakeEvent) {
+        platform.reset();
+        return false;
+    }
+    if (options.useSystemSource) {
+        platform->lowMemory = CreateMemoryResourceNotification(LowMemoryResourceNotification);
+        if (!platform->lowMemory) {
+            platform.reset();
+            return false;
+        }
+    }
+#else
+    platform->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (platform->wakeFd < 0) {
+        platform.reset();
+        return false;
+    }
+    if (options.useSystemSource) {
+        // PSI yoksa (eski çekirdek, CONFIG_PSI kapalı) çağıran yoklamaya geri düşer
+        platform->moderateFd = PlatformState::OpenTrigger("some", PSI_MODERATE_STALL_US);
+        platform->criticalFd = PlatformState::OpenTrigger("full", PSI_CRITICAL_STALL_US);
+        if (platform->moderateFd < 0 && platform->criticalFd < 0) {
+            platform.reset();
+            return false;
+        }
+    }
+#endif
+
+    shouldStop = false;
+    isRunning = true;
+    monitorThread = std::make_unique<std::thread>(&MemoryPressureMonitor::MonitorLoop, this);
+    return true;
+}
+
+void MemoryPressureMonitor::Stop() {
+    if (!monitorThread) return;
+
+    shouldStop = true;
+#ifdef _WIN32
+    SetEvent(platform->stopEvent);
+#else
+    Wake();
+#endif
+
+    if (monitorThread->joinable()) {
+        monitorThread->join();
+    }
+    monitorThread.reset();
+    platform.reset();
+    isRunning = false;
+}
+
+void MemoryPressureMonitor::Inject(MemoryPressure pressure) {
+    int current = injected.load();
+    while (static_cast<int>(pressure) > current &&
+           !injected.compare_exchange_weak(current, static_cast<int>(pressure))) {
+    }
+    Wake();
+}
+
+void MemoryPressureMonitor::Wake() {
+    if (!platform) return;
+#ifdef _WIN32
+    SetEvent(platform->wakeEvent);
+#else
+    const uint64_t one = 1;
+    ssize_t written = write(platform->wakeFd, &one, sizeof(one));
+    (void)written;
+#endif
+}
+
+void MemoryPressureMonitor::MonitorLoop() {
+    using Clock = std::chrono::steady_clock;
+    // Baskı callback'leri (ör. MemoryOptimizer temizliği) bu thread'de çalışır
+    TraceRecorder::GetInstance().SetThreadName("Bellek baskısı");
+
+    const auto debounce = std::chrono::milliseconds(options.debounceMs);
+    const auto recovery = std::chrono::milliseconds(options.recoveryMs);
+
+    bool pending = false;
+    MemoryPressure observed = MemoryPressure::Normal;
+    Clock::time_point firstEvent, lastEvent;
+
+    auto remainingMs = [](Clock::time_point deadline) {
+        return static_cast<int>(std::max<int64_t>(0,
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count()));
+    };
+
+    while (!shouldStop) {
+        // Süresiz bekleme sadece baskı yokken: boşta hiç uyanma olmaz.
+        // Olay varsa debounce sonuna, baskı sürüyorsa iyileşme kontrolüne kadar bekle.
+        int timeoutMs = -1;
+        if (pending) {
+            timeoutMs = remainingMs(firstEvent + debounce);
+        } else if (level != MemoryPressure::Normal) {
+            timeoutMs = remainingMs(lastEvent + recovery);
+        }
+
+        int eventLevel = -1;
+#ifdef _WIN32
+        // Düşük bellek bildirimi durum boyunca sinyalli kalır; kritikteyken
+        // beklenmez, iyileşme zamanlayıcı ile kontrol edilir
+        HANDLE handles[3] = { platform->stopEvent, platform->wakeEvent, platform->lowMemory };
+        const bool waitLow = platform->lowMemory && level != MemoryPressure::Critical &&
+                             !(pending && observed == MemoryPressure::Critical);
+        const DWORD result = WaitForMultipleObjects(waitLow ? 3 : 2, handles, FALSE,
+                                                    timeoutMs < 0 ? INFINITE : static_cast<DWORD>(timeoutMs));
+        ++wakeupCount;
+        if (result == WAIT_OBJECT_0 || shouldStop) break;
+        if (result == WAIT_OBJECT_0 + 2) {
+            eventLevel = static_cast<int>(MemoryPressure::Critical);
+        }
+#else
+        pollfd fds[3] = {
+            { platform->wakeFd, POLLIN, 0 },
+            { platform->moderateFd, POLLPRI, 0 },
+            { platform->criticalFd, POLLPRI, 0 },
+        };
+        const int ready = poll(fds, 3, timeoutMs);
+        ++wakeupCount;
+        if (shouldStop) break;
+
+        if (ready > 0) {
+            if (fds[0].revents & POLLIN) {
+                uint64_t value = 0;
+                ssize_t bytesRead = read(platform->wakeFd, &value, sizeof(value));
+                (void)bytesRead;
+            }
+            if (fds[1].revents & POLLPRI) eventLevel = static_cast<int>(MemoryPressure::Moderate);
+            if (fds[2].revents & POLLPRI) eventLevel = static_cast<int>(MemoryPressure::Critical);
+
+            // Tetikleyici geçersiz olduysa (ör. cgroup silindi) kapat; poll negatif fd'yi yok sayar
+            if (fds[1].revents & (POLLERR | POLLNVAL)) {
+                close(platform->moderateFd);
+                platform->moderateFd = -1;
+            }
+            if (fds[2].revents & (POLLERR | POLLNVAL)) {
+                close(platform->criticalFd);
+                platform->criticalFd = -1;
+            }
+        }
+#endif
+        eventLevel = std::max(eventLevel, injected.exchange(-1));
+
+        auto now = Clock::now();
+        if (eventLevel >= 0) {
+            if (!pending) {
+                pending = true;
+                firstEvent = now;
+                observed = MemoryPressure::Normal;
+            }
+            observed = std::max(observed, static_cast<MemoryPressure>(eventLevel));
+            lastEvent = now;
+        }
+
+        // Debounce penceresindeki en yüksek seviye bildirilir
+        if (pending && now >= firstEvent + debounce) {
+            pending = false;
+            if (observed != level) {
+                level = observed;
+                if (callback) callback(observed);
+            }
+        } else if (!pending && level != MemoryPressure::Normal && now >= lastEvent + recovery) {
+#ifdef _WIN32
+            // Bildirim hâlâ sinyalliyse baskı sürüyor
+            if (platform->IsLowMemory()) {
+                lastEvent = now;
+                continue;
+            }
+#endif
+            level = MemoryPressure::Normal;
+            if (callback) callback(MemoryPressure::Normal);
+        }
+    }
+}
@@ -0,0 +1,296 @@
+// Source/PerceptualHash.cpp
+#include "../Headers/PerceptualHash.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+
+static constexpr int PHASH_SIZE = 32;
+static constexpr int PHASH_LOW = 8;
+
+static inline uint32_t PixelLuma(const uint8_t* pixel, int bytesPerPixel) {
+    if (bytesPerPixel == 1) return pixel[0];
+    // BGRA, BT.601 ağırlıkları (x256)
+    return (pixel[2] * 77u + pixel[1] * 150u + pixel[0] * 29u) >> 8;
+}
+
+// Alan ortalamasıyla outWidth x outHeight gri ızgaraya küçült
+static void Downscale(const PerceptualHash::Image& image, int outWidth, int outHeight, float* out) {
+    for (int oy = 0; oy < outHeight; ++oy) {
+        const int y0 = oy * image.height / outHeight;
+        const int y1 = std::max(y0 + 1, (oy + 1) * image.height / outHeight);
+        for (int ox = 0; ox < outWidth; ++ox) {
+            const int x0 = ox * image.width / outWidth;
+            const int x1 = std::max(x0 + 1, (ox + 1) * image.width / outWidth);
+
+            uint64_t sum = 0;
+            for (int y = y0; y < y1; ++y) {
+                const uint8_t* row = image.pixels + static_cast<ptrdiff_t>(y) * image.stride;
+                for (int x = x0; x < x1; ++x) {
+                    sum += PixelLuma(row + x * image.bytesPerPixel, image.bytesPerPixel);
+                }
+            }
+            out[oy * outWidth + ox] = static_cast<float>(sum) / static_cast<float>((y1 - y0) * (x1 - x0));
+        }
+    }
+}
+
+static bool IsValidImage(const PerceptualHash::Image& image) {
+    return image.pixels && image.width > 0 && image.height > 0 &&
+           (image.bytesPerPixel == 1 || image.bytesPerPixel == 4) &&
+           std::abs(image.stride) >= image.width * image.bytesPerPixel;
+}
+
+uint64_t PerceptualHash::DHash(const Image& image) {
+    if (!IsValidImage(image)) return 0;
+
+    // 9x8: her satırda yan yana 8 karşılaştırma
+    float grid[9 * 8];
+    Downscale(image, 9, 8, grid);
+
+    uint64_t hash = 0;
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            hash = (hash << 1) | (grid[y * 9 + x] < grid[y * 9 + x + 1] ? 1u : 0u);
+        }
+    }
+    return hash;
+}
+
+uint64_t PerceptualHash::PHash(const Image& image) {
+    if (!IsValidImage(image)) return 0;
+
+    // DCT-II katsayı tablosu: sadece ilk 8 frekans gerekli
+    static const std::array<float, PHASH_LOW * PHASH_SIZE> cosines = []() {
+        std::array<float, PHASH_LOW * PHASH_SIZE> table{};
+        const double pi = 3.14159265358979323846;
+        for (int u = 0; u < PHASH_LOW; ++u) {
+            for (int x = 0; x < PHASH_SIZE; ++x) {
+                table[u * PHASH_SIZE + x] = static_cast<float>(std::cos((2 * x + 1) * u * pi / (2.0 * PHASH_SIZE)));
+            }
+        }
+        return table;
+    }();
+
+    float grid[PHASH_SIZE * PHASH_SIZE];
+    Downscale(image, PHASH_SIZE, PHASH_SIZE, grid);
+
+    // Ayrılabilir DCT: önce satırlar, sonra sütunlar (8x32 ve 8x8 çıktı)
+    float rows[PHASH_SIZE * PHASH_LOW];
+    for (int y = 0; y < PHASH_SIZE; ++y) {
+        for (int u = 0; u < PHASH_LOW; ++u) {
+            float sum = 0.0f;
+            for (int x = 0; x < PHASH_SIZE; ++x) {
+                sum += grid[y * PHASH_SIZE + x] * cosines[u * PHASH_SIZE + x];
+            }
+            rows[y * PHASH_LOW + u] = sum;
+        }
+    }
+
+    float coefficients[PHASH_LOW * PHASH_LOW];
+    for (int v = 0; v < PHASH_LOW; ++v) {
+        for (int u = 0; u < PHASH_LOW; ++u) {
+            float sum = 0.0f;
+            for (int y = 0; y < PHASH_SIZE; ++y) {
+                sum += rows[y * PHASH_LOW + u] * cosines[v * PHASH_SIZE + y];
+            }
+            coefficients[v * PHASH_LOW + u] = sum;
+        }
+    }
+
+    // Medyan DC bileşeni hariç hesaplanır (parlaklık farkı hash'i bozmasın)
+    float sorted[PHASH_LOW * PHASH_LOW - 1];
+    std::copy(coefficients + 1, coefficients + PHASH_LOW * PHASH_LOW, sorted);
+    std::nth_element(sorted, sorted + 31, sorted + 63);
+    const float median = sorted[31];
+
+    uint64_t hash = 0;
+    for (int i = 0; i < PHASH_LOW * PHASH_LOW; ++i) {
+        hash = (hash << 1) | (coefficients[i] > median ? 1u : 0u);
+    }
+    return hash;
+}
+
+// GCC/Clang x86'da POPCNT ve (Ice Lake+) AVX-512 VPOPCNTQ sürümleri çalışma anında seçilir;
+// MSVC std::popcount'u zaten donanım komutuna indirger
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__linux__)
+#define LMW_POPCOUNT_CLONES __attribute__((target_clones("default", "popcnt", "arch=icelake-client")))
+#else
+#define LMW_POPCOUNT_CLONES
+#endif
+
+LMW_POPCOUNT_CLONES
+static size_t CountWithin(uint64_t query, const uint64_t* hashes, size_t count, int maxDistance, uint8_t* flags) {
+    // Dallanmasız ilk geçiş vektörleşir; eşleşmeler ikinci geçişte toplanır
+    size_t found = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t hit = std::popcount(query ^ hashes[i]) <= maxDistance;
+        flags[i] = hit;
+        found += hit;
+    }
+    return found;
+}
+
+size_t PerceptualHash::FindWithin(uint64_t query, const uint64_t* hashes, size_t count,
+                                  int maxDistance, std::vector<uint32_t>& matches) {
+    static constexpr size_t BLOCK = 4096;
+    uint8_t flags[BLOCK];
+
+    const size_t before = matches.size();
+    for (size_t begin = 0; begin < count; begin += BLOCK) {
+        const size_t blockSize = std::min(BLOCK, count - begin);
+        if (CountWithin(query, hashes + begin, blockSize, maxDistance, flags) == 0) continue;
+        for (size_t i = 0; i < blockSize; ++i) {
+            if (flags[i]) matches.push_back(static_cast<uint32_t>(begin + i));
+        }
+    }
+    return matches.size() - before;
+}
+
+std::vector<double> PerceptualHash::SamplePositions(double duration, int sampleCount) {
+    std::vector<double> positions;
+    if (sampleCount <= 0) return positions;
+    if (duration <= 0.0) {
+        positions.push_back(0.0);
+        return positions;
+    }
+
+    // Başlık/jenerik kırpmalarından etkilenmemek için %10–%90 aralığı
+    positions.reserve(sampleCount);
+    for (int i = 0; i < sampleCount; ++i) {
+        const double fraction = sampleCount == 1 ? 0.5 : 0.1 + 0.8 * i / (sampleCount - 1);
+        positions.push_back(duration * fraction);
+    }
+    return positions;
+}
+
+bool PerceptualHash::IsDuplicate(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b, int maxDistance) {
+    if (a.empty() || b.empty()) return false;
+
+    const std::vector<uint64_t>& smaller = a.size() <= b.size() ? a : b;
+    const std::vector<uint64_t>& larger = a.size() <= b.size() ? b : a;
+
+    size_t matched = 0;
+    for (uint64_t hash : smaller) {
+        for (uint64_t other : larger) {
+            if (Distance(hash, other) <= maxDistance) {
+                ++matched;
+                break;
+            }
+        }
+    }
+    return matched * 2 > smaller.size();
+}
+
+// ---------------------------------------------------------------------------
+// HashIndex (multi-index hashing)
+// ---------------------------------------------------------------------------
+
+void HashIndex::Insert(uint64_t hash, uint32_t id) {
+    hashes.push_back(hash);
+    ids.push_back(id);
+    built = false;
+}
+
+void HashIndex::Reserve(size_t count) {
+    hashes.reserve(count);
+    ids.reserve(count);
+}
+
+void HashIndex::Clear() {
+    hashes.clear();
+    ids.clear();
+    built = false;
+}
+
+void HashIndex::Build() const {
+    for (int chunk = 0; chunk < CHUNK_COUNT; ++chunk) {
+        std::vector<uint32_t>& offsets = bucketOffsets[chunk];
+        std::vector<uint32_t>& items = bucketItems[chunk];
+        offsets.assign(BUCKET_COUNT + 1, 0);
+        items.resize(hashes.size());
+
+        for (uint64_t hash : hashes) {
+            ++offsets[Chunk(hash, chunk) + 1];
+        }
+        for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+            offsets[bucket + 1] += offsets[bucket];
+        }
+        std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            items[cursor[Chunk(hashes[i], chunk)]++] = static_cast<uint32_t>(i);
+        }
+    }
+    built = true;
+}
+
+void HashIndex::ScanBucket(uint64_t hash, int chunk, uint32_t bucket, int chunkRadius, int maxDistance,
+                           std::vector<Match>& matches) const {
+    const std::vector<uint32_t>& items = bucketItems[chunk];
+    const uint32_t end = bucketOffsets[chunk][bucket + 1];
+    for (uint32_t i = bucketOffsets[chunk][bucket]; i < end; ++i) {
+        const uint64_t candidate = hashes[items[i]];
+        const int distance = PerceptualHash::Distance(hash, candidate);
+        if (distance > maxDistance) continue;
+
+        // Aynı hash'i birden fazla parçada bulmamak için sadece
+        // eşleşen ilk parça raporlar
+        bool reportedEarlier = false;
+        for (int earlier = 0; earlier < chunk && !reportedEarlier; ++earlier) {
+            reportedEarlier = std::popcount(Chunk(hash, earlier) ^ Chunk(candidate, earlier)) <= chunkRadius;
+        }
+        if (!reportedEarlier) {
+            matches.push_back({ ids[items[i]], distance });
+        }
+    }
+}
+
+void HashIndex::Query(uint64_t hash, int maxDistance, std::vector<Match>& matches) const {
+    if (hashes.empty() || maxDistance < 0) return;
+
+    const int chunkRadius = maxDistance / CHUNK_COUNT;
+    if (chunkRadius > MAX_CHUNK_RADIUS) {
+        // Geniş yarıçapta kova sayısı patlar; düz tarama daha ucuz
+        std::vector<uint32_t> found;
+        PerceptualHash::FindWithin(hash, hashes.data(), hashes.size(), maxDistance, found);
+        for (uint32_t i : found) {
+            matches.push_back({ ids[i], PerceptualHash::Distance(hash, hashes[i]) });
+        }
+        return;
+    }
+
+    if (!built) Build();
+
+    // Her parça için chunkRadius bit içindeki tüm kovaları dolaş
+    for (int chunk = 0; chunk < CHUNK_COUNT; ++chunk) {
+        const uint32_t key = Chunk(hash, chunk);
+        ScanBucket(hash, chunk, key, chunkRadius, maxDistance, matches);
+        if (chunkRadius < 1) continue;
+        for (int a = 0; a < CHUNK_BITS; ++a) {
+            const uint32_t flippedA = key ^ (1u << a);
+            ScanBucket(hash, chunk, flippedA, chunkRadius, maxDistance, matches);
+            if (chunkRadius < 2) continue;
+            for (int b = a + 1; b < CHUNK_BITS; ++b) {
+                ScanBucket(hash, chunk, flippedA ^ (1u << b), chunkRadius, maxDistance, matches);
+            }
+        }
+    }
+}
+
+bool HashIndex::Nearest(uint64_t hash, Match& match) const {
+    if (hashes.empty()) return false;
+
+    // Yarıçapı adım adım büyüt; boş olmayan ilk sonuç kesin en yakındır
+    std::vector<Match> matches;
+    for (int radius = 0; radius <= 64; radius += CHUNK_COUNT) {
+        matches.clear();
+        Query(hash, radius + CHUNK_COUNT - 1, matches);
+        if (matches.empty()) continue;
+
+        match = *std::min_element(matches.begin(), matches.end(),
+                                  [](const Match& a, const Match& b) { return a.distance < b.distance; });
+        return true;
+    }
+    return false;
+}
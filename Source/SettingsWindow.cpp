@@ -1,7 +1,29 @@
 // Source/SettingsWindow.cpp
 #include "../Headers/SettingsWindow.h"
 
-SettingsWindow::SettingsWindow() : hWnd(nullptr), isDragging(false), dragOffset{0, 0} {
+#include <filesystem>
+#include <sstream>
+
+SettingsWindow::SettingsWindow() : hWnd(nullptr), isDragging(false), dragOffset{0, 0},
+                                   previewBitmap(nullptr), previewHovered(false) {
+    // Önceki oturumun indeksi: değişmemiş dosyalar yeniden probe edilmez
+    mediaLibrary.Load(GetLibraryStorePath());
+    videoPreview.SetMediaLibrary(&mediaLibrary);
+
+    // Önizlemeler arka planda üretilir; hazır olunca pencereye haber verilir
+    previewQueue = std::make_unique<ThumbnailQueue>(
+        [this](const std::filesystem::path& videoPath, std::filesystem::path& previewPath) {
+            previewPath = GetPreviewCachePath(videoPath.wstring());
+            std::error_code ec;
+            std::filesystem::create_directories(previewPath.parent_path(), ec);
+            const bool success = videoPreview.GenerateAnimatedPreview(videoPath.wstring(), previewPath.wstring());
+            if (success && hWnd) {
+                PostMessage(hWnd, WM_PREVIEW_READY, 0, 0);
+            }
+            return success;
+        },
+        &mediaLibrary, ThumbnailQueue::Target::AnimatedPreview);
+
     CreateModernWindow();
     InitializeD2D();
     InitializeControls();
@@ -9,6 +31,15 @@ SettingsWindow::SettingsWindow() : hWnd(nullptr), isDragging(false), dragOffset{
 }
 
 SettingsWindow::~SettingsWindow() {
+    // İzleyici ve worker thread'leri pencere yok edilmeden önce durdur
+    folderWatcher.Stop();
+    previewQueue.reset();
+    mediaLibrary.Save(GetLibraryStorePath());
+    if (previewBitmap) {
+        previewBitmap->Release();
+        previewBitmap = nullptr;
+        previewBitmapMemory.Set(0);
+    }
     if (brush) {
         brush.reset();
     }
@@ -240,6 +271,7 @@ void SettingsWindow::LoadSettings() {
         DWORD size = sizeof(videoPath);
         if (RegQueryValueEx(hKey, L"VideoPath", nullptr, nullptr, (BYTE*)videoPath, &size) == ERROR_SUCCESS) {
             SetDlgItemText(hWnd, IDC_VIDEO_PATH, videoPath);
+            RequestAnimatedPreview(videoPath);
         }
         
         // Ses seviyesi
@@ -306,6 +338,164 @@ void SettingsWindow::SaveSettings() {
     }
 }
 
+std::wstring SettingsWindow::GetPreviewCachePath(const std::wstring& videoPath) {
+    wchar_t tempPath[MAX_PATH] = {0};
+    GetTempPath(MAX_PATH, tempPath);
+    
+    // Aynı dosya için sabit isim: yol hash'i
+    std::wstringstream name;
+    name << std::hex << std::hash<std::wstring>{}(videoPath) << L".lmap";
+    return (std::filesystem::path(tempPath) / L"LMWallpaper" / L"previews" / name.str()).wstring();
+}
+
+std::filesystem::path SettingsWindow::GetLibraryStorePath() {
+    wchar_t tempPath[MAX_PATH] = {0};
+    GetTempPath(MAX_PATH, tempPath);
+    const std::filesystem::path directory = std::filesystem::path(tempPath) / L"LMWallpaper";
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    return directory / L"library.lmwl";
+}
+
+void SettingsWindow::WatchVideoFolder(const std::wstring& videoPath) {
+    const std::filesystem::path folder = std::filesystem::path(videoPath).parent_path();
+    if (folder.empty() || (folder == watchedFolder && folderWatcher.IsRunning())) return;
+
+    folderWatcher.Stop();
+    watchedFolder = folder;
+
+    // Sadece yeni / değişen dosyalar probe edilir; önizlemesi olmayanlar kuyruğa girer
+    mediaLibrary.Rescan(folder);
+    if (previewQueue) {
+        previewQueue->Apply({ { MediaLibrary::Update::Kind::Rescanned, folder, {} } });
+    }
+
+    // Değişiklikler izleyici thread'inde kütüphaneye ve kuyruğa uygulanır,
+    // seçili videoyu ilgilendirenler UI thread'inde işlenir
+    const bool watching = folderWatcher.Start(folder, [this](const std::vector<DirectoryWatcher::Change>& changes) {
+        const std::vector<MediaLibrary::Update> updates = mediaLibrary.ApplyChanges(changes);
+        if (updates.empty()) return;
+        if (previewQueue) {
+            previewQueue->Apply(updates);
+        }
+        {
+            std::lock_guard<std::mutex> lock(libraryUpdateMutex);
+            pendingLibraryUpdates.insert(pendingLibraryUpdates.end(), updates.begin(), updates.end());
+        }
+        if (hWnd) {
+            PostMessage(hWnd, WM_LIBRARY_CHANGED, 0, 0);
+        }
+    });
+    if (!watching) {
+        ErrorHandler::LogError("Video klasörü izlenemiyor; klasör değişiklikleri yansıtılmayacak", ErrorLevel::WARNING);
+    }
+}
+
+void SettingsWindow::OnLibraryChanged() {
+    std::vector<MediaLibrary::Update> updates;
+    {
+        std::lock_guard<std::mutex> lock(libraryUpdateMutex);
+        updates.swap(pendingLibraryUpdates);
+    }
+    if (previewVideoPath.empty()) return;
+
+    const std::filesystem::path selected = previewVideoPath;
+    for (const auto& update : updates) {
+        if (update.kind == MediaLibrary::Update::Kind::Renamed && update.oldPath == selected) {
+            // Seçili video yeniden adlandırıldı: alan ve önizleme yeni yolu izler
+            SetDlgItemText(hWnd, IDC_VIDEO_PATH, update.path.c_str());
+            RequestAnimatedPreview(update.path.wstring());
+            return;
+        }
+    }
+
+    // Seçili video silindiyse (veya klasörü gittiyse) eski önizleme kaldırılır
+    MediaLibrary::Entry entry;
+    if (!mediaLibrary.GetEntry(selected, entry) && GetFileAttributes(previewVideoPath.c_str()) == INVALID_FILE_ATTRIBUTES) {
+        StopAnimatedPreview();
+        RECT area = { PREVIEW_X, PREVIEW_Y, PREVIEW_X + hoverPreview.GetWidth(), PREVIEW_Y + hoverPreview.GetHeight() };
+        hoverPreview.Unload();
+        if (previewBitmap) {
+            previewBitmap->Release();
+            previewBitmap = nullptr;
+            previewBitmapMemory.Set(0);
+        }
+        previewVideoPath.clear();
+        InvalidateRect(hWnd, &area, FALSE);
+    }
+}
+
+void SettingsWindow::RequestAnimatedPreview(const std::wstring& videoPath) {
+    StopAnimatedPreview();
+    previewVideoPath = videoPath;
+    WatchVideoFolder(videoPath);
+    
+    const std::wstring previewPath = GetPreviewCachePath(videoPath);
+    if (GetFileAttributes(previewPath.c_str()) != INVALID_FILE_ATTRIBUTES) {
+        LoadAnimatedPreview(previewPath);
+    } else if (previewQueue) {
+        previewQueue->Enqueue(videoPath);
+    }
+}
+
+void SettingsWindow::LoadAnimatedPreview(const std::wstring& previewPath) {
+    if (!renderTarget || !hoverPreview.Open(previewPath)) return;
+    
+    if (previewBitmap) {
+        previewBitmap->Release();
+        previewBitmap = nullptr;
+        previewBitmapMemory.Set(0);
+    }
+    
+    // Kareler doğrudan BGRA; alfa kullanılmıyor
+    HRESULT hr = renderTarget->CreateBitmap(
+        D2D1::SizeU(hoverPreview.GetWidth(), hoverPreview.GetHeight()),
+        D2D1::BitmapProperties(D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_IGNORE)),
+        &previewBitmap);
+    if (FAILED(hr)) {
+        ErrorHandler::LogError("Önizleme bitmap'i oluşturulamadı", ErrorLevel::WARNING);
+        return;
+    }
+    previewBitmapMemory.Set(static_cast<size_t>(hoverPreview.GetWidth()) * hoverPreview.GetHeight() * 4);
+    
+    // İlk kare hareketsiz poster olarak gösterilir
+    AnimatedPreview::Player::Rect dirty;
+    if (hoverPreview.Advance(dirty)) {
+        previewBitmap->CopyFromMemory(nullptr, hoverPreview.GetPixels(), hoverPreview.GetStride());
+    }
+    
+    RECT area = { PREVIEW_X, PREVIEW_Y, PREVIEW_X + hoverPreview.GetWidth(), PREVIEW_Y + hoverPreview.GetHeight() };
+    InvalidateRect(hWnd, &area, FALSE);
+}
+
+void SettingsWindow::StepAnimatedPreview() {
+    if (!previewBitmap || !hoverPreview.IsLoaded()) return;
+    
+    AnimatedPreview::Player::Rect dirty;
+    if (!hoverPreview.Advance(dirty) || dirty.right <= dirty.left) return;
+    
+    // Sadece değişen karolar GPU'ya kopyalanır ve yeniden çizilir
+    const D2D1_RECT_U dirtyRect = D2D1::RectU(dirty.left, dirty.top, dirty.right, dirty.bottom);
+    const BYTE* source = hoverPreview.GetPixels() + dirty.top * hoverPreview.GetStride() + dirty.left * 4;
+    previewBitmap->CopyFromMemory(&dirtyRect, source, hoverPreview.GetStride());
+    
+    RECT area = { PREVIEW_X + dirty.left, PREVIEW_Y + dirty.top, PREVIEW_X + dirty.right, PREVIEW_Y + dirty.bottom };
+    InvalidateRect(hWnd, &area, FALSE);
+}
+
+void SettingsWindow::StopAnimatedPreview() {
+    if (previewHovered && hWnd) {
+        KillTimer(hWnd, IDT_PREVIEW_ANIMATION);
+    }
+    previewHovered = false;
+}
+
+bool SettingsWindow::IsInPreviewArea(POINT pt) const {
+    return hoverPreview.IsLoaded() &&
+           pt.x >= PREVIEW_X && pt.x < PREVIEW_X + hoverPreview.GetWidth() &&
+           pt.y >= PREVIEW_Y && pt.y < PREVIEW_Y + hoverPreview.GetHeight();
+}
+
 void SettingsWindow::Show() {
     if (hWnd) {
         ShowWindow(hWnd, SW_SHOW);
@@ -348,6 +538,14 @@ LRESULT SettingsWindow::MessageHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARA
                     // Başlık metni (basit çizim)
                     brush->SetColor(D2D1::ColorF(1.0f, 1.0f, 1.0f, 1.0f));
                     
+                    // Animasyonlu önizleme
+                    if (previewBitmap) {
+                        renderTarget->DrawBitmap(previewBitmap, D2D1::RectF(
+                            static_cast<FLOAT>(PREVIEW_X), static_cast<FLOAT>(PREVIEW_Y),
+                            static_cast<FLOAT>(PREVIEW_X + hoverPreview.GetWidth()),
+                            static_cast<FLOAT>(PREVIEW_Y + hoverPreview.GetHeight())));
+                    }
+                    
                     HRESULT hr = renderTarget->EndDraw();
                     if (FAILED(hr)) {
                         ErrorHandler::LogError("Render target draw hatası", ErrorLevel::WARNING);
@@ -378,6 +576,7 @@ LRESULT SettingsWindow::MessageHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARA
                             
                             if (GetOpenFileName(&ofn)) {
                                 SetDlgItemText(hWnd, IDC_VIDEO_PATH, szFile);
+                                RequestAnimatedPreview(szFile);
                             }
                         }
                         break;
@@ -445,9 +644,45 @@ LRESULT SettingsWindow::MessageHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARA
                            cursor.y - dragOffset.y,
                            0, 0,
                            SWP_NOSIZE | SWP_NOZORDER);
+            } else {
+                // Önizleme sadece fare üzerindeyken oynar; diğer zamanlarda timer yok
+                POINT pt = {GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam)};
+                const bool inside = IsInPreviewArea(pt);
+                if (inside && !previewHovered) {
+                    previewHovered = true;
+                    TRACKMOUSEEVENT tme = { sizeof(tme), TME_LEAVE, hWnd, 0 };
+                    TrackMouseEvent(&tme);
+                    SetTimer(hWnd, IDT_PREVIEW_ANIMATION, hoverPreview.GetFrameIntervalMs(), nullptr);
+                } else if (!inside && previewHovered) {
+                    StopAnimatedPreview();
+                }
+            }
+            break;
+
+        case WM_MOUSELEAVE:
+            StopAnimatedPreview();
+            break;
+
+        case WM_TIMER:
+            if (wParam == IDT_PREVIEW_ANIMATION) {
+                StepAnimatedPreview();
             }
             break;
 
+        case WM_PREVIEW_READY:
+            {
+                // Kuyruk birden fazla dosya üretmiş olabilir; sadece seçili olanı yükle
+                const std::wstring previewPath = GetPreviewCachePath(previewVideoPath);
+                if (!previewVideoPath.empty() && GetFileAttributes(previewPath.c_str()) != INVALID_FILE_ATTRIBUTES) {
+                    LoadAnimatedPreview(previewPath);
+                }
+            }
+            break;
+
+        case WM_LIBRARY_CHANGED:
+            OnLibraryChanged();
+            break;
+
         case WM_SIZE:
             if (renderTarget) {
                 D2D1_SIZE_U size = D2D1::SizeU(LOWORD(lParam), HIWORD(lParam));
@@ -457,6 +692,12 @@ LRESULT SettingsWindow::MessageHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARA
 
         case WM_DESTROY:
             // Pencere kapatılırken kaynakları temizle
+            StopAnimatedPreview();
+            if (previewBitmap) {
+                previewBitmap->Release();
+                previewBitmap = nullptr;
+                previewBitmapMemory.Set(0);
+            }
             brush.reset();
             renderTarget.reset();
             break;
@@ -0,0 +1,135 @@
+// Source/ThumbnailQueue.cpp
+#include "../Headers/ThumbnailQueue.h"
+#include "../Headers/TraceRecorder.h"
+
+#include <algorithm>
+
+static std::string QueueKey(const std::filesystem::path& path) {
+    return path.lexically_normal().generic_string();
+}
+
+ThumbnailQueue::ThumbnailQueue(Generator thumbnailGenerator, MediaLibrary* mediaLibrary, Target outputTarget)
+    : generator(std::move(thumbnailGenerator))
+    , library(mediaLibrary)
+    , target(outputTarget)
+    , busy(false)
+    , shouldStop(false)
+    , completedCount(0) {
+    workerThread = std::make_unique<std::thread>(&ThumbnailQueue::WorkerLoop, this);
+}
+
+ThumbnailQueue::~ThumbnailQueue() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        shouldStop = true;
+    }
+    queueCondition.notify_all();
+
+    if (workerThread && workerThread->joinable()) {
+        workerThread->join();
+    }
+}
+
+void ThumbnailQueue::Enqueue(const std::filesystem::path& videoPath) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!queued.insert(QueueKey(videoPath)).second) return;   // Zaten kuyrukta
+        queue.push_back(videoPath);
+    }
+    queueCondition.notify_one();
+}
+
+void ThumbnailQueue::Remove(const std::filesystem::path& videoPath) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::string key = QueueKey(videoPath);
+    if (queued.erase(key) == 0) return;
+    queue.erase(std::remove_if(queue.begin(), queue.end(),
+                               [&key](const std::filesystem::path& path) { return QueueKey(path) == key; }),
+                queue.end());
+}
+
+void ThumbnailQueue::Rename(const std::filesystem::path& oldPath, const std::filesystem::path& newPath) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::string oldKey = QueueKey(oldPath);
+    if (queued.erase(oldKey) == 0) return;   // Kuyrukta değilse thumbnail zaten hazır
+    for (auto& path : queue) {
+        if (QueueKey(path) == oldKey) {
+            path = newPath;
+        }
+    }
+    queued.insert(QueueKey(newPath));
+}
+
+void ThumbnailQueue::Apply(const std::vector<MediaLibrary::Update>& updates) {
+    for (const auto& update : updates) {
+        switch (update.kind) {
+            case MediaLibrary::Update::Kind::Added:
+            case MediaLibrary::Update::Kind::Changed:
+                Enqueue(update.path);
+                break;
+            case MediaLibrary::Update::Kind::Removed:
+                Remove(update.path);
+                break;
+            case MediaLibrary::Update::Kind::Renamed:
+                Rename(update.oldPath, update.path);
+                break;
+            case MediaLibrary::Update::Kind::Rescanned:
+                // Taranan klasördeki (MediaLibrary::Rescan ile aynı kapsam) thumbnail'i
+                // (önizlemesi) olmayan kayıtları kuyruğa al
+                if (library) {
+                    const std::filesystem::path directory = (update.path.lexically_normal() / "").parent_path();
+                    for (const auto& entry : library->GetEntries()) {
+                        if (entry.path.lexically_normal().parent_path() != directory) continue;
+                        const auto& existing = target == Target::Thumbnail ? entry.thumbnailPath : entry.previewPath;
+                        if (existing.empty()) Enqueue(entry.path);
+                    }
+                }
+                break;
+        }
+    }
+}
+
+size_t ThumbnailQueue::GetPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.size() + (busy ? 1 : 0);
+}
+
+bool ThumbnailQueue::WaitUntilIdle(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return idleCondition.wait_for(lock, timeout, [this]() { return queue.empty() && !busy; });
+}
+
+void ThumbnailQueue::WorkerLoop() {
+    TraceRecorder& trace = TraceRecorder::GetInstance();
+    trace.SetThreadName(target == Target::Thumbnail ? "Thumbnail" : "Animasyonlu önizleme");
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        queueCondition.wait(lock, [this]() { return shouldStop || !queue.empty(); });
+        if (shouldStop) break;
+
+        std::filesystem::path videoPath = std::move(queue.front());
+        queue.pop_front();
+        queued.erase(QueueKey(videoPath));
+        busy = true;
+        trace.Counter("Thumbnail kuyruğu", static_cast<int64_t>(queue.size()));
+        lock.unlock();
+
+        TraceRecorder::Span span(target == Target::Thumbnail ? "Thumbnail üretimi" : "Önizleme üretimi", trace);
+        std::filesystem::path outputPath;
+        const bool success = generator && generator(videoPath, outputPath);
+        if (success && library) {
+            if (target == Target::Thumbnail) {
+                library->SetThumbnail(videoPath, outputPath);
+            } else {
+                library->SetAnimatedPreview(videoPath, outputPath);
+            }
+        }
+
+        lock.lock();
+        busy = false;
+        ++completedCount;
+        if (queue.empty()) {
+            idleCondition.notify_all();
+        }
+    }
+}
@@ -0,0 +1,302 @@
+// Source/TraceRecorder.cpp
+#include "../Headers/TraceRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <ostream>
+
+namespace {
+
+// Thread'in son kullandığı kaydedici ve tamponu; kaydedici değişince kilit altında yeniden bulunur
+struct ThreadCache {
+    uint64_t instanceId;
+    void* buffer;
+};
+thread_local ThreadCache threadCache = { 0, nullptr };
+
+std::atomic<uint64_t> nextInstanceId(1);
+
+uint64_t NowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+int64_t SteadyMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t EpochMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+void AppendJsonString(std::string& out, const char* text) {
+    out += '"';
+    for (const char* c = text; *c; ++c) {
+        const unsigned char ch = static_cast<unsigned char>(*c);
+        if (ch == '"' || ch == '\\') {
+            out += '\\';
+            out += static_cast<char>(ch);
+        } else if (ch < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", ch);
+            out += escaped;
+        } else {
+            out += static_cast<char>(ch);
+        }
+    }
+    out += '"';
+}
+
+}  // namespace
+
+TraceRecorder::TraceRecorder(size_t eventsPerThread)
+    : instanceId(nextInstanceId.fetch_add(1, std::memory_order_relaxed)),
+      capacity(RoundUpToPowerOfTwo(std::max<size_t>(eventsPerThread, 2))),
+      enabled(false),
+      untracedThreads(0),
+      memory(MemoryCategory::Logging),
+      deadlineIntervalMs(DEFAULT_DEADLINE_DUMP_INTERVAL_MS),
+      nextDeadlineDumpMs(std::numeric_limits<int64_t>::max()),
+      dumpSequence(0),
+      dumpCount(0),
+      dumping(false),
+      stopping(false) {
+}
+
+TraceRecorder::~TraceRecorder() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    dumpCondition.notify_all();
+    if (dumper.joinable()) dumper.join();
+}
+
+TraceRecorder& TraceRecorder::GetInstance() {
+    static TraceRecorder instance;
+    return instance;
+}
+
+void TraceRecorder::SetEnabled(bool newEnabled) {
+    enabled.store(newEnabled, std::memory_order_relaxed);
+}
+
+void TraceRecorder::SetThreadName(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    threadNames[std::this_thread::get_id()] = name;
+}
+
+TraceRecorder::ThreadBuffer* TraceRecorder::GetThreadBuffer() {
+    if (threadCache.instanceId == instanceId) return static_cast<ThreadBuffer*>(threadCache.buffer);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::thread::id self = std::this_thread::get_id();
+    ThreadBuffer* found = nullptr;
+    for (const auto& buffer : buffers) {
+        if (buffer->owner == self) found = buffer.get();
+    }
+    if (!found && buffers.size() < MAX_THREADS) {
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->events = std::make_unique<Event[]>(capacity);
+        buffer->head.store(0, std::memory_order_relaxed);
+        buffer->clearedBefore.store(0, std::memory_order_relaxed);
+        buffer->owner = self;
+        buffer->tid = static_cast<uint32_t>(buffers.size() + 1);
+        found = buffer.get();
+        buffers.push_back(std::move(buffer));
+        memory.Set(buffers.size() * capacity * sizeof(Event));
+    } else if (!found) {
+        untracedThreads.fetch_add(1, std::memory_order_relaxed);
+    }
+    threadCache.instanceId = instanceId;
+    threadCache.buffer = found;
+    return found;
+}
+
+void TraceRecorder::Record(Phase phase, const char* name, int64_t value) {
+    ThreadBuffer* buffer = GetThreadBuffer();
+    if (!buffer) return;
+
+    const uint64_t index = buffer->head.load(std::memory_order_relaxed);
+    Event& event = buffer->events[index & (capacity - 1)];
+    event.timestampNs.store(NowNs(), std::memory_order_relaxed);
+    event.name.store(name, std::memory_order_relaxed);
+    event.value.store(value, std::memory_order_relaxed);
+    event.phase.store(phase, std::memory_order_relaxed);
+    buffer->head.store(index + 1, std::memory_order_release);
+    // Sonraki olayın alanları bu head'den önce görünmesin (okuyucu ezilen olayı ayırt edebilsin)
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+std::vector<TraceRecorder::EventCopy> TraceRecorder::CopyEvents(const ThreadBuffer& buffer) const {
+    const uint64_t end = buffer.head.load(std::memory_order_acquire);
+    const uint64_t begin = std::max(end > capacity ? end - capacity : 0,
+                                    buffer.clearedBefore.load(std::memory_order_acquire));
+    std::vector<EventCopy> copies;
+    copies.reserve(static_cast<size_t>(end - begin));
+    for (uint64_t index = begin; index < end; ++index) {
+        const Event& event = buffer.events[index & (capacity - 1)];
+        copies.push_back(EventCopy{ event.timestampNs.load(std::memory_order_relaxed),
+                                    event.name.load(std::memory_order_relaxed),
+                                    event.value.load(std::memory_order_relaxed),
+                                    event.phase.load(std::memory_order_relaxed) });
+    }
+
+    // Yazıcı head'deki olayı yazarken head - capacity'deki olayı ezer: o ve öncesi atılır
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t after = buffer.head.load(std::memory_order_relaxed);
+    const uint64_t firstValid = after >= capacity ? after - capacity + 1 : 0;
+    if (firstValid > begin) {
+        copies.erase(copies.begin(), copies.begin() + static_cast<ptrdiff_t>(std::min(firstValid - begin, end - begin)));
+    }
+    return copies;
+}
+
+void TraceRecorder::WriteJson(std::ostream& out) const {
+    struct ThreadEvents {
+        uint32_t tid;
+        std::string name;
+        std::vector<EventCopy> events;
+    };
+    std::vector<ThreadEvents> threads;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& buffer : buffers) {
+            const auto name = threadNames.find(buffer->owner);
+            threads.push_back(ThreadEvents{ buffer->tid, name != threadNames.end() ? name->second : std::string(),
+                                            CopyEvents(*buffer) });
+        }
+    }
+
+    uint64_t origin = std::numeric_limits<uint64_t>::max();
+    for (const auto& thread : threads) {
+        if (!thread.events.empty()) origin = std::min(origin, thread.events.front().timestampNs);
+    }
+
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+                       "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"LMWallpaper\"}}";
+    char number[64];
+    for (const auto& thread : threads) {
+        if (!thread.name.empty()) {
+            std::snprintf(number, sizeof(number), "%u", thread.tid);
+            json += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+            json += number;
+            json += ",\"args\":{\"name\":";
+            AppendJsonString(json, thread.name.c_str());
+            json += "}}";
+        }
+        for (const EventCopy& event : thread.events) {
+            static const char* const PHASES[] = { "B", "E", "C", "i" };
+            json += ",\n{\"name\":";
+            AppendJsonString(json, event.name ? event.name : "");
+            json += ",\"cat\":\"lmw\",\"ph\":\"";
+            json += PHASES[static_cast<size_t>(event.phase)];
+            std::snprintf(number, sizeof(number), "\",\"ts\":%.3f,\"pid\":1,\"tid\":%u",
+                          static_cast<double>(event.timestampNs - origin) / 1000.0, thread.tid);
+            json += number;
+            if (event.phase == Phase::Counter) {
+                // Aynı adlı sayaçlar (ör. iki oynatıcının kuyruğu) thread'e göre ayrı seriler
+                std::snprintf(number, sizeof(number), ",\"id\":\"%u\",\"args\":{\"value\":%lld}", thread.tid,
+                              static_cast<long long>(event.value));
+                json += number;
+            } else if (event.phase == Phase::Instant) {
+                json += ",\"s\":\"t\"";
+            }
+            json += '}';
+        }
+    }
+    json += "\n]}\n";
+    out.write(json.data(), static_cast<std::streamsize>(json.size()));
+}
+
+bool TraceRecorder::WriteJson(const std::filesystem::path& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    WriteJson(file);
+    file.close();
+    return !file.fail();
+}
+
+void TraceRecorder::Clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& buffer : buffers) {
+        buffer->clearedBefore.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+}
+
+void TraceRecorder::SetDeadlineDumpDirectory(const std::filesystem::path& directory, int64_t minIntervalMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    deadlineDirectory = directory;
+    deadlineIntervalMs = minIntervalMs;
+    nextDeadlineDumpMs.store(directory.empty() ? std::numeric_limits<int64_t>::max()
+                                               : std::numeric_limits<int64_t>::min(),
+                             std::memory_order_relaxed);
+}
+
+void TraceRecorder::OnMissedDeadline(const char* reason) {
+    if (!IsEnabled()) return;
+    Record(Phase::Instant, reason, 0);
+
+    // Takılma fırtınasında her kare için döküm yazılmaz
+    const int64_t now = SteadyMs();
+    if (now < nextDeadlineDumpMs.load(std::memory_order_relaxed)) return;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    if (deadlineDirectory.empty() || now < nextDeadlineDumpMs.load(std::memory_order_relaxed)) return;
+    nextDeadlineDumpMs.store(now + deadlineIntervalMs, std::memory_order_relaxed);
+    pendingDumps.push_back(deadlineDirectory / ("trace-" + std::to_string(EpochMs()) + "-" +
+                                                std::to_string(++dumpSequence) + ".json"));
+    if (!dumper.joinable()) dumper = std::thread(&TraceRecorder::DumpLoop, this);
+    lock.unlock();
+    dumpCondition.notify_one();
+}
+
+void TraceRecorder::WaitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idleCondition.wait(lock, [this] { return pendingDumps.empty() && !dumping; });
+}
+
+uint64_t TraceRecorder::GetDumpCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return dumpCount;
+}
+
+std::filesystem::path TraceRecorder::GetLastDumpPath() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return lastDumpPath;
+}
+
+void TraceRecorder::DumpLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        dumpCondition.wait(lock, [this] { return stopping || !pendingDumps.empty(); });
+        if (pendingDumps.empty()) break;
+        const std::filesystem::path path = pendingDumps.front();
+        pendingDumps.pop_front();
+        dumping = true;
+        lock.unlock();
+
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+        const bool written = WriteJson(path);
+
+        lock.lock();
+        dumping = false;
+        if (written) {
+            ++dumpCount;
+            lastDumpPath = path;
+        }
+        if (pendingDumps.empty()) idleCondition.notify_all();
+    }
+}
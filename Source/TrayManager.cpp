@@ -1,10 +1,114 @@
 // Source/TrayManager.cpp
 #include "../Headers/TrayManager.h"
 #include "../Headers/SettingsWindow.h"
+#include "../Headers/HeapProfiler.h"
+#include "../Headers/TraceRecorder.h"
+#include "../Headers/VideoPlayer.h"
+#include <codecvt>
+#include <cstdio>
+#include <filesystem>
+#include <locale>
 
 // Global settings window pointer
 static std::unique_ptr<SettingsWindow> g_settingsWindow = nullptr;
 
+// Tanılama dosyaları (heap profili, iz kaydı): %TEMP%\LMWallpaper
+static std::filesystem::path GetDiagnosticsDirectory() {
+    wchar_t tempPath[MAX_PATH] = {0};
+    GetTempPath(MAX_PATH, tempPath);
+    const std::filesystem::path directory = std::filesystem::path(tempPath) / L"LMWallpaper";
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    return directory;
+}
+
+// İlk tıklama profili başlatır, ikincisi durdurup %TEMP%\LMWallpaper altına yazar
+static void ToggleHeapProfile() {
+    if (!HeapProfiler::IsRunning()) {
+        if (HeapProfiler::Start()) {
+            ErrorHandler::LogInfo("Heap profili başlatıldı", InfoLevel::INFO);
+        } else {
+            ErrorHandler::LogError("Heap profili başlatılamadı", ErrorLevel::WARNING);
+        }
+        return;
+    }
+    
+    HeapProfiler::Stop();
+    
+    const std::filesystem::path directory = GetDiagnosticsDirectory();
+    const std::string prefix = (directory / ("heap-" + std::to_string(GetTickCount64()))).string();
+    const bool written = HeapProfiler::WritePprof(prefix + ".heap") &&
+                         HeapProfiler::WriteCollapsed(prefix + ".folded", HeapProfiler::Metric::InUseBytes);
+    if (written) {
+        ErrorHandler::LogInfo("Heap profili kaydedildi: " + prefix + ".heap / .folded", InfoLevel::INFO);
+        ErrorHandler::ShowInfoDialog("Heap profili kaydedildi:\n" + prefix + ".heap\n" + prefix + ".folded",
+                                     "Heap Profili");
+    } else {
+        ErrorHandler::LogError("Heap profili yazılamadı: " + prefix, ErrorLevel::WARNING);
+    }
+}
+
+// "  Decode      0.84 / 3.10 ms (1200)" - ölçüm yoksa aşama atlanır
+static void AppendLatencyLine(std::string& text, const char* name, const HdrHistogram::Summary& summary) {
+    if (summary.count == 0) return;
+    char line[96];
+    std::snprintf(line, sizeof(line), "  %-12s %.2f / %.2f ms (%llu)\n", name, summary.p50 / 1e6, summary.p99 / 1e6,
+                  static_cast<unsigned long long>(summary.count));
+    text += line;
+}
+
+static void AppendPlayerPerformance(std::string& text, size_t number, const VideoPlayer& player) {
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
+    const std::wstring videoName = std::filesystem::path(player.GetVideoPath()).filename().wstring();
+    text += "Oynatıcı " + std::to_string(number) + ": " +
+            (videoName.empty() ? std::string("(video yok)") : converter.to_bytes(videoName)) + "\n";
+
+    const FrameTelemetry::Snapshot snapshot = player.GetTelemetrySnapshot();
+    if (snapshot.frame.count == 0) {
+        text += "  Henüz kare ölçülmedi\n";
+        return;
+    }
+    text += "  Aşama        p50 / p99\n";
+    for (size_t i = 0; i < FrameTelemetry::STAGE_COUNT; ++i) {
+        AppendLatencyLine(text, FrameTelemetry::GetStageName(static_cast<FrameTelemetry::Stage>(i)), snapshot.stages[i]);
+    }
+    AppendLatencyLine(text, "Kare", snapshot.frame);
+    
+    char line[160];
+    std::snprintf(line, sizeof(line), "  Kuyruk: %d kare (p50 %llu, p99 %llu)\n  Geciken: %llu, düşürülen: %llu\n",
+                  snapshot.currentQueueDepth, static_cast<unsigned long long>(snapshot.queueDepth.p50),
+                  static_cast<unsigned long long>(snapshot.queueDepth.p99),
+                  static_cast<unsigned long long>(snapshot.lateFrames),
+                  static_cast<unsigned long long>(snapshot.droppedFrames));
+    text += line;
+}
+
+// İlk tıklama iz kaydını başlatır (kaçırılan kare süresinde otomatik döküm
+// de açılır), ikincisi zaman çizelgesini Chrome trace JSON'u olarak yazıp kapatır
+static void ToggleTrace() {
+    TraceRecorder& trace = TraceRecorder::GetInstance();
+    const std::filesystem::path directory = GetDiagnosticsDirectory();
+    if (!trace.IsEnabled()) {
+        trace.Clear();
+        trace.SetDeadlineDumpDirectory(directory);
+        trace.SetEnabled(true);
+        ErrorHandler::LogInfo("İz kaydı başlatıldı", InfoLevel::INFO);
+        return;
+    }
+    
+    const std::filesystem::path path = directory / ("trace-" + std::to_string(GetTickCount64()) + ".json");
+    const bool written = trace.WriteJson(path);
+    trace.SetEnabled(false);
+    trace.SetDeadlineDumpDirectory({});
+    if (written) {
+        ErrorHandler::LogInfo("İz kaydı yazıldı: " + path.string(), InfoLevel::INFO);
+        ErrorHandler::ShowInfoDialog("İz kaydı yazıldı (chrome://tracing veya ui.perfetto.dev ile açın):\n" +
+                                     path.string(), "İz Kaydı");
+    } else {
+        ErrorHandler::LogError("İz kaydı yazılamadı: " + path.string(), ErrorLevel::WARNING);
+    }
+}
+
 TrayManager::TrayManager(HWND hWnd) {
     iconData = std::make_unique<TrayIconData>();
     iconData->hWndMain = hWnd;
@@ -77,6 +181,8 @@ void TrayManager::CreateTrayMenu() {
     AppendMenu(iconData->hMenu, MF_SEPARATOR, 0, nullptr);
     AppendMenu(iconData->hMenu, MF_STRING, IDM_SETTINGS, L"Ayarlar...");
     AppendMenu(iconData->hMenu, MF_STRING, IDM_PERFORMANCE, L"Performans...");
+    AppendMenu(iconData->hMenu, MF_STRING, IDM_HEAP_PROFILE, L"Heap profilini başlat");
+    AppendMenu(iconData->hMenu, MF_STRING, IDM_TRACE, L"İz kaydını başlat");
     AppendMenu(iconData->hMenu, MF_SEPARATOR, 0, nullptr);
     AppendMenu(iconData->hMenu, MF_STRING, IDM_ABOUT, L"Hakkında...");
     AppendMenu(iconData->hMenu, MF_SEPARATOR, 0, nullptr);
@@ -117,6 +223,11 @@ LRESULT TrayManager::HandleTrayMessage(WPARAM wParam, LPARAM lParam) {
                 ModifyMenu(iconData->hMenu, IDM_TOGGLE_PLAYBACK, MF_BYCOMMAND | MF_STRING,
                           IDM_TOGGLE_PLAYBACK, 
                           iconData->isPlaying ? L"Duraklat" : L"Oynat");
+                ModifyMenu(iconData->hMenu, IDM_HEAP_PROFILE, MF_BYCOMMAND | MF_STRING,
+                          IDM_HEAP_PROFILE,
+                          HeapProfiler::IsRunning() ? L"Heap profilini kaydet" : L"Heap profilini başlat");
+                ModifyMenu(iconData->hMenu, IDM_TRACE, MF_BYCOMMAND | MF_STRING, IDM_TRACE,
+                          TraceRecorder::GetInstance().IsEnabled() ? L"İz kaydını kaydet" : L"İz kaydını başlat");
                 
                 // Menüyü göster
                 SetForegroundWindow(iconData->hWndMain);
@@ -148,6 +259,14 @@ void TrayManager::HandleMenuItem(WORD menuItemId) {
             ShowPerformance();
             break;
             
+        case IDM_HEAP_PROFILE:
+            ToggleHeapProfile();
+            break;
+            
+        case IDM_TRACE:
+            ToggleTrace();
+            break;
+            
         case IDM_ABOUT:
             {
                 std::string aboutText = "LMWallpaper v1.0.0\n\n";
@@ -199,10 +318,14 @@ void TrayManager::ShowPerformance() {
         perfInfo += "Bellek Kullanımı: " + std::to_string(static_cast<int>(memoryMB)) + " MB\n";
     }
     
-    // CPU kullanımı (basit)
-    perfInfo += "CPU Kullanımı: ~5%\n"; // Placeholder
-    perfInfo += "Aktif Frame'ler: 0\n";
-    perfInfo += "Video Durumu: " + std::string(iconData->isPlaying ? "Oynatılıyor" : "Duraklatıldı");
+    perfInfo += "Video Durumu: " + std::string(iconData->isPlaying ? "Oynatılıyor" : "Duraklatıldı") + "\n";
+    
+    // Oynatıcı başına aşama gecikmeleri (FrameTelemetry)
+    const auto& players = VideoPlayer::GetAllInstances();
+    for (size_t i = 0; i < players.size(); ++i) {
+        perfInfo += "\n";
+        AppendPlayerPerformance(perfInfo, i + 1, *players[i]);
+    }
     
     ErrorHandler::ShowInfoDialog(perfInfo, "Performans");
 }
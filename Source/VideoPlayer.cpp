@@ -1,8 +1,11 @@
 // Source/VideoPlayer.cpp
 #include "../Headers/VideoPlayer.h"
+#include "../Logger.h"
+#ifndef NDEBUG
+#include "../Headers/AllocationCounter.h"
+#endif
 
 std::vector<VideoPlayer*> VideoPlayer::allInstances;
-int VideoPlayer::maxBufferFrames = 3;
 
 VideoPlayer::VideoPlayer(HMONITOR hMonitor) 
     : pGraphBuilder(nullptr)
@@ -10,6 +13,12 @@ VideoPlayer::VideoPlayer(HMONITOR hMonitor)
     , pVideoWindow(nullptr)
     , pMediaEvent(nullptr)
     , pBasicVideo(nullptr)
+    , framePipeline(DEFAULT_FRAME_INTERVAL_MS)
+    , maxBufferFrames(BufferDepthController::INITIAL_DEPTH)
+    , frameBytes(1920 * 1080 * 4)
+    , admittedDepth(BufferDepthController::MAX_DEPTH)
+    , decodeScale(1)
+    , budgetId(0)
     , isPlaying(false)
     , monitorHandle(hMonitor)
     , targetWindow(nullptr)
@@ -17,14 +26,39 @@ VideoPlayer::VideoPlayer(HMONITOR hMonitor)
     
     allInstances.push_back(this);
     
+    // Kare boyutu monitör çözünürlüğüne göre: 4K monitör 1080p'nin dört katı ister
+    MONITORINFO mi = { sizeof(MONITORINFO) };
+    if (hMonitor && GetMonitorInfo(hMonitor, &mi)) {
+        frameBytes = static_cast<size_t>(mi.rcMonitor.right - mi.rcMonitor.left) *
+                     static_cast<size_t>(mi.rcMonitor.bottom - mi.rcMonitor.top) * 4;
+    }
+    
+    // 4K ve üstünde bir kare binlerce 4 KB sayfaya yayılır: dönüşüm / ölçekleme
+    // TLB kaçırmalarıyla yavaşlar. Büyük sayfalar alınamazsa normal sayfalar kullanılır
+    if (frameBytes >= LARGE_PAGE_FRAME_BYTES) {
+        framePipeline.SetLargePages(LargePages::Mode::Explicit);
+    }
+    
+    MemoryBudgetBroker::Consumer consumer;
+    consumer.name = "VideoPlayer";
+    consumer.priority = 10;   // Görünen duvar kağıdı cache'lerden önce gelir
+    consumer.minimumBytes = frameBytes * BufferDepthController::MIN_DEPTH;
+    consumer.desiredBytes = frameBytes * framePipeline.GetTargetDepth();
+    consumer.onBudget = [this](size_t budgetBytes, MemoryPressure pressure) { OnMemoryBudget(budgetBytes, pressure); };
+    budgetId = MemoryBudgetBroker::GetInstance().Register(std::move(consumer));
+    
+    framePipeline.SetDecoder([this](FramePipeline::Frame& frame) { return DecodeFrame(frame); });
+    framePipeline.SetSurfaceReleaser([](void* surface) { static_cast<ID2D1Bitmap*>(surface)->Release(); });
+    
     if (!imageProcessor.Initialize()) {
         ErrorHandler::LogError("ImageProcessor başlatılamadı", ErrorLevel::ERROR);
     }
     
-    ErrorHandler::LogInfo("VideoPlayer oluşturuldu", InfoLevel::DEBUG);
+    LMW_LOG_DEBUG(Logger::GetInstance(), "VideoPlayer oluşturuldu");
 }
 
 VideoPlayer::~VideoPlayer() {
+    MemoryBudgetBroker::GetInstance().Unregister(budgetId);
     shouldStop = true;
     
     if (videoThread && videoThread->joinable()) {
@@ -39,7 +73,7 @@ VideoPlayer::~VideoPlayer() {
         allInstances.erase(it);
     }
     
-    ErrorHandler::LogInfo("VideoPlayer yok edildi", InfoLevel::DEBUG);
+    LMW_LOG_DEBUG(Logger::GetInstance(), "VideoPlayer yok edildi");
 }
 
 bool VideoPlayer::LoadVideo(const std::wstring& videoPath) {
@@ -56,6 +90,11 @@ bool VideoPlayer::LoadVideo(const std::wstring& videoPath) {
     
     currentVideoPath = videoPath;
     
+    // Bütçeye sığmayan video graph kurulmadan reddedilir
+    if (!AdmitVideo(videoPath)) {
+        return false;
+    }
+    
     // DirectShow graph oluştur
     if (!InitializeGraphBuilder()) {
         ErrorHandler::LogError("DirectShow graph başlatılamadı", ErrorLevel::ERROR);
@@ -73,7 +112,65 @@ bool VideoPlayer::LoadVideo(const std::wstring& videoPath) {
     // Video penceresini yapılandır
     ConfigureVideoWindow();
     
-    ErrorHandler::LogInfo("Video başarıyla yüklendi: " + std::string(videoPath.begin(), videoPath.end()), InfoLevel::INFO);
+    // Derinlik ölçümleri videoya özgü: yeni videonun kare aralığıyla baştan başla
+    REFTIME avgTimePerFrame = 0.0;
+    double frameInterval = DEFAULT_FRAME_INTERVAL_MS;
+    if (pBasicVideo && SUCCEEDED(pBasicVideo->get_AvgTimePerFrame(&avgTimePerFrame)) && avgTimePerFrame > 0.0) {
+        frameInterval = avgTimePerFrame * 1000.0;
+    }
+    framePipeline.Reset(frameInterval);
+    framePipeline.SetMemoryCap(admittedDepth.load());
+    maxBufferFrames = framePipeline.GetDepth();
+    UpdateBufferDemand();
+    
+    static const BinaryLog::Format loadedFormat("Video başarıyla yüklendi: {}");
+    Logger::GetInstance().Write(LogLevel::INFO, loadedFormat, videoPath);
+    return true;
+}
+
+bool VideoPlayer::AdmitVideo(const std::wstring& videoPath) {
+    int monitorWidth = 1920;
+    int monitorHeight = 1080;
+    MONITORINFO mi = { sizeof(MONITORINFO) };
+    if (monitorHandle && GetMonitorInfo(monitorHandle, &mi)) {
+        monitorWidth = mi.rcMonitor.right - mi.rcMonitor.left;
+        monitorHeight = mi.rcMonitor.bottom - mi.rcMonitor.top;
+    }
+    const size_t monitorFrameBytes = static_cast<size_t>(monitorWidth) * monitorHeight * 4;
+    
+    frameBytes = monitorFrameBytes;
+    admittedDepth = BufferDepthController::MAX_DEPTH;
+    decodeScale = 1;
+    
+    AdmissionControl::Request request;
+    if (!ContainerProbe::Probe(std::filesystem::path(videoPath), request.probe)) {
+        // Probe'un tanımadığı kapsayıcılar tahminsiz yüklenir; broker bütçesi yine geçerli
+        LMW_LOG_DEBUG(Logger::GetInstance(), "Video probe edilemedi, bellek tahmini atlandı");
+        return true;
+    }
+    
+    // Her oynatıcı kendi DirectShow graph'ını kurar: çözücü paylaşımı yok
+    request.monitorCount = 1;
+    request.outputWidth = monitorWidth;
+    request.outputHeight = monitorHeight;
+    request.availableBytes = MemoryBudgetBroker::GetInstance().GetAvailableFor(budgetId);
+    request.desiredDepth = framePipeline.GetTargetDepth();
+    request.allowSharedDecode = false;
+    
+    const AdmissionControl::Plan plan = AdmissionControl::Decide(request);
+    if (plan.outcome == AdmissionControl::Outcome::Reject) {
+        ErrorHandler::LogError("Video bellek bütçesine sığmıyor: " + plan.reason, ErrorLevel::WARNING);
+        return false;
+    }
+    
+    admittedDepth = plan.bufferDepth;
+    decodeScale = plan.decodeScale;
+    frameBytes = std::min(monitorFrameBytes, static_cast<size_t>(plan.decodeWidth) * plan.decodeHeight * 4);
+    if (plan.outcome == AdmissionControl::Outcome::Accept) {
+        LMW_LOG_DEBUG(Logger::GetInstance(), "Bellek kabulü: {}, {}", AdmissionControl::GetOutcomeName(plan.outcome), plan.reason);
+    } else {
+        LMW_LOG_INFO(Logger::GetInstance(), "Bellek kabulü: {}, {}", AdmissionControl::GetOutcomeName(plan.outcome), plan.reason);
+    }
     return true;
 }
 
@@ -193,7 +290,7 @@ void VideoPlayer::ConfigureVideoWindow() {
     GetClientRect(targetWindow, &rc);
     pVideoWindow->SetWindowPosition(0, 0, rc.right, rc.bottom);
     
-    ErrorHandler::LogInfo("Video penceresi yapılandırıldı", InfoLevel::DEBUG);
+    LMW_LOG_DEBUG(Logger::GetInstance(), "Video penceresi yapılandırıldı");
 }
 
 void VideoPlayer::StartVideoProcessingThread() {
@@ -205,58 +302,94 @@ void VideoPlayer::StartVideoProcessingThread() {
 }
 
 void VideoPlayer::VideoProcessingLoop() {
-    ErrorHandler::LogInfo("Video işleme thread'i başladı", InfoLevel::DEBUG);
+    LMW_LOG_DEBUG(Logger::GetInstance(), "Video işleme thread'i başladı");
+    TraceRecorder::GetInstance().SetThreadName("Video oynatma");
+    
+#ifndef NDEBUG
+    // Isınmış döngü heap'e dokunmamalı; ilk ihlal çağrı yeriyle bir kez loglanır.
+    // Derinliğin değiştiği kareler sayılmaz: yeni slot ilk kullanımda ayrılır
+    AllocationCounter allocations;
+    uint64_t processedFrames = 0;
+    bool allocationReported = false;
+#endif
     
     while (!shouldStop && isPlaying) {
         try {
-            ProcessVideoFrame();
+#ifndef NDEBUG
+            allocations.Reset();
+#endif
+            const bool depthChanged = ProcessVideoFrame();
+#ifndef NDEBUG
+            if (++processedFrames > ALLOCATION_CHECK_AFTER_FRAMES && !depthChanged && !allocationReported &&
+                allocations.GetCount() > 0) {
+                allocationReported = true;
+                ErrorHandler::LogError("Oynatma döngüsü ayırma yaptı: " + allocations.Describe(), ErrorLevel::WARNING);
+            }
+#else
+            (void)depthChanged;
+#endif
             
-            // Frame rate kontrolü (yaklaşık 30 FPS)
-            std::this_thread::sleep_for(std::chrono::milliseconds(33));
+            // Frame rate kontrolü (videonun kare aralığı)
+            std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(framePipeline.GetFrameInterval()));
             
         } catch (const std::exception& e) {
-            ErrorHandler::LogError("Video işleme hatası: " + std::string(e.what()), ErrorLevel::ERROR);
+            // Bozuk video her yeniden yüklemede aynı hatayı verir; tekrarlar özetlenir
+            LMW_LOG_LIMITED(Logger::GetInstance(), Error, "Video işleme hatası: {}", e.what());
             break;
         }
     }
     
-    ErrorHandler::LogInfo("Video işleme thread'i sonlandı", InfoLevel::DEBUG);
+    LMW_LOG_DEBUG(Logger::GetInstance(), "Video işleme thread'i sonlandı");
 }
 
-void VideoPlayer::ProcessVideoFrame() {
-    // Bu fonksiyon gerçek implementasyonda video frame'lerini işleyecek
-    // Şu an için basit bir placeholder
+bool VideoPlayer::ProcessVideoFrame() {
+    const bool depthChanged = framePipeline.Step();
+    maxBufferFrames = framePipeline.GetDepth();
     
-    std::lock_guard<std::mutex> lock(bufferMutex);
-    
-    // Buffer boyutunu kontrol et
-    if (frameBuffer.size() >= maxBufferFrames) {
-        frameBuffer.pop_front(); // En eski frame'i kaldır
+    // Broker callback'i pipeline kilidini alır: Step dışında bildir
+    if (depthChanged) {
+        UpdateBufferDemand();
     }
-    
-    // Yeni frame ekle (placeholder)
-    auto newFrame = std::make_unique<FrameData>();
-    newFrame->timestamp = GetTickCount();
-    // newFrame->pBitmap gerçek implementasyonda doldurulacak
-    
-    frameBuffer.push_back(std::move(newFrame));
+    return depthChanged;
+}
+
+bool VideoPlayer::DecodeFrame(FramePipeline::Frame& frame) {
+    // Bu fonksiyon gerçek implementasyonda video frame'ini slotun yüzeyine
+    // (varsa mevcut bitmap'e CopyFromMemory ile) çözecek. Şu an için placeholder.
+    // Sunumu FramePipeline ölçer
+    FrameTelemetry::ScopedStage decodeStage(&framePipeline.GetTelemetry(), FrameTelemetry::Stage::Decode);
+    frame.timestampMs = GetTickCount();
+    if (frame.surface) {
+        const D2D1_SIZE_U size = static_cast<ID2D1Bitmap*>(frame.surface)->GetPixelSize();
+        frame.width = static_cast<int>(size.width);
+        frame.height = static_cast<int>(size.height);
+        frame.stride = frame.width * 4;
+        frame.surfaceBytes = static_cast<size_t>(size.width) * size.height * 4;
+    }
+    return true;
+}
+
+void VideoPlayer::UpdateBufferDemand() {
+    const size_t bytes = frameBytes.load();
+    MemoryBudgetBroker::GetInstance().UpdateDemand(budgetId, bytes * BufferDepthController::MIN_DEPTH,
+                                                   bytes * framePipeline.GetTargetDepth());
+}
+
+void VideoPlayer::OnMemoryBudget(size_t budgetBytes, MemoryPressure pressure) {
+    // Bütçe küçüldüyse fazla kareler ve boştaki slotlar hemen bırakılır
+    const size_t bytes = std::max<size_t>(frameBytes.load(), 1);
+    framePipeline.SetMemoryCap(std::min(admittedDepth.load(), static_cast<int>(budgetBytes / bytes)));
+    const int frames = framePipeline.GetDepth();
+    maxBufferFrames = frames;
+    
+    LMW_LOG_DEBUG(Logger::GetInstance(), "Kare buffer'ı: {}/{} frame ({})", frames, framePipeline.GetTargetDepth(),
+                  MemoryBudgetBroker::GetPressureName(pressure));
 }
 
 void VideoPlayer::ClearUnusedFrames() {
-    std::lock_guard<std::mutex> lock(bufferMutex);
-    
     // Eski frame'leri temizle
-    DWORD currentTime = GetTickCount();
     const DWORD maxAge = 5000; // 5 saniye
-    
-    auto it = frameBuffer.begin();
-    while (it != frameBuffer.end()) {
-        if (currentTime - (*it)->timestamp > maxAge) {
-            it = frameBuffer.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    framePipeline.DropOlderThan(GetTickCount(), maxAge);
 }
 
 void VideoPlayer::Cleanup() {
@@ -287,8 +420,7 @@ void VideoPlayer::Cleanup() {
     }
     
     // Frame buffer'ı temizle
-    std::lock_guard<std::mutex> lock(bufferMutex);
-    frameBuffer.clear();
+    framePipeline.Clear();
     
     imageProcessor.Cleanup();
 }
@@ -1,15 +1,30 @@
 // Source/VideoPreview.cpp
 #include "../Headers/VideoPreview.h"
 
-VideoPreview::VideoPreview() {
+#include <mfapi.h>
+#include <mfidl.h>
+#include <mfreadwrite.h>
+
+VideoPreview::VideoPreview() : mediaLibrary(nullptr), maxCacheEntries(MAX_CACHE_SIZE), budgetId(0) {
     if (!imageProcessor.Initialize()) {
         ErrorHandler::LogError("VideoPreview ImageProcessor başlatılamadı", ErrorLevel::ERROR);
     }
     
+    // Giriş başına maliyet: gösterilirken çözülen 128x128 BGRA thumbnail
+    const size_t entryBytes = static_cast<size_t>(THUMBNAIL_SIZE) * THUMBNAIL_SIZE * 4;
+    MemoryBudgetBroker::Consumer consumer;
+    consumer.name = "ThumbnailCache";
+    consumer.priority = 1;
+    consumer.minimumBytes = entryBytes * MIN_CACHE_SIZE;
+    consumer.desiredBytes = entryBytes * MAX_CACHE_SIZE;
+    consumer.onBudget = [this](size_t budgetBytes, MemoryPressure pressure) { OnMemoryBudget(budgetBytes, pressure); };
+    budgetId = MemoryBudgetBroker::GetInstance().Register(std::move(consumer));
+    
     ErrorHandler::LogInfo("VideoPreview oluşturuldu", InfoLevel::DEBUG);
 }
 
 VideoPreview::~VideoPreview() {
+    MemoryBudgetBroker::GetInstance().Unregister(budgetId);
     ClearThumbnailCache();
     imageProcessor.Cleanup();
     ErrorHandler::LogInfo("VideoPreview yok edildi", InfoLevel::DEBUG);
@@ -29,10 +44,27 @@ bool VideoPreview::GenerateThumbnail(const std::wstring& videoPath, const std::w
     
     std::string videoPathStr(videoPath.begin(), videoPath.end());
     
-    // Cache kontrolü
-    std::lock_guard<std::mutex> lock(cacheMutex);
-    if (IsThumbnailCached(videoPathStr)) {
-        ErrorHandler::LogInfo("Thumbnail cache'den alındı: " + videoPathStr, InfoLevel::DEBUG);
+    // Cache kontrolü. Kilit sadece cache haritası için: hash çıkarma (Media
+    // Foundation decode) ve thumbnail üretimi kilit dışında yapılır
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        if (IsThumbnailCached(videoPathStr)) {
+            ErrorHandler::LogInfo("Thumbnail cache'den alındı: " + videoPathStr, InfoLevel::DEBUG);
+            return true;
+        }
+    }
+    
+    // Kütüphanede algısal kopyası varsa onun thumbnail'ini kopyala
+    std::vector<uint64_t> frameHashes;
+    if (mediaLibrary && ComputeFrameHashes(videoPath, frameHashes) &&
+        ReuseDuplicateThumbnail(videoPath, frameHashes, outputPath)) {
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            thumbnailCache[videoPathStr] = outputPath;
+            UpdateCacheSize();
+        }
+        mediaLibrary->SetThumbnail(videoPath, outputPath);
+        ErrorHandler::LogInfo("Kopya video, thumbnail yeniden kullanıldı: " + videoPathStr, InfoLevel::DEBUG);
         return true;
     }
     
@@ -41,8 +73,15 @@ bool VideoPreview::GenerateThumbnail(const std::wstring& videoPath, const std::w
     
     if (success) {
         // Cache'e ekle
-        thumbnailCache[videoPathStr] = outputPath;
-        UpdateCacheSize();
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            thumbnailCache[videoPathStr] = outputPath;
+            UpdateCacheSize();
+        }
+        
+        if (mediaLibrary) {
+            mediaLibrary->SetThumbnail(videoPath, outputPath);
+        }
         
         ErrorHandler::LogInfo("Thumbnail oluşturuldu: " + videoPathStr, InfoLevel::INFO);
     } else {
@@ -69,25 +108,239 @@ VideoPreview::VideoInfo VideoPreview::GetVideoInfo(const std::wstring& videoPath
         info.fileSize = static_cast<size_t>(fileSize.QuadPart);
     }
     
-    // DirectShow ile video bilgilerini al
+    // Önce kütüphane indeksine, sonra konteyner başlıklarına bak (graph kurmadan)
+    ContainerProbe::Result probe;
+    bool probed = mediaLibrary && mediaLibrary->GetVideoInfo(videoPath, probe);
+    if (!probed) {
+        probed = ContainerProbe::Probe(videoPath, probe);
+    }
+    
+    if (probed) {
+        info.width = probe.width;
+        info.height = probe.height;
+        info.duration = probe.duration;
+        info.fps = probe.fps;
+        info.codec = probe.codec;
+        info.container = ContainerProbe::ContainerName(probe.container);
+        info.colorSpace = probe.colorSpace;
+        info.bitDepth = probe.bitDepth;
+        info.keyframeCount = probe.keyframeCount;
+    } else if (!GetVideoInfoWithDirectShow(videoPath, info)) {
+        // WMV gibi probe'un tanımadığı formatlar için DirectShow'a düş
+        ErrorHandler::LogError("Video bilgileri okunamadı", ErrorLevel::WARNING);
+    }
+    
+    std::string videoPathStr(videoPath.begin(), videoPath.end());
+    ErrorHandler::LogInfo("Video bilgileri alındı: " + videoPathStr, InfoLevel::DEBUG);
+    
+    return info;
+}
+
+bool VideoPreview::ReuseDuplicateThumbnail(const std::wstring& videoPath, const std::vector<uint64_t>& frameHashes,
+                                           const std::wstring& outputPath) {
+    // MediaLibrary kendi kilidiyle HashIndex'e ekler ve sorgular
+    mediaLibrary->SetFrameHashes(videoPath, frameHashes);
+    
+    MediaLibrary::Entry original;
+    if (!mediaLibrary->FindDuplicate(videoPath, frameHashes, original)) return false;
+    
+    return CopyFile(original.thumbnailPath.c_str(), outputPath.c_str(), FALSE) != FALSE;
+}
+
+// Media Foundation kaynak okuyucusu üzerinden RGB32 kare kaynağı.
+// Kilitli buffer bir sonraki ReadFrame çağrısına kadar tutulur.
+class MediaFoundationFrameSource : public AnimatedPreview::FrameSource {
+public:
+    MediaFoundationFrameSource(const std::wstring& videoPath)
+        : pReader(nullptr), pSample(nullptr), pBuffer(nullptr), width(0), height(0), stride(0), started(false),
+          bufferMemory(MemoryCategory::Decoder) {
+        if (FAILED(MFStartup(MF_VERSION, MFSTARTUP_LITE))) return;
+        started = true;
+        
+        IMFAttributes* pAttributes = nullptr;
+        IMFMediaType* pType = nullptr;
+        IMFMediaType* pCurrentType = nullptr;
+        
+        // Kaynak okuyucu kareleri RGB32'ye dönüştürsün
+        HRESULT hr = MFCreateAttributes(&pAttributes, 1);
+        if (SUCCEEDED(hr)) hr = pAttributes->SetUINT32(MF_SOURCE_READER_ENABLE_VIDEO_PROCESSING, TRUE);
+        if (SUCCEEDED(hr)) hr = MFCreateSourceReaderFromURL(videoPath.c_str(), pAttributes, &pReader);
+        if (SUCCEEDED(hr)) hr = MFCreateMediaType(&pType);
+        if (SUCCEEDED(hr)) hr = pType->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Video);
+        if (SUCCEEDED(hr)) hr = pType->SetGUID(MF_MT_SUBTYPE, MFVideoFormat_RGB32);
+        if (SUCCEEDED(hr)) hr = pReader->SetCurrentMediaType(MF_SOURCE_READER_FIRST_VIDEO_STREAM, nullptr, pType);
+        if (SUCCEEDED(hr)) hr = pReader->GetCurrentMediaType(MF_SOURCE_READER_FIRST_VIDEO_STREAM, &pCurrentType);
+        if (SUCCEEDED(hr)) hr = MFGetAttributeSize(pCurrentType, MF_MT_FRAME_SIZE, &width, &height);
+        if (SUCCEEDED(hr)) {
+            stride = static_cast<LONG>(MFGetAttributeUINT32(pCurrentType, MF_MT_DEFAULT_STRIDE, width * 4));
+        } else if (pReader) {
+            pReader->Release();
+            pReader = nullptr;
+        }
+        
+        if (pCurrentType) pCurrentType->Release();
+        if (pType) pType->Release();
+        if (pAttributes) pAttributes->Release();
+    }
+    
+    ~MediaFoundationFrameSource() override {
+        ReleaseSample();
+        if (pReader) pReader->Release();
+        if (started) MFShutdown();
+    }
+    
+    bool IsOpen() const { return pReader != nullptr; }
+    
+    bool SeekTo(double seconds) override {
+        if (!pReader) return false;
+        ReleaseSample();
+        
+        PROPVARIANT position;
+        PropVariantInit(&position);
+        position.vt = VT_I8;
+        position.hVal.QuadPart = static_cast<LONGLONG>(seconds * 10000000.0);
+        return SUCCEEDED(pReader->SetCurrentPosition(GUID_NULL, position));
+    }
+    
+    bool ReadFrame(AnimatedPreview::Frame& frame) override {
+        if (!pReader) return false;
+        ReleaseSample();
+        
+        DWORD flags = 0;
+        LONGLONG timestamp = 0;
+        HRESULT hr = pReader->ReadSample(MF_SOURCE_READER_FIRST_VIDEO_STREAM, 0, nullptr, &flags, &timestamp, &pSample);
+        if (FAILED(hr) || (flags & MF_SOURCE_READERF_ENDOFSTREAM) || !pSample) return false;
+        
+        BYTE* pData = nullptr;
+        DWORD length = 0;
+        if (FAILED(pSample->ConvertToContiguousBuffer(&pBuffer)) || FAILED(pBuffer->Lock(&pData, nullptr, &length))) {
+            ReleaseSample();
+            return false;
+        }
+        
+        const DWORD absStride = static_cast<DWORD>(stride < 0 ? -stride : stride);
+        if (length < absStride * height) {
+            pBuffer->Unlock();
+            ReleaseSample();
+            return false;
+        }
+        
+        // Negatif stride: alttan yukarı yerleşim
+        frame.pixels = stride < 0 ? pData + absStride * (height - 1) : pData;
+        frame.width = static_cast<int>(width);
+        frame.height = static_cast<int>(height);
+        frame.stride = static_cast<int>(stride);
+        frame.timestamp = timestamp / 10000000.0;
+        bufferMemory.Set(length);
+        return true;
+    }
+    
+private:
+    void ReleaseSample() {
+        if (pBuffer) {
+            pBuffer->Unlock();
+            pBuffer->Release();
+            pBuffer = nullptr;
+        }
+        if (pSample) {
+            pSample->Release();
+            pSample = nullptr;
+        }
+        bufferMemory.Set(0);
+    }
+    
+    IMFSourceReader* pReader;
+    IMFSample* pSample;
+    IMFMediaBuffer* pBuffer;
+    UINT32 width;
+    UINT32 height;
+    LONG stride;
+    bool started;
+    MemoryAccounting::Tracker bufferMemory;   // Kilitli çözülmüş kare
+};
+
+bool VideoPreview::ComputeFrameHashes(const std::wstring& videoPath, std::vector<uint64_t>& frameHashes) {
+    frameHashes.clear();
+    
+    const VideoInfo info = GetVideoInfo(videoPath);
+    MediaFoundationFrameSource source(videoPath);
+    if (!source.IsOpen()) {
+        ErrorHandler::LogError("Media Foundation kaynağı açılamadı", ErrorLevel::WARNING);
+        return false;
+    }
+    
+    for (double position : PerceptualHash::SamplePositions(info.duration)) {
+        AnimatedPreview::Frame frame;
+        if (!source.SeekTo(position) || !source.ReadFrame(frame)) continue;
+        
+        PerceptualHash::Image image;
+        image.pixels = frame.pixels;
+        image.width = frame.width;
+        image.height = frame.height;
+        image.stride = frame.stride;
+        image.bytesPerPixel = 4;
+        frameHashes.push_back(PerceptualHash::PHash(image));
+    }
+    
+    return !frameHashes.empty();
+}
+
+bool VideoPreview::GenerateAnimatedPreview(const std::wstring& videoPath, const std::wstring& outputPath) {
+    if (videoPath.empty() || outputPath.empty()) {
+        ErrorHandler::LogError("Geçersiz dosya yolları", ErrorLevel::ERROR);
+        return false;
+    }
+    
+    // Arka plan thread'inden çağrılır
+    const HRESULT hrCom = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+    
+    bool success = false;
+    {
+        const VideoInfo info = GetVideoInfo(videoPath);
+        MediaFoundationFrameSource source(videoPath);
+        std::vector<uint8_t> bytes;
+        success = source.IsOpen() &&
+                  AnimatedPreview::Generate(source, info.duration, bytes) &&
+                  AnimatedPreview::WriteFile(outputPath, bytes);
+    }
+    
+    if (SUCCEEDED(hrCom)) CoUninitialize();
+    
+    std::string videoPathStr(videoPath.begin(), videoPath.end());
+    if (success) {
+        ErrorHandler::LogInfo("Animasyonlu önizleme oluşturuldu: " + videoPathStr, InfoLevel::DEBUG);
+    } else {
+        ErrorHandler::LogError("Animasyonlu önizleme oluşturulamadı: " + videoPathStr, ErrorLevel::WARNING);
+    }
+    return success;
+}
+
+bool VideoPreview::GetVideoInfoWithDirectShow(const std::wstring& videoPath, VideoInfo& info) {
     IGraphBuilder* pGraphBuilder = nullptr;
     IBasicVideo* pBasicVideo = nullptr;
     IMediaPosition* pMediaPosition = nullptr;
+    bool success = false;
     
     HRESULT hr = CoCreateInstance(CLSID_FilterGraph, nullptr, CLSCTX_INPROC_SERVER,
                                  IID_IGraphBuilder, (void**)&pGraphBuilder);
     if (SUCCEEDED(hr)) {
         hr = pGraphBuilder->RenderFile(videoPath.c_str(), nullptr);
         if (SUCCEEDED(hr)) {
+            success = true;
+            
             // Video boyutları
             hr = pGraphBuilder->QueryInterface(IID_IBasicVideo, (void**)&pBasicVideo);
             if (SUCCEEDED(hr)) {
                 long width, height;
+                REFTIME avgTimePerFrame;
                 if (SUCCEEDED(pBasicVideo->get_VideoWidth(&width)) && 
                     SUCCEEDED(pBasicVideo->get_VideoHeight(&height))) {
                     info.width = width;
                     info.height = height;
                 }
+                if (SUCCEEDED(pBasicVideo->get_AvgTimePerFrame(&avgTimePerFrame)) && avgTimePerFrame > 0) {
+                    info.fps = 1.0 / avgTimePerFrame;
+                }
                 pBasicVideo->Release();
             }
             
@@ -104,18 +357,7 @@ VideoPreview::VideoInfo VideoPreview::GetVideoInfo(const std::wstring& videoPath
         pGraphBuilder->Release();
     }
     
-    // FPS bilgisi (yaklaşık)
-    if (info.duration > 0) {
-        info.fps = 25.0; // Default 25 FPS, gerçek implementasyonda hesaplanabilir
-    }
-    
-    // Codec bilgisi (placeholder)
-    info.codec = "H.264"; // Gerçek implementasyonda detect edilecek
-    
-    std::string videoPathStr(videoPath.begin(), videoPath.end());
-    ErrorHandler::LogInfo("Video bilgileri alındı: " + videoPathStr, InfoLevel::DEBUG);
-    
-    return info;
+    return success;
 }
 
 void VideoPreview::ClearThumbnailCache() {
@@ -283,11 +525,20 @@ int VideoPreview::GetEncoderClsid(const WCHAR* format, CLSID* pClsid) {
     return -1;
 }
 
+void VideoPreview::OnMemoryBudget(size_t budgetBytes, MemoryPressure pressure) {
+    const size_t entryBytes = static_cast<size_t>(THUMBNAIL_SIZE) * THUMBNAIL_SIZE * 4;
+    maxCacheEntries = std::clamp<size_t>(budgetBytes / entryBytes, MIN_CACHE_SIZE, MAX_CACHE_SIZE);
+    
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    UpdateCacheSize();
+}
+
 void VideoPreview::UpdateCacheSize() {
-    if (thumbnailCache.size() > MAX_CACHE_SIZE) {
+    const size_t limit = maxCacheEntries;
+    if (thumbnailCache.size() > limit) {
         // En eski cache girişlerini sil
         auto it = thumbnailCache.begin();
-        while (thumbnailCache.size() > MAX_CACHE_SIZE && it != thumbnailCache.end()) {
+        while (thumbnailCache.size() > limit && it != thumbnailCache.end()) {
             DeleteFile(it->second.c_str());
             it = thumbnailCache.erase(it);
         }
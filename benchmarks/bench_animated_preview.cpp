@@ -0,0 +1,54 @@
+// benchmarks/bench_animated_preview.cpp
+#include "../tests/SyntheticVideo.h"
+#include "../Headers/AnimatedPreview.h"
+#include <benchmark/benchmark.h>
+
+// Dosya başına üretim maliyeti: kare çözümü (burada sentetik çizim) hariç
+// ölçekleme + delta kodlama. Gerçek çözme maliyeti çözülen kare sayısıyla orantılıdır.
+static void BM_GeneratePreview(benchmark::State& state) {
+    const int width = static_cast<int>(state.range(0));
+    const int height = width * 9 / 16;
+    size_t bytes = 0;
+    int decoded = 0;
+    for (auto _ : state) {
+        SyntheticVideo video(width, height, 30.0, 60.0);
+        std::vector<uint8_t> output;
+        AnimatedPreview::Generate(video, 60.0, output);
+        bytes = output.size();
+        decoded = video.GetDecodedFrames();
+    }
+    state.counters["file_bytes"] = static_cast<double>(bytes);
+    state.counters["decoded_frames"] = decoded;
+}
+BENCHMARK(BM_GeneratePreview)->Arg(1280)->Arg(1920)->Unit(benchmark::kMillisecond);
+
+// Sadece kodlama: 160x90 önizleme karesi başına
+static void BM_EncodeFrame(benchmark::State& state) {
+    SyntheticVideo video(160, 90, 8.0, 1000.0);
+    AnimatedPreview::Encoder encoder(160, 90, 125);
+    AnimatedPreview::Frame frame{};
+    for (auto _ : state) {
+        video.ReadFrame(frame);
+        encoder.AddFrame(frame.pixels, frame.stride);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EncodeFrame)->Unit(benchmark::kMicrosecond);
+
+// Oynatma maliyeti: önizleme başına bir timer tick'i (125 ms'de bir)
+static void BM_PlaybackFrame(benchmark::State& state) {
+    SyntheticVideo video(1920, 1080, 30.0, 60.0);
+    std::vector<uint8_t> bytes;
+    AnimatedPreview::Generate(video, 60.0, bytes);
+
+    AnimatedPreview::Player player;
+    player.Load(bytes);
+    AnimatedPreview::Player::Rect dirty;
+    for (auto _ : state) {
+        player.Advance(dirty);
+        benchmark::DoNotOptimize(player.GetPixels());
+    }
+    state.SetItemsProcessed(state.iterations());
+    // 8 fps'te CPU payı ≈ kare süresi x 8 / 1 s
+}
+BENCHMARK(BM_PlaybackFrame)->Unit(benchmark::kMicrosecond);
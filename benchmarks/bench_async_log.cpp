@@ -0,0 +1,57 @@
+// benchmarks/bench_async_log.cpp
+#include "../Headers/AsyncLog.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+// Üretici tarafı gecikmesi: çağıranın thread'inde geçen süre. Eski yol
+// (mutex + biçimlendirme + std::endl ile satır başına flush) ile kilitsiz
+// kuyruk karşılaştırılır; Threads(8) video, önizleme ve temizlik thread'lerinin
+// aynı anda log yazmasıdır.
+static const std::string MESSAGE = "Kare buffer'ı: 6/8 frame (Normal)";
+
+static constexpr int64_t BURST_RECORDS = 1024;
+
+static std::string BenchLogPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+static void BM_LogProducer_MutexEndl(benchmark::State& state) {
+    static std::mutex mutex;
+    static std::ofstream file;
+    if (state.thread_index() == 0) file.open(BenchLogPath("lmwallpaper_bench_mutex.log"), std::ios_base::trunc);
+    for (auto _ : state) {
+        std::lock_guard<std::mutex> lock(mutex);
+        file << "[" << "2024-01-31 23:59:59" << "] [" << "INFO" << "] " << MESSAGE << std::endl;
+    }
+    if (state.thread_index() == 0) file.close();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LogProducer_MutexEndl)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_LogProducer_Async(benchmark::State& state) {
+    static AsyncLog* log = nullptr;
+    if (state.thread_index() == 0) {
+        log = new AsyncLog(1 << 16);
+        log->SetFile(BenchLogPath("lmwallpaper_bench_async.log"));
+    }
+    int64_t burst = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(log->Push(LogSeverity::Info, MESSAGE));
+        // Düşürme yolunu ölçmemek için kuyruk ara ara (süre dışında) boşaltılır
+        if (++burst % BURST_RECORDS == 0) {
+            state.PauseTiming();
+            log->Flush();
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        state.counters["dropped"] = static_cast<double>(log->GetDroppedCount());
+        delete log;
+        log = nullptr;
+    }
+}
+BENCHMARK(BM_LogProducer_Async)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,83 @@
+// benchmarks/bench_binary_log.cpp
+#include "../Headers/BinaryLog.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+// Çağrı yeri maliyeti: eski yol mesajı std::string birleştirmesiyle kurar
+// ("Video işleme hatası: " + std::string(e.what()), yol daraltma), ikili yol
+// sadece argümanları kodlar. Throughput: yazıcı thread'inin N kaydı diske
+// indirme süresi ve kayıt başına dosya boyutu (metin / ikili). Error seviyesi
+// yazıcıyı hemen uyandırır (futex); çağrı yeri ölçümünde Warning kullanılır.
+static const std::runtime_error ERROR_SAMPLE("IMFSourceReader::ReadSample başarısız (0xC00D36B4)");
+static const std::wstring PATH_SAMPLE = L"C:\\Users\\Kullanıcı\\Videos\\Duvar Kağıtları\\orman_gece_4k.mp4";
+static constexpr int RECORDS_PER_FLUSH = 2048;
+
+static std::string BenchLogPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+static void BM_LogCallSite_String(benchmark::State& state) {
+    AsyncLog log(1 << 16);
+    int64_t count = 0;
+    for (auto _ : state) {
+        log.Push(LogSeverity::Warning, "Video işleme hatası: " + std::string(ERROR_SAMPLE.what()));
+        log.Push(LogSeverity::Info, "Video başarıyla yüklendi: " + std::string(PATH_SAMPLE.begin(), PATH_SAMPLE.end()));
+        log.Push(LogSeverity::Info, "Kare " + std::to_string(count) + ": çözme " + std::to_string(7.25) + " ms, kuyruk " +
+                                    std::to_string(count % 8) + "/" + std::to_string(8));
+        if (++count % (RECORDS_PER_FLUSH / 3) == 0) {
+            state.PauseTiming();
+            log.Flush();
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+BENCHMARK(BM_LogCallSite_String);
+
+static void BM_LogCallSite_Binary(benchmark::State& state) {
+    static const BinaryLog::Format errorFormat("Video işleme hatası: {}");
+    static const BinaryLog::Format loadedFormat("Video başarıyla yüklendi: {}");
+    static const BinaryLog::Format frameFormat("Kare {}: çözme {} ms, kuyruk {}/{}");
+    AsyncLog log(1 << 16);
+    int64_t count = 0;
+    for (auto _ : state) {
+        BinaryLog::Write(log, LogSeverity::Warning, errorFormat, ERROR_SAMPLE.what());
+        BinaryLog::Write(log, LogSeverity::Info, loadedFormat, PATH_SAMPLE);
+        BinaryLog::Write(log, LogSeverity::Info, frameFormat, count, 7.25, count % 8, 8);
+        if (++count % (RECORDS_PER_FLUSH / 3) == 0) {
+            state.PauseTiming();
+            log.Flush();
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+BENCHMARK(BM_LogCallSite_Binary);
+
+// Arg: 0 = metin dosyası, 1 = ikili dosya
+static void BM_LogWriterThroughput(benchmark::State& state) {
+    static const BinaryLog::Format frameFormat("Kare {}: çözme {} ms, kuyruk {}/{} ({})");
+    const bool binary = state.range(0) != 0;
+    const std::string path = BenchLogPath(binary ? "lmwallpaper_bench.lmlog" : "lmwallpaper_bench.txt");
+    std::filesystem::remove(path);
+    AsyncLog log(RECORDS_PER_FLUSH * 2);
+    log.SetFile(path, binary ? AsyncLog::Encoding::Binary : AsyncLog::Encoding::Text);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int i = 0; i < RECORDS_PER_FLUSH; ++i) {
+            BinaryLog::Write(log, LogSeverity::Warning, frameFormat, i, 7.25, i % 8, 8, "Normal");
+        }
+        state.ResumeTiming();
+        log.Flush();
+    }
+    log.SetFile("");
+    state.SetItemsProcessed(state.iterations() * RECORDS_PER_FLUSH);
+    state.counters["bytes_per_record"] = static_cast<double>(std::filesystem::file_size(path)) /
+                                         static_cast<double>(state.iterations() * RECORDS_PER_FLUSH);
+    state.SetLabel(binary ? "binary" : "text");
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_LogWriterThroughput)->Arg(0)->Arg(1)->UseRealTime()->Unit(benchmark::kMicrosecond);
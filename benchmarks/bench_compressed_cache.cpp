@@ -0,0 +1,73 @@
+// benchmarks/bench_compressed_cache.cpp
+#include "../tests/SyntheticVideo.h"
+#include "../Headers/CompressedCache.h"
+#include "../Headers/FastCompressor.h"
+#include <benchmark/benchmark.h>
+
+static std::vector<uint8_t> RenderFrame(int width, int height) {
+    SyntheticVideo video(width, height, 30.0, 10.0);
+    video.Render(1.3);
+    return std::vector<uint8_t>(video.GetPixels(), video.GetPixels() + static_cast<size_t>(width) * height * 4);
+}
+
+// Soğuk kare / thumbnail sıkıştırma süresi ve oranı (arg: genişlik, 16:9)
+static void BM_CompressFrame(benchmark::State& state) {
+    const int width = static_cast<int>(state.range(0));
+    const auto frame = RenderFrame(width, width * 9 / 16);
+    std::vector<uint8_t> compressed(FastCompressor::MaxCompressedSize(frame.size()));
+    size_t size = 0;
+    for (auto _ : state) {
+        size = FastCompressor::Compress(frame.data(), frame.size(), compressed.data(), compressed.size());
+        benchmark::DoNotOptimize(size);
+    }
+    state.SetBytesProcessed(state.iterations() * frame.size());
+    state.counters["ratio"] = static_cast<double>(frame.size()) / static_cast<double>(size);
+}
+BENCHMARK(BM_CompressFrame)->Arg(128)->Arg(1920)->Unit(benchmark::kMicrosecond);
+
+// Erişimde açma gecikmesi
+static void BM_DecompressFrame(benchmark::State& state) {
+    const int width = static_cast<int>(state.range(0));
+    const auto frame = RenderFrame(width, width * 9 / 16);
+    std::vector<uint8_t> compressed(FastCompressor::MaxCompressedSize(frame.size()));
+    const size_t size = FastCompressor::Compress(frame.data(), frame.size(), compressed.data(), compressed.size());
+    std::vector<uint8_t> output(frame.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(FastCompressor::Decompress(compressed.data(), size, output.data(), output.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * frame.size());
+}
+BENCHMARK(BM_DecompressFrame)->Arg(128)->Arg(1920)->Unit(benchmark::kMicrosecond);
+
+// Karşılaştırma tabanı: aynı boyutta düz kopya
+static void BM_CopyFrame(benchmark::State& state) {
+    const auto frame = RenderFrame(1920, 1080);
+    std::vector<uint8_t> output(frame.size());
+    for (auto _ : state) {
+        std::memcpy(output.data(), frame.data(), frame.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * frame.size());
+}
+BENCHMARK(BM_CopyFrame)->Unit(benchmark::kMicrosecond);
+
+// Aynı bütçede bellekte kalan 1080p kare sayısı: ham vs sıkıştırılmış
+static void BM_ResidentFramesPerBudget(benchmark::State& state) {
+    const size_t frameBytes = 1920 * 1080 * 4;
+    const size_t budget = 8 * frameBytes;
+    size_t resident = 0;
+    for (auto _ : state) {
+        CompressedCache cache(MemoryCategory::Frames, budget);
+        for (int i = 0; i < 64; ++i) {
+            SyntheticVideo video(1920, 1080, 30.0, 10.0);
+            video.Render(i * 0.1);
+            cache.Put(std::to_wstring(i),
+                      std::vector<uint8_t>(video.GetPixels(), video.GetPixels() + frameBytes), 1920, 1080, 1920 * 4);
+            cache.CompressCold(std::chrono::milliseconds(0));
+        }
+        resident = cache.GetEntryCount();
+    }
+    state.counters["frames_raw"] = static_cast<double>(budget / frameBytes);
+    state.counters["frames_compressed"] = static_cast<double>(resident);
+}
+BENCHMARK(BM_ResidentFramesPerBudget)->Unit(benchmark::kMillisecond)->Iterations(1);
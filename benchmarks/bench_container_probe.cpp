@@ -0,0 +1,36 @@
+// benchmarks/bench_container_probe.cpp
+#include "../tests/SyntheticMedia.h"
+#include "../Headers/ContainerProbe.h"
+#include <benchmark/benchmark.h>
+
+// Sıcak (page cache'te) dosyalar üzerinde probe süresi; hedef < 1 ms
+static void ProbeWarmFile(benchmark::State& state, const std::string& name, const SyntheticMedia::Bytes& bytes) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    SyntheticMedia::WriteFile(path, bytes);
+
+    ContainerProbe::Result result;
+    ContainerProbe::Probe(path, result);   // Isınma
+    for (auto _ : state) {
+        bool ok = ContainerProbe::Probe(path, result);
+        benchmark::DoNotOptimize(ok);
+    }
+    state.counters["fileMB"] = bytes.size() / (1024.0 * 1024.0);
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+static void BM_ProbeMp4MoovAtEnd(benchmark::State& state) {
+    ProbeWarmFile(state, "lmw_bench.mp4", SyntheticMedia::BuildMp4(3840, 2160, 18000, 60000, 1001, 300, true, 64 << 20));
+}
+BENCHMARK(BM_ProbeMp4MoovAtEnd)->Unit(benchmark::kMicrosecond);
+
+static void BM_ProbeWebm(benchmark::State& state) {
+    ProbeWarmFile(state, "lmw_bench.webm", SyntheticMedia::BuildWebm(1920, 1080, 600.0, 41666667, 300, 10, 9));
+}
+BENCHMARK(BM_ProbeWebm)->Unit(benchmark::kMicrosecond);
+
+static void BM_ProbeAvi(benchmark::State& state) {
+    ProbeWarmFile(state, "lmw_bench.avi", SyntheticMedia::BuildAvi(1280, 720, 30, 1, 9000, 30, "H264"));
+}
+BENCHMARK(BM_ProbeAvi)->Unit(benchmark::kMicrosecond);
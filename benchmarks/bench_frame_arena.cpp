@@ -0,0 +1,47 @@
+// benchmarks/bench_frame_arena.cpp
+#include "../Headers/FrameArena.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+// Bir karenin geçici işleri: ölçekleyici sütun tablosu, satır başına dönüşüm
+// buffer'ı ve karo meta verisi. Global heap ile thread'in kare arenası
+// karşılaştırılır; Threads(4) her biri kendi oynatıcısını süren dört monitördür
+// (heap'te aynı kilit / arena'ları paylaşırlar, kare arenasında paylaşım yoktur).
+static constexpr int FRAME_WIDTH = 1920;
+static constexpr int FRAME_ROWS = 1080;
+static constexpr int PREVIEW_WIDTH = 480;
+static constexpr int TILE_COUNT = 240;
+
+static void RunFrameScratch(FrameArena& arena, std::pmr::memory_resource* resource) {
+    std::pmr::vector<int> columns(PREVIEW_WIDTH * 2, resource);
+    for (int i = 0; i < PREVIEW_WIDTH; ++i) columns[i * 2] = i * FRAME_WIDTH / PREVIEW_WIDTH;
+    benchmark::DoNotOptimize(columns.data());
+
+    for (int row = 0; row < FRAME_ROWS; ++row) {
+        // Satır kapsamı: arena aynı (önbellekte sıcak) belleği her satırda yeniden verir
+        FrameArena::Scope rowScope(arena);
+        std::pmr::vector<uint16_t> line(FRAME_WIDTH, resource);
+        line[row] = static_cast<uint16_t>(row);
+        benchmark::DoNotOptimize(line.data());
+    }
+
+    std::pmr::vector<std::pmr::vector<uint8_t>> tiles(resource);
+    tiles.reserve(TILE_COUNT);
+    for (int i = 0; i < TILE_COUNT; ++i) tiles.emplace_back(64, static_cast<uint8_t>(i));
+    benchmark::DoNotOptimize(tiles.data());
+}
+
+static void BM_FrameScratch(benchmark::State& state) {
+    const bool useArena = state.range(0) != 0;
+    FrameArena& arena = FrameArena::ForCurrentThread();
+    std::pmr::memory_resource* resource = useArena ? static_cast<std::pmr::memory_resource*>(&arena)
+                                                   : std::pmr::new_delete_resource();
+    for (auto _ : state) {
+        FrameArena::Scope frame(arena);
+        RunFrameScratch(arena, resource);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(useArena ? "arena" : "heap");
+}
+BENCHMARK(BM_FrameScratch)->Arg(0)->Arg(1)->Threads(1)->Threads(4)->UseRealTime()->Unit(benchmark::kMicrosecond);
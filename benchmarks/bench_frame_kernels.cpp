@@ -0,0 +1,137 @@
+// benchmarks/bench_frame_kernels.cpp
+#include "../tests/SyntheticVideo.h"
+#include "../Headers/AnimatedPreview.h"
+#include "../Headers/CompressedCache.h"
+#include "../Headers/FramePipeline.h"
+#include "../Headers/PerceptualHash.h"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Kare başına çalışan çekirdekler ve veri yapıları. Büyük sayfa karşılaştırması
+// bench_large_pages.cpp'de, log ve probe ölçümleri kendi dosyalarında.
+static std::vector<uint8_t> RenderFrame(int width, int height) {
+    SyntheticVideo video(width, height, 30.0, 10.0);
+    video.Render(1.3);
+    return std::vector<uint8_t>(video.GetPixels(), video.GetPixels() + static_cast<size_t>(width) * height * 4);
+}
+
+// BGRA → luma dönüşümü + 9x8 alan ortalaması (dHash çekirdeği). Arg 1 aynı
+// karenin önceden griye çevrilmiş hali: aradaki fark piksel dönüşümünün payı
+static void BM_PixelConversion_Luma(benchmark::State& state) {
+    const int width = 1920, height = 1080;
+    const auto bgra = RenderFrame(width, height);
+    std::vector<uint8_t> gray(static_cast<size_t>(width) * height);
+    for (size_t i = 0; i < gray.size(); ++i) gray[i] = bgra[i * 4 + 1];
+
+    const bool fromBgra = state.range(0) == 0;
+    const PerceptualHash::Image image = fromBgra ? PerceptualHash::Image{ bgra.data(), width, height, width * 4, 4 }
+                                                 : PerceptualHash::Image{ gray.data(), width, height, width, 1 };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(PerceptualHash::DHash(image));
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+    state.SetLabel(fromBgra ? "bgra" : "gray");
+}
+BENCHMARK(BM_PixelConversion_Luma)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+// Alan ortalamasıyla yeniden örnekleme: 4K → 1080p (monitör), 1080p → 960x540
+// (çok monitör) ve 1080p → 160x90 (önizleme). Arg: kaynak genişliği, hedef genişliği
+static void BM_ResampleFrame(benchmark::State& state) {
+    const int sourceWidth = static_cast<int>(state.range(0));
+    const int targetWidth = static_cast<int>(state.range(1));
+    const auto pixels = RenderFrame(sourceWidth, sourceWidth * 9 / 16);
+    const AnimatedPreview::Frame source = { pixels.data(), sourceWidth, sourceWidth * 9 / 16, sourceWidth * 4, 0.0 };
+    std::vector<uint8_t> output;
+    for (auto _ : state) {
+        AnimatedPreview::ScaleFrame(source, targetWidth, targetWidth * 9 / 16, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * pixels.size());
+}
+BENCHMARK(BM_ResampleFrame)->Args({ 3840, 1920 })->Args({ 1920, 960 })->Args({ 1920, 160 })
+    ->Unit(benchmark::kMicrosecond);
+
+// Kare halkası: decode edilmiş karenin kuyruğa girişi ve en eskinin sunumu.
+// Piksel işi yok, sadece slot / halka / derinlik denetleyicisi maliyeti
+static void BM_FrameRing_PushPop(benchmark::State& state) {
+    FramePipeline pipeline(1000.0 / 60.0);
+    uint32_t clockMs = 0;
+    pipeline.SetDecoder([&clockMs](FramePipeline::Frame& frame) {
+        frame.timestampMs = ++clockMs;
+        return true;
+    });
+    uint64_t presented = 0;
+    pipeline.SetPresenter([&presented](const FramePipeline::Frame& frame) { presented += frame.index; });
+    for (auto _ : state) {
+        pipeline.Step();
+    }
+    benchmark::DoNotOptimize(presented);
+    state.SetItemsProcessed(state.iterations());
+    state.counters["depth"] = pipeline.GetDepth();
+}
+BENCHMARK(BM_FrameRing_PushPop);
+
+// Kare havuzu: sıcak slotlar yeniden kullanılırken (arg 0) ve yaşlanan kareler
+// bellekleriyle bırakılıp yeniden alınırken (arg 1) 1080p kare başına maliyet
+static void BM_FramePool_AcquireRelease(benchmark::State& state) {
+    constexpr int WIDTH = 1920, HEIGHT = 1080;
+    const auto source = RenderFrame(WIDTH, HEIGHT);
+    const bool releaseEachFrame = state.range(0) != 0;
+
+    FramePipeline pipeline(1000.0 / 60.0);
+    uint32_t clockMs = 0;
+    pipeline.SetDecoder([&](FramePipeline::Frame& frame) {
+        frame.width = WIDTH;
+        frame.height = HEIGHT;
+        frame.stride = WIDTH * 4;
+        frame.timestampMs = ++clockMs;
+        frame.pixels.resize(source.size());
+        std::memcpy(frame.pixels.data(), source.data(), source.size());
+        return true;
+    });
+    for (auto _ : state) {
+        pipeline.Step();
+        if (releaseEachFrame) pipeline.DropOlderThan(clockMs, 0);
+    }
+    state.SetBytesProcessed(state.iterations() * source.size());
+    state.SetLabel(releaseEachFrame ? "release" : "reuse");
+}
+BENCHMARK(BM_FramePool_AcquireRelease)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+// Thumbnail cache araması: 2000 adet 320x180 thumbnail içinde ham isabet (arg 0),
+// ıskalama (arg 1) ve sıkıştırılmış girdinin açılarak isabeti (arg 2)
+static void BM_ThumbnailCache_Lookup(benchmark::State& state) {
+    constexpr int COUNT = 2000;
+    constexpr int WIDTH = 320, HEIGHT = 180;
+    const auto thumbnail = RenderFrame(WIDTH, HEIGHT);
+    CompressedCache cache(MemoryCategory::Thumbnails, static_cast<size_t>(COUNT) * thumbnail.size() * 2);
+    std::vector<std::wstring> keys;
+    for (int i = 0; i < COUNT; ++i) {
+        keys.push_back(L"C:\\Videos\\Wallpapers\\klip_" + std::to_wstring(i) + L".mp4");
+        cache.Put(keys.back(), thumbnail, WIDTH, HEIGHT, WIDTH * 4);
+    }
+
+    const int64_t mode = state.range(0);
+    // Sonrasında her turda sadece bir önceki turda açılan girdi yeniden sıkıştırılır
+    if (mode == 2) cache.CompressCold(std::chrono::milliseconds(0));
+    const std::wstring missing = L"C:\\Videos\\Wallpapers\\yok.mp4";
+    CompressedCache::Item item;
+    size_t next = 0;
+    for (auto _ : state) {
+        if (mode == 2) {
+            state.PauseTiming();
+            cache.CompressCold(std::chrono::milliseconds(0));
+            state.ResumeTiming();
+        }
+        const bool hit = cache.Get(mode == 1 ? missing : keys[next], item);
+        benchmark::DoNotOptimize(hit);
+        next = (next + 7919) % COUNT;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(mode == 0 ? "hit" : mode == 1 ? "miss" : "compressed-hit");
+}
+BENCHMARK(BM_ThumbnailCache_Lookup)->Arg(0)->Arg(1);
+BENCHMARK(BM_ThumbnailCache_Lookup)->Arg(2)->Iterations(200)->Unit(benchmark::kMicrosecond);
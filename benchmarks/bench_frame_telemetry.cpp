@@ -0,0 +1,42 @@
+// benchmarks/bench_frame_telemetry.cpp
+#include "../Headers/FrameTelemetry.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+// Kare başına ölçüm maliyeti: altı aşama ve kare kaydı birkaç atomik artıştan
+// ibaret olmalı, 60 fps'te kare bütçesinin (16,7 ms) yanında görünmemeli
+static void BM_FrameTelemetry_Record(benchmark::State& state) {
+    HdrHistogram histogram;
+    uint64_t value = 1234567;
+    for (auto _ : state) {
+        histogram.Record(value);
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        value >>= 36;
+    }
+    benchmark::DoNotOptimize(histogram.GetCount());
+}
+BENCHMARK(BM_FrameTelemetry_Record);
+
+static void BM_FrameTelemetry_ScopedStage(benchmark::State& state) {
+    FrameTelemetry telemetry;
+    for (auto _ : state) {
+        FrameTelemetry::ScopedStage stage(&telemetry, FrameTelemetry::Stage::Decode);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_FrameTelemetry_ScopedStage);
+
+// Tepsi menüsünün okuma maliyeti: sekiz histogramın kopyalanıp özetlenmesi
+static void BM_FrameTelemetry_Snapshot(benchmark::State& state) {
+    FrameTelemetry telemetry;
+    for (uint64_t i = 0; i < 10000; ++i) {
+        telemetry.RecordStage(FrameTelemetry::Stage::Decode, 1000000 + i * 137);
+        telemetry.RecordStage(FrameTelemetry::Stage::Present, 200000 + i * 11);
+        telemetry.RecordFrame(2000000 + i * 97, false);
+        telemetry.RecordQueueDepth(static_cast<int>(i % 8));
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(telemetry.GetSnapshot());
+    }
+}
+BENCHMARK(BM_FrameTelemetry_Snapshot)->Unit(benchmark::kMicrosecond);
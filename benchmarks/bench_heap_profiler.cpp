@@ -0,0 +1,30 @@
+// benchmarks/bench_heap_profiler.cpp
+#include "../Headers/HeapProfiler.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+
+// Küçük nesne new/delete maliyeti: profil kapalı (hook sadece bayrak okur)
+// ve varsayılan 512 KB örnekleme ile açık
+static void BM_NewDelete(benchmark::State& state) {
+    const bool profiling = state.range(0) != 0;
+    if (profiling) HeapProfiler::Start();
+    for (auto _ : state) {
+        auto block = std::make_unique<char[]>(64);
+        benchmark::DoNotOptimize(block.get());
+    }
+    if (profiling) HeapProfiler::Stop();
+    state.counters["samples"] = static_cast<double>(profiling ? HeapProfiler::GetSampleCount() : 0);
+}
+BENCHMARK(BM_NewDelete)->Arg(0)->Arg(1);
+
+// Ayrılan kareler büyükken (her ayırma örneklenir) stack yakalama maliyeti
+static void BM_NewDeleteLarge(benchmark::State& state) {
+    const bool profiling = state.range(0) != 0;
+    if (profiling) HeapProfiler::Start();
+    for (auto _ : state) {
+        auto block = std::make_unique<char[]>(1920 * 1080 * 4);
+        benchmark::DoNotOptimize(block.get());
+    }
+    if (profiling) HeapProfiler::Stop();
+}
+BENCHMARK(BM_NewDeleteLarge)->Arg(0)->Arg(1);
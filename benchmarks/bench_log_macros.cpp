@@ -0,0 +1,46 @@
+// benchmarks/bench_log_macros.cpp
+// Release tabanı (Info) burada sabitlenir ki Debug derlemede de aynı şey ölçülsün
+#undef LMWALLPAPER_LOG_FLOOR
+#define LMWALLPAPER_LOG_FLOOR 2
+#include "../Headers/LogMacros.h"
+#include <benchmark/benchmark.h>
+#include <string>
+
+// Sıcak döngüdeki Debug çağrısının maliyeti. Eski yol mesajı her seferinde
+// kurup seviyeyi log içinde süzüyordu; makro ile tabanın altındaki çağrı hiç
+// derlenmez, tabanın üstünde süzülen çağrı argümanlarını hesaplamaz.
+static std::string DescribeFrame(int64_t frame) {
+    return "Kare " + std::to_string(frame) + ": çözme " + std::to_string(7.25) + " ms, kuyruk " +
+           std::to_string(frame % 8) + "/8";
+}
+
+static void BM_DebugLog_StringThenFilter(benchmark::State& state) {
+    AsyncLog log;
+    log.SetMinimumSeverity(LogSeverity::Info);
+    int64_t frame = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(log.Push(LogSeverity::Debug, DescribeFrame(frame++)));
+    }
+}
+BENCHMARK(BM_DebugLog_StringThenFilter);
+
+static void BM_DebugLog_RuntimeFiltered(benchmark::State& state) {
+    AsyncLog log;
+    log.SetMinimumSeverity(LogSeverity::Error);
+    int64_t frame = 0;
+    for (auto _ : state) {
+        LMW_LOG_WARNING(log, "{}", DescribeFrame(frame));
+        benchmark::DoNotOptimize(++frame);
+    }
+}
+BENCHMARK(BM_DebugLog_RuntimeFiltered);
+
+static void BM_DebugLog_CompiledOut(benchmark::State& state) {
+    AsyncLog log;
+    int64_t frame = 0;
+    for (auto _ : state) {
+        LMW_LOG_DEBUG(log, "{}", DescribeFrame(frame));
+        benchmark::DoNotOptimize(++frame);
+    }
+}
+BENCHMARK(BM_DebugLog_CompiledOut);
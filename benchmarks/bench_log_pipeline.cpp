@@ -0,0 +1,86 @@
+// benchmarks/bench_log_pipeline.cpp
+#include "../Headers/AsyncLog.h"
+#include "../Headers/LogHistory.h"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+// Uçtan uca log maliyeti: çağrı yerinden kaydın tüm çıktılara ulaşmasına
+// kadar (Flush dahil, gerçek zaman). Eski düzen: Logger ve ErrorHandler'ın
+// her biri kendi kuyruğu, yazıcı thread'i ve dosyasıyla; geçmiş çağıranın
+// thread'inde doldurulur. Yeni düzen: tek kuyruk, tek yazıcı; dosya, geçmiş,
+// hata ayıklayıcı (Warning altı süzülür) ve sayaç sink'leri.
+static constexpr int RECORDS_PER_ITERATION = 1024;
+
+static std::string BenchLogPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+static int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+static void BM_LogEndToEnd_SeparateStacks(benchmark::State& state) {
+    const std::string loggerPath = BenchLogPath("lmwallpaper_bench_logger.txt");
+    const std::string errorPath = BenchLogPath("lmwallpaper_bench_error_log.txt");
+    {
+        AsyncLog logger;
+        AsyncLog errors;
+        LogHistory loggerHistory;
+        LogHistory errorHistory;
+        logger.SetFile(loggerPath);
+        errors.SetFile(errorPath);
+
+        for (auto _ : state) {
+            for (int i = 0; i < RECORDS_PER_ITERATION; ++i) {
+                // Uyarılar ErrorHandler'dan, gerisi Logger'dan
+                const bool warning = i % 8 == 0;
+                const std::string message = warning ? "Video bellek bütçesine sığmıyor: " + std::to_string(i)
+                                                    : "Thumbnail hazır: orman_gece_4k.mp4 #" + std::to_string(i);
+                const LogSeverity severity = warning ? LogSeverity::Warning : LogSeverity::Info;
+                (warning ? errors : logger).Push(severity, message);
+                (warning ? errorHistory : loggerHistory).Append(severity, message, NowMs());
+            }
+            logger.Flush();
+            errors.Flush();
+        }
+    }
+    std::filesystem::remove(loggerPath);
+    std::filesystem::remove(errorPath);
+    state.SetItemsProcessed(state.iterations() * RECORDS_PER_ITERATION);
+}
+BENCHMARK(BM_LogEndToEnd_SeparateStacks)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+static void BM_LogEndToEnd_Pipeline(benchmark::State& state) {
+    const std::string path = BenchLogPath("lmwallpaper_bench_pipeline.txt");
+    const std::string debuggerPath = BenchLogPath("lmwallpaper_bench_debugger.txt");
+    std::FILE* debuggerStream = std::fopen(debuggerPath.c_str(), "wb");
+    auto metrics = std::make_shared<LogMetricsSink>();
+    {
+        AsyncLog log;
+        log.SetFile(path);
+        log.AddSink(std::make_shared<LogHistorySink>(LogSeverity::Info));
+        log.AddSink(std::make_shared<LogDebuggerSink>(LogSeverity::Warning, debuggerStream));
+        log.AddSink(metrics);
+
+        for (auto _ : state) {
+            for (int i = 0; i < RECORDS_PER_ITERATION; ++i) {
+                const bool warning = i % 8 == 0;
+                const std::string message = warning ? "Video bellek bütçesine sığmıyor: " + std::to_string(i)
+                                                    : "Thumbnail hazır: orman_gece_4k.mp4 #" + std::to_string(i);
+                log.Push(warning ? LogSeverity::Warning : LogSeverity::Info, message);
+            }
+            log.Flush();
+        }
+    }
+    if (debuggerStream) std::fclose(debuggerStream);
+    std::filesystem::remove(path);
+    std::filesystem::remove(debuggerPath);
+    state.SetItemsProcessed(state.iterations() * RECORDS_PER_ITERATION);
+    state.counters["sink_records"] = static_cast<double>(metrics->GetTotalCount());
+}
+BENCHMARK(BM_LogEndToEnd_Pipeline)->UseRealTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,29 @@
+// benchmarks/bench_media_library.cpp
+#include "../tests/SyntheticMedia.h"
+#include "../Headers/MediaLibrary.h"
+#include <benchmark/benchmark.h>
+
+// Hiçbir şeyin değişmediği 20.000 dosyalık klasörün yeniden taranması
+static void BM_RescanUnchanged(benchmark::State& state) {
+    const int fileCount = static_cast<int>(state.range(0));
+    const auto directory = std::filesystem::temp_directory_path() / "lmw_bench_library";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    const auto mp4 = SyntheticMedia::BuildMp4(1920, 1080, 250, 25, 1, 5, false, 256);
+    for (int i = 0; i < fileCount; ++i) {
+        SyntheticMedia::WriteFile(directory / ("clip" + std::to_string(i) + ".mp4"), mp4);
+    }
+
+    MediaLibrary library;
+    library.Rescan(directory);
+
+    for (auto _ : state) {
+        auto stats = library.Rescan(directory);
+        benchmark::DoNotOptimize(stats);
+    }
+    state.SetItemsProcessed(state.iterations() * fileCount);
+
+    std::filesystem::remove_all(directory);
+}
+BENCHMARK(BM_RescanUnchanged)->Arg(20000)->Unit(benchmark::kMillisecond)->Iterations(5);
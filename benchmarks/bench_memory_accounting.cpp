@@ -0,0 +1,31 @@
+// benchmarks/bench_memory_accounting.cpp
+#include "../Headers/MemoryAccounting.h"
+#include <benchmark/benchmark.h>
+
+// Tahsis başına etiketleme maliyeti; çok thread'de kategoriler ayrı önbellek
+// satırlarında olduğu için farklı kategoriler birbirini yavaşlatmamalı
+static void BM_TagAllocation(benchmark::State& state) {
+    const auto category = static_cast<MemoryCategory>(state.thread_index() % MemoryAccounting::CATEGORY_COUNT);
+    for (auto _ : state) {
+        MemoryAccounting::Add(category, 4096);
+        MemoryAccounting::Subtract(category, 4096);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TagAllocation)->Threads(1)->Threads(4);
+
+static void BM_TakeSnapshot(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MemoryAccounting::TakeSnapshot());
+    }
+}
+BENCHMARK(BM_TakeSnapshot);
+
+// smaps_rollup okuma maliyeti (izleme periyodunda bir kez)
+static void BM_QueryProcessMemory(benchmark::State& state) {
+    MemoryAccounting::ProcessMemory memory;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MemoryAccounting::QueryProcessMemory(memory));
+    }
+}
+BENCHMARK(BM_QueryProcessMemory)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,114 @@
+// benchmarks/bench_perceptual_hash.cpp
+#include "../Headers/PerceptualHash.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+static constexpr size_t HASH_COUNT = 100000;
+
+// Kümelenmiş sentetik hash'ler: gerçek kütüphanelerde olduğu gibi
+// yakın kopyalar ve ilgisiz videolar bir arada
+static const std::vector<uint64_t>& SyntheticHashes() {
+    static const std::vector<uint64_t> hashes = []() {
+        std::mt19937_64 random(1234);
+        std::vector<uint64_t> result;
+        result.reserve(HASH_COUNT);
+        while (result.size() < HASH_COUNT) {
+            const uint64_t base = random();
+            result.push_back(base);
+            for (int copy = 0; copy < 3 && result.size() < HASH_COUNT; ++copy) {
+                uint64_t variant = base;
+                for (int flip = 0; flip < 4; ++flip) variant ^= 1ull << (random() % 64);
+                result.push_back(variant);
+            }
+        }
+        return result;
+    }();
+    return hashes;
+}
+
+static const HashIndex& SyntheticIndex() {
+    static const HashIndex index = []() {
+        HashIndex result;
+        const auto& hashes = SyntheticHashes();
+        result.Reserve(hashes.size());
+        for (size_t i = 0; i < hashes.size(); ++i) result.Insert(hashes[i], static_cast<uint32_t>(i));
+        std::vector<HashIndex::Match> matches;
+        result.Query(hashes[0], 0, matches);
+        return result;
+    }();
+    return index;
+}
+
+static void BM_IndexBuild(benchmark::State& state) {
+    const auto& hashes = SyntheticHashes();
+    for (auto _ : state) {
+        HashIndex index;
+        index.Reserve(hashes.size());
+        for (size_t i = 0; i < hashes.size(); ++i) index.Insert(hashes[i], static_cast<uint32_t>(i));
+        // Kovalar ilk sorguda kurulur
+        std::vector<HashIndex::Match> matches;
+        index.Query(hashes[0], 0, matches);
+        benchmark::DoNotOptimize(matches.data());
+    }
+    state.SetItemsProcessed(state.iterations() * hashes.size());
+}
+BENCHMARK(BM_IndexBuild)->Unit(benchmark::kMillisecond);
+
+// Çoklu indeks üzerinde yarıçap sorgusu (100k hash)
+static void BM_IndexQuery(benchmark::State& state) {
+    const auto& hashes = SyntheticHashes();
+    const HashIndex& index = SyntheticIndex();
+    const int radius = static_cast<int>(state.range(0));
+    std::vector<HashIndex::Match> matches;
+    size_t query = 0;
+    for (auto _ : state) {
+        matches.clear();
+        index.Query(hashes[(query++ * 7919) % hashes.size()] ^ 0x3, radius, matches);
+        benchmark::DoNotOptimize(matches.data());
+    }
+}
+BENCHMARK(BM_IndexQuery)->Arg(4)->Arg(8)->Arg(10)->Arg(12)->Arg(16)->Unit(benchmark::kMicrosecond);
+
+static void BM_IndexNearest(benchmark::State& state) {
+    const auto& hashes = SyntheticHashes();
+    const HashIndex& index = SyntheticIndex();
+    HashIndex::Match match;
+    size_t query = 0;
+    for (auto _ : state) {
+        index.Nearest(hashes[(query++ * 7919) % hashes.size()] ^ 0x101, match);
+        benchmark::DoNotOptimize(match);
+    }
+}
+BENCHMARK(BM_IndexNearest)->Unit(benchmark::kMicrosecond);
+
+// Karşılaştırma için popcount ile düz tarama (100k hash)
+static void BM_LinearScan(benchmark::State& state) {
+    const auto& hashes = SyntheticHashes();
+    const int radius = static_cast<int>(state.range(0));
+    std::vector<uint32_t> matches;
+    size_t query = 0;
+    for (auto _ : state) {
+        matches.clear();
+        PerceptualHash::FindWithin(hashes[(query++ * 7919) % hashes.size()] ^ 0x3, hashes.data(), hashes.size(),
+                                   radius, matches);
+        benchmark::DoNotOptimize(matches.data());
+    }
+    state.SetItemsProcessed(state.iterations() * hashes.size());
+}
+BENCHMARK(BM_LinearScan)->Arg(4)->Arg(10)->Unit(benchmark::kMicrosecond);
+
+// 1080p BGRA kareden pHash / dHash
+static void BM_FrameHash(benchmark::State& state) {
+    const int width = 1920, height = 1080;
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+    std::mt19937 random(5);
+    for (auto& value : pixels) value = static_cast<uint8_t>(random());
+    const PerceptualHash::Image image = { pixels.data(), width, height, width * 4, 4 };
+
+    const bool usePHash = state.range(0) != 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(usePHash ? PerceptualHash::PHash(image) : PerceptualHash::DHash(image));
+    }
+    state.SetLabel(usePHash ? "pHash" : "dHash");
+}
+BENCHMARK(BM_FrameHash)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
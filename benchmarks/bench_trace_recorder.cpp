@@ -0,0 +1,69 @@
+// benchmarks/bench_trace_recorder.cpp
+#include "../Headers/TraceRecorder.h"
+#include "../Headers/FramePipeline.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <sstream>
+
+// İz kaydı derlenmiş ama kapalıyken span başına maliyet: bir relaxed yükleme
+static void BM_TraceSpan_Disabled(benchmark::State& state) {
+    TraceRecorder recorder;
+    for (auto _ : state) {
+        TraceRecorder::Span span("decode", recorder);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_TraceSpan_Disabled);
+
+static void BM_TraceSpan_Enabled(benchmark::State& state) {
+    TraceRecorder recorder;
+    recorder.SetEnabled(true);
+    for (auto _ : state) {
+        TraceRecorder::Span span("decode", recorder);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_TraceSpan_Enabled);
+
+// Oynatma adımı (1080p BGRA kare kopyası) iz kaydı kapalı / açık: aradaki fark
+// kare başına toplam iz maliyeti
+static void BM_TraceFrameStep(benchmark::State& state) {
+    constexpr size_t FRAME_BYTES = 1920 * 1080 * 4;
+    TraceRecorder& recorder = TraceRecorder::GetInstance();
+    recorder.SetEnabled(state.range(0) != 0);
+
+    std::vector<uint8_t> source(FRAME_BYTES, 0x5a);
+    FramePipeline pipeline(1000.0);
+    pipeline.SetDecoder([&](FramePipeline::Frame& frame) {
+        FrameTelemetry::ScopedStage stage(&pipeline.GetTelemetry(), FrameTelemetry::Stage::Decode);
+        frame.pixels.resize(FRAME_BYTES);
+        std::memcpy(frame.pixels.data(), source.data(), FRAME_BYTES);
+        return true;
+    });
+    uint64_t checksum = 0;
+    pipeline.SetPresenter([&checksum](const FramePipeline::Frame& frame) { checksum += frame.pixels[frame.index % 64]; });
+
+    for (auto _ : state) {
+        pipeline.Step();
+    }
+    benchmark::DoNotOptimize(checksum);
+    recorder.SetEnabled(false);
+    recorder.Clear();
+}
+BENCHMARK(BM_TraceFrameStep)->Arg(0)->Arg(1)->ArgName("tracing")->Unit(benchmark::kMicrosecond);
+
+// Döküm maliyeti: dolu bir thread halkası
+static void BM_TraceWriteJson(benchmark::State& state) {
+    TraceRecorder recorder(TraceRecorder::DEFAULT_EVENTS_PER_THREAD);
+    recorder.SetEnabled(true);
+    for (size_t i = 0; i < TraceRecorder::DEFAULT_EVENTS_PER_THREAD; i += 2) {
+        TraceRecorder::Span span("Kare", recorder);
+    }
+    for (auto _ : state) {
+        std::ostringstream out;
+        recorder.WriteJson(out);
+        benchmark::DoNotOptimize(out.str().size());
+    }
+    state.SetItemsProcessed(state.iterations() * TraceRecorder::DEFAULT_EVENTS_PER_THREAD);
+}
+BENCHMARK(BM_TraceWriteJson)->Unit(benchmark::kMillisecond);
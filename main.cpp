@@ -4,6 +4,7 @@
 #include "Headers/ErrorHandler.h"
 #include "Headers/TrayManager.h"
 #include "Headers/SettingsWindow.h"
+#include "Headers/HeapProfiler.h"
 #include <string>
 #include <vector>
 #include <windows.h>
@@ -46,6 +47,9 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
     UNREFERENCED_PARAMETER(hPrevInstance);
     UNREFERENCED_PARAMETER(lpCmdLine);
 
+    // LMW_HEAP_PROFILE ayarlıysa çıkışa kadar heap profili tut (soak testleri)
+    HeapProfiler::StartFromEnvironment();
+
     // Prevent multiple instances
     HANDLE hMutex = CreateMutex(NULL, TRUE, L"LMWallpaper_Mutex_Unique_Instance_Check");
     if (GetLastError() == ERROR_ALREADY_EXISTS) {
@@ -0,0 +1,188 @@
+// tests/SyntheticMedia.h
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// Testler ve benchmark'lar için gerçek dosya gerektirmeyen minimal
+// konteyner başlıkları üreten yardımcılar.
+class SyntheticMedia {
+public:
+    using Bytes = std::vector<uint8_t>;
+
+    static void WriteFile(const std::filesystem::path& path, const Bytes& data) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    // ftyp + mdat + moov (sonda) içeren, 10-bit HEVC/BT.2020 veya 8-bit H.264 MP4
+    static Bytes BuildMp4(int width, int height, uint32_t frames, uint32_t timescale, uint32_t frameDelta,
+                          uint32_t keyframes, bool hevc10Bit, size_t mdatSize = 4096) {
+        Bytes ftyp = Box("ftyp", Concat({ Str("isom"), BE32(0x200), Str("isommp41") }));
+        Bytes mdat = Box("mdat", Bytes(mdatSize, 0xAB));
+
+        Bytes mvhd = Box("mvhd", Concat({ BE32(0), BE32(0), BE32(0), BE32(1000),
+                                          BE32(static_cast<uint32_t>(1000.0 * frames * frameDelta / timescale)),
+                                          Bytes(80, 0) }));
+
+        Bytes hdlr = Box("hdlr", Concat({ BE32(0), BE32(0), Str("vide"), Bytes(12, 0), Bytes(1, 0) }));
+        Bytes mdhd = Box("mdhd", Concat({ BE32(0), BE32(0), BE32(0), BE32(timescale),
+                                          BE32(frames * frameDelta), BE32(0) }));
+
+        Bytes visual = Concat({ Bytes(6, 0), BE16(1), Bytes(16, 0), BE16(static_cast<uint16_t>(width)),
+                                BE16(static_cast<uint16_t>(height)), BE32(0x00480000), BE32(0x00480000),
+                                BE32(0), BE16(1), Bytes(32, 0), BE16(24), BE16(0xFFFF) });
+        Bytes sampleEntry;
+        if (hevc10Bit) {
+            Bytes hvcC(23, 0);
+            hvcC[0] = 1;
+            hvcC[1] = 2;                 // Main10
+            hvcC[16] = 0xFC | 1;         // 4:2:0
+            hvcC[17] = 0xF8 | 2;         // bitDepthLumaMinus8 = 2
+            Bytes colr = Box("colr", Concat({ Str("nclx"), BE16(9), BE16(16), BE16(9), Bytes(1, 0) }));
+            sampleEntry = Box("hvc1", Concat({ visual, Box("hvcC", hvcC), colr }));
+        } else {
+            Bytes avcC = { 1, 77, 0, 40, 0xFF, 0xE1, 0, 4, 0x67, 77, 0, 40, 1, 0, 2, 0x68, 0xCE };
+            sampleEntry = Box("avc1", Concat({ visual, Box("avcC", avcC) }));
+        }
+        Bytes stsd = Box("stsd", Concat({ BE32(0), BE32(1), sampleEntry }));
+        Bytes stts = Box("stts", Concat({ BE32(0), BE32(1), BE32(frames), BE32(frameDelta) }));
+        Bytes stssEntries;
+        for (uint32_t i = 0; i < keyframes; ++i) Append(stssEntries, BE32(1 + i * (frames / keyframes)));
+        Bytes stss = Box("stss", Concat({ BE32(0), BE32(keyframes), stssEntries }));
+
+        Bytes stbl = Box("stbl", Concat({ stsd, stts, stss }));
+        Bytes minf = Box("minf", stbl);
+        Bytes mdia = Box("mdia", Concat({ mdhd, hdlr, minf }));
+        Bytes trak = Box("trak", mdia);
+        Bytes moov = Box("moov", Concat({ mvhd, trak }));
+
+        return Concat({ ftyp, mdat, moov });
+    }
+
+    // EBML + Segment(SeekHead, Info, Tracks, Cluster, Cues) içeren WebM/VP9
+    static Bytes BuildWebm(int width, int height, double durationSeconds, uint64_t frameDurationNs,
+                           uint32_t cuePoints, int bitDepth, int matrix) {
+        Bytes ebml = Element(0x1A45DFA3, Concat({ Element(0x4286, UInt(1)), Element(0x4282, Str("webm")) }));
+
+        Bytes info = Element(0x1549A966, Concat({ Element(0x2AD7B1, UInt(1000000)),
+                                                  Element(0x4489, Float64(durationSeconds * 1000.0)) }));
+        Bytes colour = Element(0x55B0, Concat({ Element(0x55B1, UInt(matrix)), Element(0x55B2, UInt(bitDepth)) }));
+        Bytes video = Element(0xE0, Concat({ Element(0xB0, UInt(width)), Element(0xBA, UInt(height)), colour }));
+        Bytes audioTrack = Element(0xAE, Concat({ Element(0xD7, UInt(1)), Element(0x83, UInt(2)),
+                                                  Element(0x86, Str("A_OPUS")) }));
+        Bytes videoTrack = Element(0xAE, Concat({ Element(0xD7, UInt(2)), Element(0x83, UInt(1)),
+                                                  Element(0x86, Str("V_VP9")),
+                                                  Element(0x23E383, UInt(frameDurationNs)), video }));
+        Bytes tracks = Element(0x1654AE6B, Concat({ audioTrack, videoTrack }));
+        Bytes cluster = Element(0x1F43B675, Concat({ Element(0xE7, UInt(0)), Element(0xA3, Bytes(2048, 0x11)) }));
+
+        Bytes cues;
+        for (uint32_t i = 0; i < cuePoints; ++i) {
+            Bytes positions = Element(0xB7, Concat({ Element(0xF7, UInt(2)), Element(0xF1, UInt(0)) }));
+            Append(cues, Element(0xBB, Concat({ Element(0xB3, UInt(i * 1000)), positions })));
+        }
+        // Ses izine ait bir cue; sayılmamalı
+        Append(cues, Element(0xBB, Concat({ Element(0xB3, UInt(0)),
+                                            Element(0xB7, Concat({ Element(0xF7, UInt(1)), Element(0xF1, UInt(0)) })) })));
+        Bytes cuesElement = Element(0x1C53BB6B, cues);
+
+        // SeekHead sabit boyutlu olsun diye konumu 8 baytlık tamsayı ile yaz
+        auto buildSeekHead = [](uint64_t cuesPosition) {
+            Bytes seek = Element(0x4DBB, Concat({ Element(0x53AB, { 0x1C, 0x53, 0xBB, 0x6B }),
+                                                  Element(0x53AC, BE64(cuesPosition)) }));
+            return Element(0x114D9B74, seek);
+        };
+        const uint64_t cuesPosition = buildSeekHead(0).size() + info.size() + tracks.size() + cluster.size();
+        Bytes segmentBody = Concat({ buildSeekHead(cuesPosition), info, tracks, cluster, cuesElement });
+
+        return Concat({ ebml, Element(0x18538067, segmentBody) });
+    }
+
+    // hdrl + movi + idx1 içeren AVI
+    static Bytes BuildAvi(int width, int height, uint32_t rate, uint32_t scale, uint32_t frames,
+                          uint32_t keyframeInterval, const char* fourcc) {
+        Bytes avih = Chunk("avih", Concat({ LE32(static_cast<uint32_t>(1e6 * scale / rate)), LE32(0), LE32(0), LE32(0x10),
+                                            LE32(frames), LE32(0), LE32(1), LE32(0),
+                                            LE32(width), LE32(height), Bytes(16, 0) }));
+        Bytes strh = Chunk("strh", Concat({ Str("vids"), Str(fourcc), LE32(0), LE16(0), LE16(0), LE32(0),
+                                            LE32(scale), LE32(rate), LE32(0), LE32(frames),
+                                            LE32(0), LE32(0xFFFFFFFF), LE32(0), Bytes(8, 0) }));
+        Bytes strf = Chunk("strf", Concat({ LE32(40), LE32(width), LE32(height), LE16(1), LE16(24),
+                                            Str(fourcc), LE32(width * height * 3), Bytes(16, 0) }));
+        Bytes strl = List("strl", Concat({ strh, strf }));
+        Bytes hdrl = List("hdrl", Concat({ avih, strl }));
+
+        Bytes movi;
+        Bytes idx1;
+        uint32_t offset = 4;
+        for (uint32_t i = 0; i < frames; ++i) {
+            Bytes frame = Chunk("00dc", Bytes(16, static_cast<uint8_t>(i)));
+            Append(idx1, Concat({ Str("00dc"), LE32(i % keyframeInterval == 0 ? 0x10 : 0), LE32(offset), LE32(16) }));
+            offset += static_cast<uint32_t>(frame.size());
+            Append(movi, frame);
+        }
+        Bytes body = Concat({ Str("AVI "), hdrl, List("movi", movi), Chunk("idx1", idx1) });
+        return Concat({ Str("RIFF"), LE32(static_cast<uint32_t>(body.size())), body });
+    }
+
+private:
+    static Bytes Concat(std::initializer_list<Bytes> parts) {
+        Bytes out;
+        for (const auto& part : parts) Append(out, part);
+        return out;
+    }
+    static void Append(Bytes& out, const Bytes& part) { out.insert(out.end(), part.begin(), part.end()); }
+    static Bytes Str(const std::string& text) { return Bytes(text.begin(), text.end()); }
+
+    static Bytes BE16(uint16_t v) { return { static_cast<uint8_t>(v >> 8), static_cast<uint8_t>(v) }; }
+    static Bytes BE32(uint32_t v) {
+        return { static_cast<uint8_t>(v >> 24), static_cast<uint8_t>(v >> 16), static_cast<uint8_t>(v >> 8), static_cast<uint8_t>(v) };
+    }
+    static Bytes BE64(uint64_t v) { return Concat({ BE32(static_cast<uint32_t>(v >> 32)), BE32(static_cast<uint32_t>(v)) }); }
+    static Bytes LE16(uint16_t v) { return { static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8) }; }
+    static Bytes LE32(uint32_t v) {
+        return { static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8), static_cast<uint8_t>(v >> 16), static_cast<uint8_t>(v >> 24) };
+    }
+
+    static Bytes Box(const char* type, const Bytes& payload) {
+        return Concat({ BE32(static_cast<uint32_t>(payload.size() + 8)), Str(type), payload });
+    }
+    static Bytes Chunk(const char* id, const Bytes& payload) {
+        Bytes out = Concat({ Str(id), LE32(static_cast<uint32_t>(payload.size())), payload });
+        if (payload.size() & 1) out.push_back(0);
+        return out;
+    }
+    static Bytes List(const char* type, const Bytes& payload) {
+        return Chunk("LIST", Concat({ Str(type), payload }));
+    }
+
+    // EBML: ID işaret bitleriyle birlikte yazılır, boyut her zaman 8 bayt
+    static Bytes Element(uint32_t id, const Bytes& payload) {
+        Bytes out;
+        if (id > 0xFFFFFF) out = BE32(id);
+        else if (id > 0xFFFF) out = { static_cast<uint8_t>(id >> 16), static_cast<uint8_t>(id >> 8), static_cast<uint8_t>(id) };
+        else if (id > 0xFF) out = BE16(static_cast<uint16_t>(id));
+        else out = { static_cast<uint8_t>(id) };
+        Bytes size = BE64(payload.size());
+        size[0] = 0x01;
+        Append(out, size);
+        Append(out, payload);
+        return out;
+    }
+    static Bytes UInt(uint64_t v) {
+        Bytes out;
+        do { out.insert(out.begin(), static_cast<uint8_t>(v & 0xFF)); v >>= 8; } while (v);
+        return out;
+    }
+    static Bytes Float64(double v) {
+        uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        return BE64(bits);
+    }
+};
@@ -0,0 +1,79 @@
+// tests/SyntheticVideo.h
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "../Headers/AnimatedPreview.h"
+
+// Çözücü gerektirmeyen kare kaynağı: sabit arka plan üzerinde hareket eden
+// bir kare ve yavaşça kayan bir gradyan. Anahtar kareler her saniye başında.
+class SyntheticVideo : public AnimatedPreview::FrameSource {
+public:
+    SyntheticVideo(int width, int height, double fps, double duration)
+        : width(width), height(height), fps(fps), duration(duration), frameIndex(0), decodedFrames(0),
+          pixels(static_cast<size_t>(width) * height * 4) {}
+
+    bool SeekTo(double seconds) override {
+        if (seconds < 0.0 || seconds > duration) return false;
+        frameIndex = static_cast<int>(std::floor(seconds)) * static_cast<int>(std::lround(fps));
+        return true;
+    }
+
+    bool ReadFrame(AnimatedPreview::Frame& frame) override {
+        const double timestamp = frameIndex / fps;
+        if (timestamp >= duration) return false;
+
+        Render(timestamp);
+        ++frameIndex;
+        ++decodedFrames;
+        frame = { pixels.data(), width, height, width * 4, timestamp };
+        return true;
+    }
+
+    int GetDecodedFrames() const { return decodedFrames; }
+
+    // Testlerin beklenen kareyi üretebilmesi için. Arka plan bir kez çizilir,
+    // her karede kopyalanıp üzerine kutu çizilir (çözücü maliyetini şişirmesin).
+    void Render(double timestamp) {
+        if (background.empty()) {
+            background.resize(pixels.size());
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    uint8_t* pixel = &background[(static_cast<size_t>(y) * width + x) * 4];
+                    pixel[0] = static_cast<uint8_t>(60 + 120 * y / height);
+                    pixel[1] = static_cast<uint8_t>(80 + 100 * x / width);
+                    pixel[2] = 90;
+                    pixel[3] = 255;
+                }
+            }
+        }
+        std::memcpy(pixels.data(), background.data(), pixels.size());
+
+        const int boxSize = height / 4;
+        const int boxX = static_cast<int>((width - boxSize) * (0.5 + 0.5 * std::sin(timestamp * 2.0)));
+        const int boxY = height / 3;
+        for (int y = boxY; y < boxY + boxSize; ++y) {
+            for (int x = boxX; x < boxX + boxSize; ++x) {
+                uint8_t* pixel = &pixels[(static_cast<size_t>(y) * width + x) * 4];
+                pixel[0] = 40;
+                pixel[1] = 200;
+                pixel[2] = 240;
+            }
+        }
+    }
+
+    const uint8_t* GetPixels() const { return pixels.data(); }
+
+private:
+    int width;
+    int height;
+    double fps;
+    double duration;
+    int frameIndex;
+    int decodedFrames;
+    std::vector<uint8_t> pixels;
+    std::vector<uint8_t> background;
+};
@@ -0,0 +1,115 @@
+// tests/test_admission_control.cpp
+#include "../Headers/AdmissionControl.h"
+#include "../Headers/BufferDepthController.h"
+#include <gtest/gtest.h>
+
+static constexpr size_t MB = 1024 * 1024;
+
+class TestAdmissionControl : public ::testing::Test {
+protected:
+    static AdmissionControl::Request MakeRequest(const char* codec, int width, int height, int bitDepth,
+                                                 int monitors, size_t availableBytes) {
+        AdmissionControl::Request request;
+        request.probe.codec = codec;
+        request.probe.width = width;
+        request.probe.height = height;
+        request.probe.bitDepth = bitDepth;
+        request.monitorCount = monitors;
+        request.availableBytes = availableBytes;
+        request.desiredDepth = 8;
+        return request;
+    }
+};
+
+TEST_F(TestAdmissionControl, FootprintScalesWithResolutionAndBitDepth) {
+    EXPECT_EQ(AdmissionControl::DecodedFrameBytes(1920, 1080, 8), static_cast<size_t>(1920) * 1080 * 3 / 2);
+    EXPECT_EQ(AdmissionControl::DecodedFrameBytes(1920, 1080, 10), AdmissionControl::DecodedFrameBytes(1920, 1080, 8) * 2);
+
+    const auto hd = MakeRequest("H.264", 1920, 1080, 8, 1, 0);
+    const auto uhd = MakeRequest("H.264", 3840, 2160, 8, 1, 0);
+    const auto uhd10 = MakeRequest("H.264", 3840, 2160, 10, 1, 0);
+    const auto footprintHd = AdmissionControl::Estimate(hd, 1, 8, false);
+    const auto footprintUhd = AdmissionControl::Estimate(uhd, 1, 8, false);
+    EXPECT_EQ(footprintUhd.queueBytes, footprintHd.queueBytes * 4);
+    EXPECT_EQ(footprintHd.totalBytes, footprintHd.decoderBytes + footprintHd.queueBytes);
+    // Kuyruk BGRA: bit derinliği sadece çözücü yüzeylerini etkiler
+    EXPECT_EQ(AdmissionControl::Estimate(uhd10, 1, 8, false).decoderBytes, footprintUhd.decoderBytes * 2);
+    EXPECT_EQ(AdmissionControl::Estimate(uhd10, 1, 8, false).queueBytes, footprintUhd.queueBytes);
+
+    // Her monitör ayrı çözücü + kuyruk; paylaşımda tek
+    const auto fourMonitors = MakeRequest("H.264", 3840, 2160, 8, 4, 0);
+    EXPECT_EQ(AdmissionControl::Estimate(fourMonitors, 1, 8, false).totalBytes, footprintUhd.totalBytes * 4);
+    EXPECT_EQ(AdmissionControl::Estimate(fourMonitors, 1, 8, true).totalBytes, footprintUhd.totalBytes);
+}
+
+TEST_F(TestAdmissionControl, ReferenceFramesFollowCodecLevelLimits) {
+    // H.264 seviye 5.1: 1080p'de 16 (tavan), 4K'da 5
+    EXPECT_EQ(AdmissionControl::ReferenceFrames("H.264", 1920, 1080), 16);
+    EXPECT_EQ(AdmissionControl::ReferenceFrames("H.264", 3840, 2160), 5);
+    // HEVC: küçük resimlerde DPB büyür
+    EXPECT_EQ(AdmissionControl::ReferenceFrames("HEVC", 1920, 1080), 16);
+    EXPECT_EQ(AdmissionControl::ReferenceFrames("HEVC", 3840, 2160), 6);
+    EXPECT_EQ(AdmissionControl::ReferenceFrames("HEVC", 7680, 4320), 6);
+    EXPECT_EQ(AdmissionControl::ReferenceFrames("AV1", 3840, 2160), 8);
+    EXPECT_EQ(AdmissionControl::ReferenceFrames("VP9", 3840, 2160), 8);
+    EXPECT_EQ(AdmissionControl::ReferenceFrames("MJPEG", 3840, 2160), 2);
+}
+
+TEST_F(TestAdmissionControl, AcceptsWhenDesiredConfigurationFits) {
+    const auto plan = AdmissionControl::Decide(MakeRequest("H.264", 1920, 1080, 8, 1, 200 * MB));
+    EXPECT_EQ(plan.outcome, AdmissionControl::Outcome::Accept);
+    EXPECT_EQ(plan.decodeScale, 1);
+    EXPECT_EQ(plan.bufferDepth, 8);
+    EXPECT_EQ(plan.decodeWidth, 1920);
+    EXPECT_EQ(plan.decodeHeight, 1080);
+    EXPECT_LE(plan.estimatedBytes, 200 * MB);
+    EXPECT_FALSE(plan.reason.empty());
+}
+
+TEST_F(TestAdmissionControl, DegradesQueueBeforeResolution) {
+    // 4K H.264: 8 derinlikte ~377 MB, 2 derinlikte ~178 MB
+    auto plan = AdmissionControl::Decide(MakeRequest("H.264", 3840, 2160, 8, 1, 200 * MB));
+    EXPECT_EQ(plan.outcome, AdmissionControl::Outcome::Degrade);
+    EXPECT_EQ(plan.decodeScale, 1);
+    EXPECT_LT(plan.bufferDepth, 8);
+    EXPECT_GE(plan.bufferDepth, BufferDepthController::MIN_DEPTH);
+    EXPECT_LE(plan.estimatedBytes, 200 * MB);
+
+    // En sığ kuyruk da sığmazsa yarım çözünürlük
+    plan = AdmissionControl::Decide(MakeRequest("H.264", 3840, 2160, 8, 1, 150 * MB));
+    EXPECT_EQ(plan.outcome, AdmissionControl::Outcome::Degrade);
+    EXPECT_EQ(plan.decodeScale, 2);
+    EXPECT_EQ(plan.bufferDepth, BufferDepthController::MIN_DEPTH);
+    EXPECT_EQ(plan.decodeWidth, 1920);
+    EXPECT_EQ(plan.decodeHeight, 1080);
+    EXPECT_LE(plan.estimatedBytes, 150 * MB);
+}
+
+TEST_F(TestAdmissionControl, EightKTenBitOnFourMonitors) {
+    // 200 MB'lık varsayılan sınırda tek bir 8K 10-bit çözücü bile sığmaz: yüklemeden reddedilir
+    auto request = MakeRequest("HEVC", 7680, 4320, 10, 4, 200 * MB);
+    request.allowSharedDecode = true;
+    auto plan = AdmissionControl::Decide(request);
+    EXPECT_EQ(plan.outcome, AdmissionControl::Outcome::Reject);
+    EXPECT_NE(plan.reason.find("7680x4320"), std::string::npos);
+
+    // Geniş bütçede monitör başına çözücü sığmaz, paylaşımlı çözme sığar
+    request.availableBytes = 2048 * MB;
+    request.outputWidth = 3840;
+    request.outputHeight = 2160;
+    plan = AdmissionControl::Decide(request);
+    EXPECT_EQ(plan.outcome, AdmissionControl::Outcome::Degrade);
+    EXPECT_TRUE(plan.sharedDecode);
+    EXPECT_EQ(plan.decodeScale, 1);
+    EXPECT_EQ(plan.bufferDepth, 8);
+
+    // Paylaşım yoksa (monitör başına graph) aynı bütçe reddedilir
+    request.allowSharedDecode = false;
+    plan = AdmissionControl::Decide(request);
+    EXPECT_EQ(plan.outcome, AdmissionControl::Outcome::Reject);
+}
+
+TEST_F(TestAdmissionControl, UnknownResolutionIsRejected) {
+    const auto plan = AdmissionControl::Decide(MakeRequest("H.264", 0, 0, 8, 1, 200 * MB));
+    EXPECT_EQ(plan.outcome, AdmissionControl::Outcome::Reject);
+}
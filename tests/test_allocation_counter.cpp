@@ -0,0 +1,167 @@
+// tests/test_allocation_counter.cpp
+#include "../Headers/AllocationCounter.h"
+#include "../Headers/FramePipeline.h"
+#include "SyntheticVideo.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <thread>
+
+// Çağrı yeri adıyla bulunabilsin diye global ve inline / klonlanmayan fonksiyonlar
+#if defined(_MSC_VER)
+#define TEST_NOINLINE __declspec(noinline)
+#elif defined(__clang__)
+#define TEST_NOINLINE __attribute__((noinline))
+#else
+#define TEST_NOINLINE __attribute__((noipa))
+#endif
+
+static char* volatile g_allocationSink;   // new/delete çifti derleyici tarafından silinmesin
+
+// Eski oynatma döngüsünün her karede yaptığı gibi kare başına ayırma
+TEST_NOINLINE void AllocatingDecodeSite(size_t size) {
+    char* block = new char[size];
+    g_allocationSink = block;
+    delete[] block;
+}
+
+class TestAllocationCounter : public ::testing::Test {
+protected:
+    static constexpr int WIDTH = 640;
+    static constexpr int HEIGHT = 360;
+    static constexpr double FRAME_INTERVAL = 1000.0 / 30.0;
+    static constexpr int WARMUP_FRAMES = 300;   // Derinlik denetleyicisi ısınıp minimuma inene kadar
+
+    // Çözücü yerine sentetik video: kare slotun kendi buffer'ına kopyalanır
+    static void AttachSyntheticDecoder(FramePipeline& pipeline, SyntheticVideo& video, uint32_t& clockMs) {
+        pipeline.SetDecoder([&video, &clockMs](FramePipeline::Frame& frame) {
+            clockMs += static_cast<uint32_t>(FRAME_INTERVAL);
+            video.Render(clockMs / 1000.0);
+            frame.width = WIDTH;
+            frame.height = HEIGHT;
+            frame.stride = WIDTH * 4;
+            frame.timestampMs = clockMs;
+            frame.pixels.resize(static_cast<size_t>(frame.stride) * HEIGHT);
+            std::memcpy(frame.pixels.data(), video.GetPixels(), frame.pixels.size());
+            return true;
+        });
+    }
+};
+
+TEST_F(TestAllocationCounter, CountsOnlyScopedThreadAllocations) {
+    AllocationCounter outer;
+    {
+        AllocationCounter inner;
+        AllocatingDecodeSite(100);
+        AllocatingDecodeSite(200);
+        EXPECT_EQ(inner.GetCount(), 2u);
+        EXPECT_EQ(inner.GetBytes(), 300u);
+    }
+    AllocatingDecodeSite(50);
+    // İçteki sayacın gördükleri dıştakine de sayılır
+    EXPECT_EQ(outer.GetCount(), 3u);
+    EXPECT_EQ(outer.GetBytes(), 350u);
+
+    // Başka thread'in ayırmaları sayılmaz (std::thread'in kendi durumu bu thread'de ayrılır)
+    std::thread other([] { AllocatingDecodeSite(1000); });
+    const uint64_t started = outer.GetCount();
+    other.join();
+    EXPECT_EQ(outer.GetCount(), started);
+
+    outer.Reset();
+    EXPECT_EQ(outer.GetCount(), 0u);
+    EXPECT_TRUE(outer.GetFirstAllocationSite().empty());
+}
+
+TEST_F(TestAllocationCounter, ReportsFirstOffendingCallSite) {
+#ifdef _WIN32
+    GTEST_SKIP() << "Sembol adları sadece Linux'ta (dladdr) çözülür";
+#endif
+    AllocationCounter counter;
+    AllocatingDecodeSite(4096);
+    AllocatingDecodeSite(16);
+
+    ASSERT_EQ(counter.GetCount(), 2u);
+    const auto site = counter.GetFirstAllocationSite();
+    ASSERT_FALSE(site.empty());
+    // Yaprak çerçeve operator new değil, ayırmayı yapan fonksiyon
+    EXPECT_NE(site[0].find("AllocatingDecodeSite"), std::string::npos) << counter.Describe();
+    const std::string description = counter.Describe();
+    EXPECT_NE(description.find("ilki 4096 bayt"), std::string::npos) << description;
+    EXPECT_NE(description.find("ReportsFirstOffendingCallSite"), std::string::npos) << description;
+}
+
+TEST_F(TestAllocationCounter, SteadyStatePlaybackDoesNotAllocate) {
+    constexpr int STEADY_FRAMES = 10000;
+    SyntheticVideo video(WIDTH, HEIGHT, 30.0, 1.0e6);
+    uint32_t clockMs = 0;
+    uint64_t checksum = 0;
+
+    FramePipeline pipeline(FRAME_INTERVAL);
+    AttachSyntheticDecoder(pipeline, video, clockMs);
+    pipeline.SetPresenter([&checksum](const FramePipeline::Frame& frame) {
+        checksum += frame.pixels[(frame.pixels.size() / 2) & ~size_t(3)] + frame.index;
+    });
+
+    for (int i = 0; i < WARMUP_FRAMES; ++i) pipeline.Step();
+    const uint64_t presentedBefore = pipeline.GetPresentedCount();
+
+    AllocationCounter counter;
+    for (int i = 0; i < STEADY_FRAMES; ++i) pipeline.Step();
+    const uint64_t allocations = counter.GetCount();
+
+    EXPECT_EQ(allocations, 0u) << "Isınmış oynatma döngüsü ayırma yaptı: " << counter.Describe();
+    EXPECT_EQ(pipeline.GetPresentedCount() - presentedBefore, static_cast<uint64_t>(STEADY_FRAMES));
+    EXPECT_EQ(pipeline.GetQueuedCount(), static_cast<size_t>(pipeline.GetDepth()));
+    EXPECT_GT(checksum, 0u);
+}
+
+TEST_F(TestAllocationCounter, DetectsPerFrameAllocationInDecoder) {
+    SyntheticVideo video(WIDTH, HEIGHT, 30.0, 1.0e6);
+    uint32_t clockMs = 0;
+    FramePipeline pipeline(FRAME_INTERVAL);
+    AttachSyntheticDecoder(pipeline, video, clockMs);
+    for (int i = 0; i < WARMUP_FRAMES; ++i) pipeline.Step();
+
+    // Kare başına yeni buffer ayıran bir decoder (unique_ptr<FrameData> gibi)
+    pipeline.SetDecoder([](FramePipeline::Frame& frame) {
+        AllocatingDecodeSite(64);
+        frame.timestampMs += 33;
+        return true;
+    });
+    AllocationCounter counter;
+    for (int i = 0; i < 100; ++i) pipeline.Step();
+    EXPECT_EQ(counter.GetCount(), 100u);
+#ifndef _WIN32
+    const auto site = counter.GetFirstAllocationSite();
+    ASSERT_FALSE(site.empty());
+    EXPECT_NE(site[0].find("AllocatingDecodeSite"), std::string::npos) << counter.Describe();
+#endif
+}
+
+TEST_F(TestAllocationCounter, MemoryCapReleasesIdleFrameSlots) {
+    SyntheticVideo video(WIDTH, HEIGHT, 30.0, 1.0e6);
+    uint32_t clockMs = 0;
+    const size_t frameBytes = static_cast<size_t>(WIDTH) * HEIGHT * 4;
+    const size_t baseline = MemoryAccounting::GetCurrent(MemoryCategory::Frames);
+    {
+        FramePipeline pipeline(FRAME_INTERVAL);
+        AttachSyntheticDecoder(pipeline, video, clockMs);
+        for (int i = 0; i < 10; ++i) pipeline.Step();
+        // Başlangıç derinliği 3: sunulan karenin slotu bir sonraki decode'a gider
+        EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Frames) - baseline, 3 * frameBytes);
+
+        pipeline.SetMemoryCap(1);
+        EXPECT_EQ(pipeline.GetQueuedCount(), 1u);
+        EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Frames) - baseline, frameBytes);
+
+        // Kuyruktaki kare yeniden kullanılır, yeni slot ayrılmaz
+        for (int i = 0; i < 10; ++i) pipeline.Step();
+        EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Frames) - baseline, frameBytes);
+
+        // Yaşlanan kareler atılır
+        EXPECT_EQ(pipeline.DropOlderThan(clockMs + 10000, 5000), 1u);
+        EXPECT_EQ(pipeline.GetQueuedCount(), 0u);
+        EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Frames), baseline);
+    }
+    EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Frames), baseline);
+}
@@ -0,0 +1,174 @@
+// tests/test_animated_preview.cpp
+#include "SyntheticMedia.h"
+#include "SyntheticVideo.h"
+#include "../Headers/AnimatedPreview.h"
+#include "../Headers/ThumbnailQueue.h"
+#include <gtest/gtest.h>
+#include <cstdlib>
+
+class TestAnimatedPreview : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_preview_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+};
+
+TEST_F(TestAnimatedPreview, GeneratesDefaultTwoSecondPreview) {
+    SyntheticVideo video(640, 360, 30.0, 10.0);
+    std::vector<uint8_t> bytes;
+    ASSERT_TRUE(AnimatedPreview::Generate(video, 10.0, bytes));
+
+    AnimatedPreview::Player player;
+    ASSERT_TRUE(player.Load(bytes));
+    EXPECT_EQ(player.GetWidth(), 160);
+    EXPECT_EQ(player.GetHeight(), 90);
+    EXPECT_EQ(player.GetFrameCount(), 16);   // 2 s x 8 fps
+    EXPECT_EQ(player.GetFrameIntervalMs(), 125);
+
+    // İki kısa dizi: her biri anahtar kareden ~1 saniye çözer
+    EXPECT_LT(video.GetDecodedFrames(), 2 * 30 + 2);
+
+    // Ham BGRA'nın çok altında kalmalı
+    EXPECT_LT(bytes.size(), 16u * 160 * 90 * 4 / 8);
+}
+
+TEST_F(TestAnimatedPreview, DecodedFramesMatchSource) {
+    SyntheticVideo video(320, 180, 8.0, 4.0);
+    AnimatedPreview::Encoder encoder(160, 90, 125, 0);   // Eşik 0: kayıpsız karo atlama
+    std::vector<std::vector<uint8_t>> expected;
+    AnimatedPreview::Frame frame;
+    while (video.ReadFrame(frame)) {
+        std::vector<uint8_t> scaled;
+        AnimatedPreview::ScaleFrame(frame, 160, 90, scaled);
+        encoder.AddFrame(scaled.data(), 160 * 4);
+        expected.push_back(std::move(scaled));
+    }
+
+    AnimatedPreview::Player player;
+    ASSERT_TRUE(player.Load(encoder.Finish()));
+    ASSERT_EQ(player.GetFrameCount(), static_cast<int>(expected.size()));
+
+    for (size_t f = 0; f < expected.size(); ++f) {
+        AnimatedPreview::Player::Rect dirty;
+        ASSERT_TRUE(player.Advance(dirty));
+        EXPECT_EQ(player.GetCurrentFrame(), static_cast<int>(f));
+
+        // RGB565 nicemleme hatası kanal başına en fazla 7
+        int worst = 0;
+        for (size_t i = 0; i < expected[f].size(); ++i) {
+            worst = std::max(worst, std::abs(expected[f][i] - player.GetPixels()[i]));
+        }
+        EXPECT_LE(worst, 7) << "frame " << f;
+    }
+
+    // Sonda başa sarar
+    AnimatedPreview::Player::Rect dirty;
+    ASSERT_TRUE(player.Advance(dirty));
+    EXPECT_EQ(player.GetCurrentFrame(), 0);
+}
+
+TEST_F(TestAnimatedPreview, UnloadReleasesFramesAndMemory) {
+    SyntheticVideo video(320, 180, 8.0, 1.0);
+    std::vector<uint8_t> data;
+    ASSERT_TRUE(AnimatedPreview::Generate(video, 1.0, data));
+
+    const size_t before = MemoryAccounting::GetCurrent(MemoryCategory::Thumbnails);
+    AnimatedPreview::Player player;
+    ASSERT_TRUE(player.Load(std::move(data)));
+    EXPECT_GT(MemoryAccounting::GetCurrent(MemoryCategory::Thumbnails), before);
+
+    player.Unload();
+    EXPECT_FALSE(player.IsLoaded());
+    EXPECT_EQ(player.GetWidth(), 0);
+    EXPECT_EQ(player.GetFrameCount(), 0);
+    EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Thumbnails), before);
+    AnimatedPreview::Player::Rect dirty;
+    EXPECT_FALSE(player.Advance(dirty));
+}
+
+TEST_F(TestAnimatedPreview, StaticTilesAreSkipped) {
+    // Sadece küçük bir kare hareket ediyor: delta kareler küçük, kirli alan dar
+    std::vector<uint8_t> frame(160 * 90 * 4, 0);
+    AnimatedPreview::Encoder encoder(160, 90, 125);
+    std::vector<size_t> sizes;
+    for (int f = 0; f < 8; ++f) {
+        for (size_t i = 0; i < frame.size(); i += 4) {
+            frame[i] = 30; frame[i + 1] = 60; frame[i + 2] = 90; frame[i + 3] = 255;
+        }
+        for (int y = 40; y < 48; ++y) {
+            for (int x = f * 8; x < f * 8 + 8; ++x) {
+                frame[(y * 160 + x) * 4 + 2] = 250;
+            }
+        }
+        encoder.AddFrame(frame.data(), 160 * 4);
+    }
+
+    AnimatedPreview::Player player;
+    ASSERT_TRUE(player.Load(encoder.Finish()));
+    AnimatedPreview::Player::Rect dirty;
+    ASSERT_TRUE(player.Advance(dirty));
+    EXPECT_EQ(dirty.right - dirty.left, 160);
+
+    ASSERT_TRUE(player.Advance(dirty));
+    EXPECT_EQ(dirty.top, 40);
+    EXPECT_EQ(dirty.bottom, 48);
+    EXPECT_EQ(dirty.left, 0);
+    EXPECT_EQ(dirty.right, 16);   // Eski ve yeni konum
+    EXPECT_EQ(player.GetPixels()[(44 * 160 + 12) * 4 + 2], 255);
+}
+
+TEST_F(TestAnimatedPreview, RejectsCorruptData) {
+    SyntheticVideo video(320, 180, 24.0, 6.0);
+    std::vector<uint8_t> bytes;
+    ASSERT_TRUE(AnimatedPreview::Generate(video, 6.0, bytes));
+
+    AnimatedPreview::Player player;
+    auto truncated = bytes;
+    truncated.resize(truncated.size() / 2);
+    EXPECT_FALSE(player.Load(truncated));
+
+    auto badMagic = bytes;
+    badMagic[0] ^= 0xFF;
+    EXPECT_FALSE(player.Load(badMagic));
+
+    // Dosyaya yaz / oku
+    const auto path = testDir / "clip.lmap";
+    ASSERT_TRUE(AnimatedPreview::WriteFile(path, bytes));
+    EXPECT_TRUE(player.Open(path));
+    EXPECT_FALSE(player.Open(testDir / "missing.lmap"));
+}
+
+TEST_F(TestAnimatedPreview, QueueRecordsPreviewPath) {
+    const auto mp4 = SyntheticMedia::BuildMp4(1280, 720, 250, 25, 1, 5, false);
+    SyntheticMedia::WriteFile(testDir / "clip.mp4", mp4);
+    MediaLibrary library;
+    library.Rescan(testDir);
+
+    ThumbnailQueue previews([&](const std::filesystem::path& video, std::filesystem::path& preview) {
+        SyntheticVideo source(320, 180, 25.0, 10.0);
+        std::vector<uint8_t> bytes;
+        preview = video;
+        preview.replace_extension(".lmap");
+        return AnimatedPreview::Generate(source, 10.0, bytes) && AnimatedPreview::WriteFile(preview, bytes);
+    }, &library, ThumbnailQueue::Target::AnimatedPreview);
+
+    previews.Enqueue(testDir / "clip.mp4");
+    ASSERT_TRUE(previews.WaitUntilIdle(std::chrono::seconds(5)));
+
+    MediaLibrary::Entry entry;
+    ASSERT_TRUE(library.GetEntry(testDir / "clip.mp4", entry));
+    EXPECT_EQ(entry.previewPath.filename(), "clip.lmap");
+    EXPECT_TRUE(entry.thumbnailPath.empty());
+
+    AnimatedPreview::Player player;
+    EXPECT_TRUE(player.Open(entry.previewPath));
+}
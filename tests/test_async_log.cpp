@@ -0,0 +1,182 @@
+// tests/test_async_log.cpp
+#include "../Headers/AsyncLog.h"
+#include "../Headers/AllocationCounter.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TestAsyncLog : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_async_log_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+
+    static std::vector<std::string> ReadLines(const std::filesystem::path& path) {
+        std::ifstream file(path);
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(file, line);) lines.push_back(line);
+        return lines;
+    }
+
+    // "[2024-01-31 23:59:59.123] [INFO] mesaj" -> "mesaj"
+    static std::string MessageOf(const std::string& line) {
+        const size_t level = line.find("] [");
+        const size_t message = line.find("] ", level + 3);
+        return message == std::string::npos ? std::string() : line.substr(message + 2);
+    }
+};
+
+TEST_F(TestAsyncLog, WritesEveryRecordInProducerOrder) {
+    constexpr int THREADS = 4;
+    constexpr int RECORDS = 500;
+    const auto path = testDir / "log.txt";
+    {
+        AsyncLog log;
+        ASSERT_TRUE(log.SetFile(path.string()));
+        std::vector<std::thread> producers;
+        for (int t = 0; t < THREADS; ++t) {
+            producers.emplace_back([&log, t] {
+                for (int i = 0; i < RECORDS; ++i) {
+                    // Kuyruk yarı dolunca yazıcı uyanır; kapasite yetmezse düşük öncelik düşer
+                    while (!log.Push(LogSeverity::Warning, std::to_string(t) + " " + std::to_string(i))) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& producer : producers) producer.join();
+        log.Flush();
+        EXPECT_EQ(log.GetWrittenCount(), static_cast<uint64_t>(THREADS * RECORDS));
+    }
+
+    std::vector<int> next(THREADS, 0);
+    for (const auto& line : ReadLines(path)) {
+        if (line.find("[WARNING]") == std::string::npos || line.find("düşürüldü") != std::string::npos) continue;
+        const std::string message = MessageOf(line);
+        const int thread = std::stoi(message.substr(0, message.find(' ')));
+        const int index = std::stoi(message.substr(message.find(' ') + 1));
+        ASSERT_EQ(index, next[thread]) << line;
+        ++next[thread];
+    }
+    for (int count : next) EXPECT_EQ(count, RECORDS);
+}
+
+TEST_F(TestAsyncLog, OverflowDropsLowSeverityAndCountsIt) {
+    const auto path = testDir / "overflow.txt";
+    uint64_t accepted = 0;
+    uint64_t pushed = 0;
+    uint64_t droppedInfo = 0;
+    uint64_t droppedWarning = 0;
+    {
+        AsyncLog log(16);
+        ASSERT_TRUE(log.SetFile(path.string()));
+        // Yazıcının biçimlendirip diske yazmasından hızlı sel
+        for (int i = 0; i < 200000; ++i) {
+            const LogSeverity severity = i % 8 == 0 ? LogSeverity::Warning : LogSeverity::Info;
+            accepted += log.Push(severity, "kare çözülemedi, tekrar deneniyor") ? 1 : 0;
+            ++pushed;
+        }
+        log.Flush();
+        droppedInfo = log.GetDroppedCount(LogSeverity::Info);
+        droppedWarning = log.GetDroppedCount(LogSeverity::Warning);
+        EXPECT_EQ(accepted + log.GetDroppedCount(), pushed);
+        EXPECT_EQ(log.GetWrittenCount(), accepted);
+    }
+
+    EXPECT_GT(droppedInfo, 0u);
+    // Ayrılmış hücreler sayesinde uyarılar orantısal olarak çok daha az düşer
+    EXPECT_LT(static_cast<double>(droppedWarning) / (pushed / 8),
+              static_cast<double>(droppedInfo) / (pushed - pushed / 8));
+
+    // Düşürülen kayıtlar dosyada da not edilir
+    uint64_t records = 0;
+    uint64_t reported = 0;
+    for (const auto& line : ReadLines(path)) {
+        if (line.find("düşürüldü") != std::string::npos) {
+            reported += std::stoull(MessageOf(line));
+        } else {
+            ++records;
+        }
+    }
+    EXPECT_EQ(records, accepted);
+    EXPECT_EQ(reported, droppedInfo + droppedWarning);
+}
+
+TEST_F(TestAsyncLog, ErrorIsFlushedWithoutWaitingForInterval) {
+    const auto path = testDir / "flush.txt";
+    AsyncLog log;
+    ASSERT_TRUE(log.SetFile(path.string()));
+    log.Push(LogSeverity::Info, "önce bilgi");
+    log.Push(LogSeverity::Error, "sonra hata");
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::string> lines;
+    while (lines.size() < 2 && std::chrono::steady_clock::now() - start < std::chrono::seconds(2)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        lines = ReadLines(path);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_LT(elapsed, std::chrono::milliseconds(AsyncLog::FLUSH_INTERVAL_MS));
+    EXPECT_NE(lines[0].find("[INFO] önce bilgi"), std::string::npos);
+    EXPECT_NE(lines[1].find("[ERROR] sonra hata"), std::string::npos);
+}
+
+TEST_F(TestAsyncLog, PushNeverAllocates) {
+    AsyncLog log;
+    const std::string longMessage(AsyncLog::MAX_MESSAGE_BYTES * 2, 'x');
+    {
+        AllocationCounter counter;
+        for (int i = 0; i < 1000; ++i) {
+            log.Push(i % 2 ? LogSeverity::Debug : LogSeverity::Error, longMessage);
+        }
+        EXPECT_EQ(counter.GetCount(), 0u) << counter.Describe();
+    }
+
+    // Uzun mesajlar hücreye sığacak kadar kırpılır ve işaretlenir
+    const auto path = testDir / "truncate.txt";
+    ASSERT_TRUE(log.SetFile(path.string()));
+    log.Push(LogSeverity::Info, longMessage);
+    log.Flush();
+    const auto lines = ReadLines(path);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(MessageOf(lines[0]), longMessage.substr(0, AsyncLog::MAX_MESSAGE_BYTES - 3) + "…");
+}
+
+TEST_F(TestAsyncLog, TruncationKeepsUtf8CharactersWhole) {
+    AsyncLog log;
+    const auto path = testDir / "utf8.txt";
+    ASSERT_TRUE(log.SetFile(path.string()));
+
+    // "ş" iki bayt: kesim noktası bir karakterin ortasına düşer
+    std::string turkish;
+    while (turkish.size() < AsyncLog::MAX_MESSAGE_BYTES * 2) turkish += "ş";
+    log.Push(LogSeverity::Info, turkish);
+    // Tam sığan mesaj olduğu gibi kalır
+    log.Push(LogSeverity::Info, turkish.substr(0, AsyncLog::MAX_MESSAGE_BYTES));
+    log.Flush();
+
+    const auto lines = ReadLines(path);
+    ASSERT_EQ(lines.size(), 2u);
+    const std::string cut = MessageOf(lines[0]);
+    ASSERT_GE(cut.size(), 3u);
+    EXPECT_EQ(cut.substr(cut.size() - 3), "…");
+    const std::string kept = cut.substr(0, cut.size() - 3);
+    EXPECT_EQ(kept.size() % 2, 0u);
+    EXPECT_EQ(kept, turkish.substr(0, kept.size()));
+    EXPECT_LE(cut.size(), AsyncLog::MAX_MESSAGE_BYTES);
+    EXPECT_EQ(MessageOf(lines[1]), turkish.substr(0, AsyncLog::MAX_MESSAGE_BYTES));
+}
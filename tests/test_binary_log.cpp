@@ -0,0 +1,158 @@
+// tests/test_binary_log.cpp
+#include "../Headers/BinaryLog.h"
+#include "../Headers/AllocationCounter.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class TestBinaryLog : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_binary_log_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+
+    static std::string ReadFile(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    // Zaman damgasını atıp "[SEVİYE] mesaj" bırakır
+    static std::vector<std::string> StripTimestamps(const std::string& text) {
+        std::vector<std::string> lines;
+        std::istringstream stream(text);
+        for (std::string line; std::getline(stream, line);) lines.push_back(line.substr(line.find("] [") + 2));
+        return lines;
+    }
+
+    static std::string Decode(const std::filesystem::path& path, bool* ok = nullptr) {
+        std::ifstream in(path, std::ios::binary);
+        std::ostringstream out;
+        const bool decoded = BinaryLog::Decode(in, out);
+        if (ok) *ok = decoded;
+        return out.str();
+    }
+};
+
+TEST_F(TestBinaryLog, RendersEncodedArgumentsInPlace) {
+    static const BinaryLog::Format format("{} kare, {} ms, gecikme {}, {}: {} ({})");
+    BinaryLog::Encoder encoder;
+    encoder.Put(-5);
+    encoder.Put(42u);
+    encoder.Put(1.5);
+    encoder.Put("dosya");
+    encoder.Put(std::wstring(L"C:\\Videolar\\Ağaç ışığı.mp4"));
+    encoder.Put(true);
+
+    std::string text;
+    BinaryLog::Render(format.GetText(), encoder.GetData(), encoder.GetLength(), text);
+    EXPECT_EQ(text, "-5 kare, 42 ms, gecikme 1.5, dosya: C:\\Videolar\\Ağaç ışığı.mp4 (1)");
+    EXPECT_STREQ(BinaryLog::GetFormat(format.GetId()), format.GetText());
+
+    // Eksik argüman boş kalır, fazlası yok sayılır
+    text.clear();
+    BinaryLog::Render("{} ve {}", encoder.GetData(), 2, text);
+    EXPECT_EQ(text, "-5 ve ");
+}
+
+TEST_F(TestBinaryLog, LongStringsAreTruncatedToRecord) {
+    const std::string longText(BinaryLog::MAX_PAYLOAD_BYTES * 2, 'x');
+    BinaryLog::Encoder encoder;
+    encoder.Put(7);
+    encoder.Put(longText);
+    EXPECT_LE(encoder.GetLength(), BinaryLog::MAX_PAYLOAD_BYTES);
+
+    std::string text;
+    BinaryLog::Render("{} {}", encoder.GetData(), encoder.GetLength(), text);
+    EXPECT_EQ(text.substr(0, 2), "7 ");
+    EXPECT_EQ(text.size(), 2 + BinaryLog::MAX_PAYLOAD_BYTES - 4);
+}
+
+TEST_F(TestBinaryLog, LongUtf8StringsAreCutOnCharacterBoundary) {
+    std::string longText = "a";
+    for (int i = 0; i < 200; ++i) longText += "ş";   // Sınır ikinci baytına düşer
+    BinaryLog::Encoder encoder;
+    encoder.Put(longText);
+    EXPECT_LE(encoder.GetLength(), BinaryLog::MAX_PAYLOAD_BYTES);
+
+    std::string text;
+    BinaryLog::Render("{}", encoder.GetData(), encoder.GetLength(), text);
+    EXPECT_EQ(text.size() % 2, 1u);
+    EXPECT_EQ(text, longText.substr(0, text.size()));
+}
+
+TEST_F(TestBinaryLog, DecodedBinaryFileMatchesTextFileAndIsSmaller) {
+    static const BinaryLog::Format frameFormat("Kare buffer'ı: {}/{} frame ({})");
+    static const BinaryLog::Format errorFormat("Video işleme hatası: {}");
+    const auto textPath = testDir / "log.txt";
+    const auto binaryPath = testDir / "log.lmlog";
+    {
+        AsyncLog text;
+        AsyncLog binary;
+        ASSERT_TRUE(text.SetFile(textPath.string(), AsyncLog::Encoding::Text));
+        ASSERT_TRUE(binary.SetFile(binaryPath.string(), AsyncLog::Encoding::Binary));
+        for (AsyncLog* log : { &text, &binary }) {
+            for (int i = 0; i < 200; ++i) {
+                BinaryLog::Write(*log, LogSeverity::Debug, frameFormat, i % 8, 8, "Normal");
+            }
+            log->Push(LogSeverity::Info, "düz metin kaydı");
+            BinaryLog::Write(*log, LogSeverity::Error, errorFormat, std::string("bad_alloc"));
+            log->Flush();
+        }
+    }
+
+    bool ok = false;
+    const std::string decoded = Decode(binaryPath, &ok);
+    EXPECT_TRUE(ok);
+    const auto lines = StripTimestamps(decoded);
+    EXPECT_EQ(lines, StripTimestamps(ReadFile(textPath)));
+    ASSERT_EQ(lines.size(), 202u);
+    EXPECT_EQ(lines[3], "[DEBUG] Kare buffer'ı: 3/8 frame (Normal)");
+    EXPECT_EQ(lines[201], "[ERROR] Video işleme hatası: bad_alloc");
+
+    EXPECT_LT(std::filesystem::file_size(binaryPath) * 2, std::filesystem::file_size(textPath));
+}
+
+TEST_F(TestBinaryLog, AppendedAndTruncatedFilesDecode) {
+    static const BinaryLog::Format format("Thumbnail {} hazır");
+    const auto path = testDir / "append.lmlog";
+    for (int run = 0; run < 2; ++run) {
+        // Her oturum dosyanın sonuna ekler; biçim tanımları yeniden yazılır
+        AsyncLog log;
+        ASSERT_TRUE(log.SetFile(path.string(), AsyncLog::Encoding::Binary));
+        BinaryLog::Write(log, LogSeverity::Info, format, run);
+    }
+    bool ok = false;
+    auto lines = StripTimestamps(Decode(path, &ok));
+    EXPECT_TRUE(ok);
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "[INFO] Thumbnail 0 hazır");
+    EXPECT_EQ(lines[1], "[INFO] Thumbnail 1 hazır");
+
+    // Çökme sonrası yarım kalan son kayıt: okunabilen kısım yine çıkar
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+    lines = StripTimestamps(Decode(path, &ok));
+    EXPECT_FALSE(ok);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], "[INFO] Thumbnail 0 hazır");
+}
+
+TEST_F(TestBinaryLog, WriteDoesNotAllocateOrFormat) {
+    static const BinaryLog::Format format("Video başarıyla yüklendi: {} ({} MB)");
+    const std::wstring path = L"C:\\Users\\Kullanıcı\\Videos\\orman_8k.mp4";
+    AsyncLog log;
+    AllocationCounter counter;
+    for (int i = 0; i < 1000; ++i) BinaryLog::Write(log, LogSeverity::Info, format, path, 183.5);
+    EXPECT_EQ(counter.GetCount(), 0u) << counter.Describe();
+}
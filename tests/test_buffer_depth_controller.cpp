@@ -0,0 +1,135 @@
+// tests/test_buffer_depth_controller.cpp
+#include "../Headers/BufferDepthController.h"
+#include <gtest/gtest.h>
+#include <functional>
+#include <random>
+#include <vector>
+
+class TestBufferDepthController : public ::testing::Test {
+protected:
+    static constexpr double FRAME_30FPS = 1000.0 / 30.0;
+
+    // Düzgün 720p: decode süresi kare aralığının çok altında
+    static std::vector<double> SmoothTrace(size_t count, unsigned seed) {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<double> jitter(6.0, 10.0);
+        std::vector<double> trace(count);
+        for (auto& decodeMs : trace) decodeMs = jitter(random);
+        return trace;
+    }
+
+    // Patlamalı 4K HEVC: ortalama aralığın altında ama her GOP başında
+    // birkaç kare aralığın iki katından uzun sürer
+    static std::vector<double> BurstyTrace(size_t count, unsigned seed, size_t gop, int burstFrames, double burstMs) {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<double> jitter(20.0, 28.0);
+        std::vector<double> trace(count);
+        for (size_t i = 0; i < count; ++i) {
+            trace[i] = (i % gop) < static_cast<size_t>(burstFrames) ? burstMs : jitter(random);
+        }
+        return trace;
+    }
+
+    // Decoder kuyrukta yer oldukça çalışır, ekran her aralıkta bir kare alır.
+    // Oynatma kuyruk ilk kez dolunca başlar. Kare zamanında hazır değilse
+    // underrun sayılır ve ekran kare gelince devam eder.
+    static int CountUnderruns(const std::vector<double>& trace, double interval,
+                              const std::function<int(size_t)>& depthBefore,
+                              const std::function<void(double)>& onDecoded = nullptr, size_t countFrom = 0) {
+        const size_t count = trace.size();
+        std::vector<double> ready(count), display(count);
+        const size_t preroll = static_cast<size_t>(depthBefore(0));
+
+        int underruns = 0;
+        double decoderFree = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            const size_t depth = static_cast<size_t>(depthBefore(i));
+            double start = decoderFree;
+            // Kuyruk dolu: i - depth karesi ekrana çıkıp yer açana kadar bekle
+            if (i >= preroll && i >= depth) start = std::max(start, display[i - depth]);
+            ready[i] = start + trace[i];
+            decoderFree = ready[i];
+            if (onDecoded) onDecoded(trace[i]);
+
+            if (i + 1 == preroll) {
+                for (size_t j = 0; j <= i; ++j) display[j] = ready[i] + j * interval;
+            } else if (i >= preroll) {
+                display[i] = display[i - 1] + interval;
+                if (ready[i] > display[i]) {
+                    if (i >= countFrom) ++underruns;
+                    display[i] = ready[i];
+                }
+            }
+        }
+        return underruns;
+    }
+
+    static int LearnDepth(const std::vector<double>& trace, double interval) {
+        BufferDepthController controller(interval);
+        for (double decodeMs : trace) controller.RecordDecode(decodeMs);
+        return controller.GetDepth();
+    }
+};
+
+TEST_F(TestBufferDepthController, SmoothClipStaysAtMinimumDepth) {
+    const auto trace = SmoothTrace(1000, 1);
+    const int depth = LearnDepth(trace, FRAME_30FPS);
+    EXPECT_EQ(depth, BufferDepthController::MIN_DEPTH);
+    EXPECT_EQ(CountUnderruns(trace, FRAME_30FPS, [&](size_t) { return depth; }), 0);
+}
+
+TEST_F(TestBufferDepthController, BurstyClipGetsJustEnoughDepth) {
+    struct Case { size_t gop; int burstFrames; double burstMs; };
+    for (const Case& c : { Case{ 48, 3, 70.0 }, Case{ 30, 1, 120.0 }, Case{ 60, 6, 45.0 } }) {
+        const auto trace = BurstyTrace(1500, 7, c.gop, c.burstFrames, c.burstMs);
+        const int depth = LearnDepth(trace, FRAME_30FPS);
+        SCOPED_TRACE(testing::Message() << "burst " << c.burstFrames << "x" << c.burstMs << " ms, depth " << depth);
+
+        EXPECT_GT(depth, BufferDepthController::MIN_DEPTH);
+        EXPECT_EQ(CountUnderruns(trace, FRAME_30FPS, [&](size_t) { return depth; }), 0);
+        // Bir kare eksik derinlik yetmemeli: fazladan bellek tutulmuyor
+        EXPECT_GT(CountUnderruns(trace, FRAME_30FPS, [&](size_t) { return depth - 1; }), 0);
+    }
+}
+
+TEST_F(TestBufferDepthController, AdaptsWhilePlaying) {
+    // Önce düzgün, sonra patlamalı içerik. İlk patlamalar pencerenin %1'inden az
+    // yer tuttuğu için 99. yüzdelik onları henüz kapsamaz; birkaç GOP sonra underrun olmamalı
+    auto trace = SmoothTrace(300, 3);
+    const auto bursty = BurstyTrace(1500, 4, 48, 3, 70.0);
+    trace.insert(trace.end(), bursty.begin(), bursty.end());
+
+    BufferDepthController controller(FRAME_30FPS);
+    const int underruns = CountUnderruns(
+        trace, FRAME_30FPS, [&](size_t) { return controller.GetDepth(); },
+        [&](double decodeMs) { controller.RecordDecode(decodeMs); }, 300 + 4 * 48);
+    EXPECT_EQ(underruns, 0);
+    EXPECT_EQ(controller.GetDepth(), LearnDepth(bursty, FRAME_30FPS));
+}
+
+TEST_F(TestBufferDepthController, MemoryCapLimitsDepthAndShrinkIsDelayed) {
+    BufferDepthController controller(FRAME_30FPS);
+    for (double decodeMs : BurstyTrace(600, 5, 48, 3, 70.0)) controller.RecordDecode(decodeMs);
+    const int target = controller.GetTargetDepth();
+    ASSERT_GT(target, 3);
+    EXPECT_GT(controller.GetStallPercentile(), FRAME_30FPS);
+
+    // Bütçe izin vermezse derinlik kırpılır, istenen derinlik korunur
+    controller.SetMemoryCap(3);
+    EXPECT_EQ(controller.GetDepth(), 3);
+    EXPECT_EQ(controller.GetTargetDepth(), target);
+    controller.SetMemoryCap(64);
+    EXPECT_EQ(controller.GetDepth(), target);
+
+    // Kısa sakinlik derinliği düşürmez, uzun sakinlik minimuma indirir
+    const auto smooth = SmoothTrace(2000, 6);
+    for (size_t i = 0; i < 100; ++i) controller.RecordDecode(smooth[i]);
+    EXPECT_EQ(controller.GetDepth(), target);
+    for (size_t i = 100; i < smooth.size(); ++i) controller.RecordDecode(smooth[i]);
+    EXPECT_EQ(controller.GetDepth(), BufferDepthController::MIN_DEPTH);
+
+    // Yeni video ölçümleri sıfırlar
+    controller.Reset(1000.0 / 60.0);
+    EXPECT_EQ(controller.GetDepth(), BufferDepthController::INITIAL_DEPTH);
+    EXPECT_DOUBLE_EQ(controller.GetFrameInterval(), 1000.0 / 60.0);
+}
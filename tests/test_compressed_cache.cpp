@@ -0,0 +1,143 @@
+// tests/test_compressed_cache.cpp
+#include "SyntheticVideo.h"
+#include "../Headers/CompressedCache.h"
+#include "../Headers/FastCompressor.h"
+#include <gtest/gtest.h>
+#include <random>
+
+class TestCompressedCache : public ::testing::Test {
+protected:
+    static std::vector<uint8_t> RoundTrip(const std::vector<uint8_t>& input, size_t& compressedSize) {
+        std::vector<uint8_t> compressed(FastCompressor::MaxCompressedSize(input.size()));
+        compressedSize = FastCompressor::Compress(input.data(), input.size(), compressed.data(), compressed.size());
+        std::vector<uint8_t> output(input.size());
+        EXPECT_TRUE(FastCompressor::Decompress(compressed.data(), compressedSize, output.data(), output.size()));
+        return output;
+    }
+
+    static std::vector<uint8_t> SyntheticFrame(int width, int height, double timestamp) {
+        SyntheticVideo video(width, height, 30.0, 10.0);
+        video.Render(timestamp);
+        return std::vector<uint8_t>(video.GetPixels(), video.GetPixels() + static_cast<size_t>(width) * height * 4);
+    }
+};
+
+TEST_F(TestCompressedCache, CompressorRoundTrips) {
+    std::mt19937 random(7);
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t size : { 0, 1, 5, 12, 13, 17, 64, 1000 }) {
+        std::vector<uint8_t> data(size);
+        for (auto& byte : data) byte = static_cast<uint8_t>(random() & 3);
+        inputs.push_back(data);
+    }
+    std::vector<uint8_t> noise(100000);
+    for (auto& byte : noise) byte = static_cast<uint8_t>(random());
+    inputs.push_back(noise);
+    inputs.push_back(std::vector<uint8_t>(300000, 0xAB));   // Uzun tekrar (örtüşen kopya)
+    std::vector<uint8_t> pattern(70000 * 3);
+    for (size_t i = 0; i < pattern.size(); ++i) pattern[i] = static_cast<uint8_t>(i % 3 * 40);
+    inputs.push_back(pattern);
+    inputs.push_back(SyntheticFrame(320, 180, 1.0));
+
+    for (const auto& input : inputs) {
+        size_t compressedSize = 0;
+        EXPECT_EQ(RoundTrip(input, compressedSize), input) << "size " << input.size();
+        EXPECT_LE(compressedSize, FastCompressor::MaxCompressedSize(input.size()));
+    }
+
+    size_t runSize = 0;
+    RoundTrip(inputs[inputs.size() - 3], runSize);
+    EXPECT_LT(runSize, 2000u);
+
+    size_t frameSize = 0;
+    RoundTrip(inputs.back(), frameSize);
+    EXPECT_LT(frameSize, inputs.back().size() / 3);
+}
+
+TEST_F(TestCompressedCache, CompressorRejectsCorruptInput) {
+    const auto frame = SyntheticFrame(160, 90, 0.5);
+    std::vector<uint8_t> compressed(FastCompressor::MaxCompressedSize(frame.size()));
+    const size_t size = FastCompressor::Compress(frame.data(), frame.size(), compressed.data(), compressed.size());
+    ASSERT_GT(size, 0u);
+
+    std::vector<uint8_t> output(frame.size());
+    EXPECT_FALSE(FastCompressor::Decompress(compressed.data(), size / 2, output.data(), output.size()));
+    EXPECT_FALSE(FastCompressor::Decompress(compressed.data(), size, output.data(), output.size() - 1));
+
+    // İlk eşleşmenin offset'i yazılmış veriden geriye taşıyor
+    const uint8_t badOffset[] = { 0x14, 'a', 0xFF, 0x00, 0x50, 'b', 'c', 'd', 'e', 'f' };
+    std::vector<uint8_t> small(64);
+    EXPECT_FALSE(FastCompressor::Decompress(badOffset, sizeof(badOffset), small.data(), 11));
+
+    // Sığmayan çıktı 0 döner
+    EXPECT_EQ(FastCompressor::Compress(frame.data(), frame.size(), compressed.data(), 100), 0u);
+}
+
+TEST_F(TestCompressedCache, ColdEntriesAreCompressedAndRestoredOnAccess) {
+    const size_t before = MemoryAccounting::GetCurrent(MemoryCategory::Thumbnails);
+    CompressedCache cache(MemoryCategory::Thumbnails, 64 * 1024 * 1024);
+
+    std::vector<std::vector<uint8_t>> frames;
+    for (int i = 0; i < 4; ++i) {
+        frames.push_back(SyntheticFrame(320, 180, i * 0.7));
+        cache.Put(L"frame" + std::to_wstring(i), frames.back(), 320, 180, 320 * 4);
+    }
+    const size_t raw = cache.GetRawBytes();
+    EXPECT_EQ(cache.GetResidentBytes(), raw);
+    EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Thumbnails), before + raw);
+
+    // Yeni erişilenler soğuk sayılmaz
+    EXPECT_EQ(cache.CompressCold(std::chrono::hours(1)), 0u);
+
+    const size_t saved = cache.CompressCold(std::chrono::milliseconds(0));
+    EXPECT_GT(saved, raw / 2);
+    EXPECT_EQ(cache.GetCompressedCount(), 4u);
+    EXPECT_EQ(cache.GetResidentBytes(), raw - saved);
+    EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Thumbnails), before + raw - saved);
+
+    CompressedCache::Item item;
+    ASSERT_TRUE(cache.Get(L"frame2", item));
+    EXPECT_EQ(*item.pixels, frames[2]);
+    EXPECT_EQ(item.width, 320);
+    EXPECT_EQ(cache.GetCompressedCount(), 3u);
+
+    const auto stats = cache.GetStats();
+    EXPECT_EQ(stats.compressions, 4u);
+    EXPECT_EQ(stats.decompressions, 1u);
+    EXPECT_GT(stats.GetRatio(), 2.0);
+
+    // Sıkıştırılamayan veri ham bırakılır
+    std::mt19937 random(3);
+    std::vector<uint8_t> noise(64 * 1024);
+    for (auto& byte : noise) byte = static_cast<uint8_t>(random());
+    cache.Put(L"noise", noise, 128, 128, 512);
+    cache.CompressCold(std::chrono::milliseconds(0));
+    ASSERT_TRUE(cache.Get(L"noise", item));
+    EXPECT_EQ(cache.GetStats().compressions, 5u);   // Sadece açılan frame2 tekrar; gürültü ham kalır
+}
+
+TEST_F(TestCompressedCache, BrokerPressureCompressesBeforeEvicting) {
+    MemoryBudgetBroker broker(100 * 1024 * 1024);
+    const size_t frameBytes = 640 * 360 * 4;
+    CompressedCache cache(MemoryCategory::ImageCache, 8 * frameBytes);
+    cache.AttachToBroker(broker, "Images", 1, 2 * frameBytes);
+
+    for (int i = 0; i < 8; ++i) {
+        cache.Put(L"image" + std::to_wstring(i), SyntheticFrame(640, 360, i * 0.3), 640, 360, 640 * 4);
+    }
+    ASSERT_EQ(cache.GetEntryCount(), 8u);
+
+    // Kritik baskı: bütçe minimuma (2 kare) iner ama sekizi de sıkıştırılmış halde sığar
+    broker.SetExternalPressure(MemoryPressure::Critical);
+    EXPECT_EQ(cache.GetEntryCount(), 8u);
+    EXPECT_EQ(cache.GetCompressedCount(), 8u);
+    EXPECT_LE(cache.GetResidentBytes(), 2 * frameBytes);
+
+    // Sıkıştırma bile yetmezse en eskiler atılır
+    broker.UpdateDemand(1, 0, 8 * frameBytes);
+    broker.SetTotalBudget(cache.GetResidentBytes() / 2);
+    EXPECT_LT(cache.GetEntryCount(), 8u);
+    CompressedCache::Item item;
+    EXPECT_TRUE(cache.Get(L"image7", item));
+    EXPECT_FALSE(cache.Get(L"image0", item));
+}
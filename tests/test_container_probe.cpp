@@ -0,0 +1,140 @@
+// tests/test_container_probe.cpp
+#include "SyntheticMedia.h"
+#include "../Headers/ContainerProbe.h"
+#include <gtest/gtest.h>
+
+class TestContainerProbe : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_probe_test";
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+};
+
+TEST_F(TestContainerProbe, Mp4Hevc10Bit) {
+    // moov dosya sonunda, 10-bit HEVC, BT.2020
+    auto path = testDir / "clip.mp4";
+    SyntheticMedia::WriteFile(path, SyntheticMedia::BuildMp4(3840, 2160, 300, 60000, 1001, 10, true, 1 << 20));
+
+    ContainerProbe::Result result;
+    ASSERT_TRUE(ContainerProbe::Probe(path, result));
+    EXPECT_EQ(result.container, ContainerProbe::Container::MP4);
+    EXPECT_EQ(result.codec, "HEVC");
+    EXPECT_EQ(result.width, 3840);
+    EXPECT_EQ(result.height, 2160);
+    EXPECT_NEAR(result.fps, 59.94, 0.01);
+    EXPECT_NEAR(result.duration, 300 * 1001 / 60000.0, 0.001);
+    EXPECT_EQ(result.bitDepth, 10);
+    EXPECT_EQ(result.colorSpace, "BT.2020");
+    EXPECT_EQ(result.frameCount, 300u);
+    EXPECT_EQ(result.keyframeCount, 10u);
+}
+
+TEST_F(TestContainerProbe, Mp4H264DefaultsColorSpace) {
+    auto path = testDir / "clip.mp4";
+    SyntheticMedia::WriteFile(path, SyntheticMedia::BuildMp4(1280, 720, 250, 25, 1, 5, false));
+
+    ContainerProbe::Result result;
+    ASSERT_TRUE(ContainerProbe::Probe(path, result));
+    EXPECT_EQ(result.codec, "H.264");
+    EXPECT_DOUBLE_EQ(result.fps, 25.0);
+    EXPECT_EQ(result.bitDepth, 8);
+    EXPECT_EQ(result.colorSpace, "BT.709");
+    EXPECT_EQ(result.keyframeCount, 5u);
+}
+
+TEST_F(TestContainerProbe, WebmVp9WithCuesAtEnd) {
+    auto path = testDir / "clip.webm";
+    SyntheticMedia::WriteFile(path, SyntheticMedia::BuildWebm(1920, 1080, 12.5, 41666667, 7, 10, 9));
+
+    ContainerProbe::Result result;
+    ASSERT_TRUE(ContainerProbe::Probe(path, result));
+    EXPECT_EQ(result.container, ContainerProbe::Container::WebM);
+    EXPECT_EQ(result.codec, "VP9");
+    EXPECT_EQ(result.width, 1920);
+    EXPECT_EQ(result.height, 1080);
+    EXPECT_NEAR(result.fps, 24.0, 0.001);
+    EXPECT_NEAR(result.duration, 12.5, 0.001);
+    EXPECT_EQ(result.bitDepth, 10);
+    EXPECT_EQ(result.colorSpace, "BT.2020");
+    EXPECT_EQ(result.keyframeCount, 7u);   // Ses izine ait cue sayılmaz
+}
+
+TEST_F(TestContainerProbe, AviWithIndex) {
+    auto path = testDir / "clip.avi";
+    SyntheticMedia::WriteFile(path, SyntheticMedia::BuildAvi(640, 480, 30000, 1001, 90, 30, "XVID"));
+
+    ContainerProbe::Result result;
+    ASSERT_TRUE(ContainerProbe::Probe(path, result));
+    EXPECT_EQ(result.container, ContainerProbe::Container::AVI);
+    EXPECT_EQ(result.codec, "MPEG-4 Part 2");
+    EXPECT_EQ(result.width, 640);
+    EXPECT_EQ(result.height, 480);
+    EXPECT_NEAR(result.fps, 29.97, 0.01);
+    EXPECT_EQ(result.frameCount, 90u);
+    EXPECT_EQ(result.keyframeCount, 3u);
+    EXPECT_EQ(result.colorSpace, "BT.601");
+}
+
+TEST_F(TestContainerProbe, RejectsGarbageAndTruncatedFiles) {
+    auto garbage = testDir / "garbage.mp4";
+    SyntheticMedia::WriteFile(garbage, SyntheticMedia::Bytes(4096, 0x5A));
+    ContainerProbe::Result result;
+    EXPECT_FALSE(ContainerProbe::Probe(garbage, result));
+
+    // moov ortadan kesilmiş dosya
+    auto bytes = SyntheticMedia::BuildMp4(1280, 720, 250, 25, 1, 5, false);
+    bytes.resize(bytes.size() - 40);
+    auto truncated = testDir / "truncated.mp4";
+    SyntheticMedia::WriteFile(truncated, bytes);
+    EXPECT_FALSE(ContainerProbe::Probe(truncated, result));
+
+    EXPECT_FALSE(ContainerProbe::Probe(testDir / "missing.mkv", result));
+}
+
+TEST_F(TestContainerProbe, RejectsWrappingLargeBoxSizes) {
+    const auto valid = SyntheticMedia::BuildMp4(1280, 720, 250, 25, 1, 5, false);
+    const size_t moovStart = std::string(valid.begin(), valid.end()).rfind("moov") - 4;
+    const SyntheticMedia::Bytes moov(valid.begin() + moovStart, valid.end());
+
+    auto be32 = [](SyntheticMedia::Bytes& out, uint32_t value) {
+        for (int shift = 24; shift >= 0; shift -= 8) out.push_back(static_cast<uint8_t>(value >> shift));
+    };
+    // ftyp'in içine gizlenmiş bir moov ve ardından largesize'lı bir kutu:
+    // offset + boxSize taşarsa ayrıştırıcı geri sarılıp gizli moov'u okur
+    auto build = [&](uint64_t largeSize) {
+        SyntheticMedia::Bytes bytes;
+        be32(bytes, static_cast<uint32_t>(16 + moov.size()));
+        for (char c : std::string("ftypisom")) bytes.push_back(static_cast<uint8_t>(c));
+        be32(bytes, 0);
+        bytes.insert(bytes.end(), moov.begin(), moov.end());
+        be32(bytes, 1);
+        for (char c : std::string("free")) bytes.push_back(static_cast<uint8_t>(c));
+        be32(bytes, static_cast<uint32_t>(largeSize >> 32));
+        be32(bytes, static_cast<uint32_t>(largeSize));
+        bytes.resize(bytes.size() + 64, 0);
+        return bytes;
+    };
+
+    const auto path = testDir / "wrap.mp4";
+    const uint64_t wrapToMoov = 0 - static_cast<uint64_t>(moov.size());
+    for (uint64_t largeSize : { UINT64_MAX, UINT64_MAX - 7, wrapToMoov, uint64_t(1) << 63, uint64_t(16) << 32 }) {
+        SyntheticMedia::WriteFile(path, build(largeSize));
+        ContainerProbe::Result result;
+        EXPECT_FALSE(ContainerProbe::Probe(path, result)) << std::hex << largeSize;
+    }
+}
+
+TEST_F(TestContainerProbe, ProbeableExtensions) {
+    EXPECT_TRUE(ContainerProbe::IsProbeableExtension("a/B.MP4"));
+    EXPECT_TRUE(ContainerProbe::IsProbeableExtension("clip.webm"));
+    EXPECT_FALSE(ContainerProbe::IsProbeableExtension("clip.wmv"));
+    EXPECT_FALSE(ContainerProbe::IsProbeableExtension("image.png"));
+}
@@ -0,0 +1,209 @@
+// tests/test_directory_watcher.cpp
+#include "SyntheticMedia.h"
+#include "../Headers/DirectoryWatcher.h"
+#include "../Headers/MediaLibrary.h"
+#include "../Headers/ThumbnailQueue.h"
+#include <gtest/gtest.h>
+#include <condition_variable>
+
+using ChangeType = DirectoryWatcher::ChangeType;
+
+TEST(TestChangeCoalescer, CollapsesBursts) {
+    DirectoryWatcher::Coalescer coalescer;
+    coalescer.Add(ChangeType::Added, "/w/a.mp4");
+    for (int i = 0; i < 50; ++i) coalescer.Add(ChangeType::Modified, "/w/a.mp4");
+    coalescer.Add(ChangeType::Added, "/w/tmp.mp4");
+    coalescer.Add(ChangeType::Removed, "/w/tmp.mp4");       // Geçici dosya: iz bırakmaz
+    coalescer.Add(ChangeType::Removed, "/w/b.mp4");
+    coalescer.Add(ChangeType::Added, "/w/b.mp4");           // Sil + oluştur = değişti
+
+    auto changes = coalescer.Take();
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].type, ChangeType::Added);
+    EXPECT_EQ(changes[0].path, "/w/a.mp4");
+    EXPECT_EQ(changes[1].type, ChangeType::Modified);
+    EXPECT_EQ(changes[1].path, "/w/b.mp4");
+    EXPECT_TRUE(coalescer.Empty());
+}
+
+TEST(TestChangeCoalescer, ChainsRenames) {
+    DirectoryWatcher::Coalescer coalescer;
+    coalescer.Add(ChangeType::Renamed, "/w/b.mp4", "/w/a.mp4");
+    coalescer.Add(ChangeType::Renamed, "/w/c.mp4", "/w/b.mp4");
+    coalescer.Add(ChangeType::Added, "/w/x.part");
+    coalescer.Add(ChangeType::Renamed, "/w/x.mp4", "/w/x.part");
+
+    auto changes = coalescer.Take();
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].type, ChangeType::Renamed);
+    EXPECT_EQ(changes[0].oldPath, "/w/a.mp4");
+    EXPECT_EQ(changes[0].path, "/w/c.mp4");
+    EXPECT_EQ(changes[1].type, ChangeType::Added);
+    EXPECT_EQ(changes[1].path, "/w/x.mp4");
+}
+
+class TestDirectoryWatcher : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<std::vector<DirectoryWatcher::Change>> batches;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_watch_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+
+    DirectoryWatcher::ChangeCallback Collector() {
+        return [this](const std::vector<DirectoryWatcher::Change>& changes) {
+            std::lock_guard<std::mutex> lock(mutex);
+            batches.push_back(changes);
+            condition.notify_all();
+        };
+    }
+
+    bool WaitForBatches(size_t count) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return condition.wait_for(lock, std::chrono::seconds(5), [&]() { return batches.size() >= count; });
+    }
+};
+
+TEST_F(TestDirectoryWatcher, DebouncedBurstBecomesOneBatch) {
+    DirectoryWatcher watcher;
+    ASSERT_TRUE(watcher.Start(testDir, Collector(), std::chrono::milliseconds(100)));
+
+    const auto mp4 = SyntheticMedia::BuildMp4(1280, 720, 250, 25, 1, 5, false);
+    for (int i = 0; i < 20; ++i) {
+        SyntheticMedia::WriteFile(testDir / "a.mp4", mp4);   // Aynı dosyaya tekrar tekrar yaz
+    }
+    SyntheticMedia::WriteFile(testDir / "b.mp4", mp4);
+
+    ASSERT_TRUE(WaitForBatches(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    watcher.Stop();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(batches.size(), 1u);
+    ASSERT_EQ(batches[0].size(), 2u);
+    EXPECT_EQ(batches[0][0].type, ChangeType::Added);
+    EXPECT_EQ(batches[0][0].path.filename(), "a.mp4");
+    EXPECT_EQ(batches[0][1].path.filename(), "b.mp4");
+}
+
+TEST_F(TestDirectoryWatcher, LibraryAndThumbnailsFollowChanges) {
+    const auto mp4 = SyntheticMedia::BuildMp4(1280, 720, 250, 25, 1, 5, false);
+    SyntheticMedia::WriteFile(testDir / "keep.mp4", mp4);
+    SyntheticMedia::WriteFile(testDir / "old.mp4", mp4);
+    SyntheticMedia::WriteFile(testDir / "gone.mp4", mp4);
+
+    MediaLibrary library;
+    library.Rescan(testDir);
+    ASSERT_TRUE(library.SetThumbnail(testDir / "old.mp4", testDir / "old.jpg"));
+
+    std::atomic<int> generated(0);
+    ThumbnailQueue thumbnails([&](const std::filesystem::path& video, std::filesystem::path& thumbnail) {
+        thumbnail = video;
+        thumbnail.replace_extension(".jpg");
+        ++generated;
+        return true;
+    }, &library);
+
+    DirectoryWatcher watcher;
+    ASSERT_TRUE(watcher.Start(testDir, [&](const std::vector<DirectoryWatcher::Change>& changes) {
+        thumbnails.Apply(library.ApplyChanges(changes));
+        Collector()(changes);
+    }, std::chrono::milliseconds(100)));
+
+    std::filesystem::rename(testDir / "old.mp4", testDir / "new.mp4");
+    std::filesystem::remove(testDir / "gone.mp4");
+    SyntheticMedia::WriteFile(testDir / "fresh.mp4", mp4);
+    SyntheticMedia::WriteFile(testDir / "notes.txt", { 'x' });
+
+    ASSERT_TRUE(WaitForBatches(1));
+    ASSERT_TRUE(thumbnails.WaitUntilIdle(std::chrono::seconds(5)));
+    watcher.Stop();
+
+    EXPECT_EQ(library.GetEntryCount(), 3u);
+    MediaLibrary::Entry entry;
+    ASSERT_TRUE(library.GetEntry(testDir / "new.mp4", entry));
+    EXPECT_EQ(entry.thumbnailPath, testDir / "old.jpg");       // Yeniden adlandırma thumbnail'i korur
+    EXPECT_FALSE(library.GetEntry(testDir / "gone.mp4", entry));
+    ASSERT_TRUE(library.GetEntry(testDir / "fresh.mp4", entry));
+    EXPECT_TRUE(entry.probed);
+    EXPECT_EQ(entry.thumbnailPath, testDir / "fresh.jpg");
+    EXPECT_EQ(generated.load(), 1);                              // Sadece yeni dosya için üretildi
+}
+
+TEST_F(TestDirectoryWatcher, RescanEnqueuesOnlyThatFolder) {
+    const auto mp4 = SyntheticMedia::BuildMp4(1280, 720, 250, 25, 1, 5, false);
+    std::filesystem::create_directories(testDir / "a");
+    std::filesystem::create_directories(testDir / "b");
+    SyntheticMedia::WriteFile(testDir / "a" / "1.mp4", mp4);
+    SyntheticMedia::WriteFile(testDir / "a" / "2.mp4", mp4);
+    SyntheticMedia::WriteFile(testDir / "b" / "3.mp4", mp4);
+
+    MediaLibrary library;
+    library.Rescan(testDir / "a");
+    library.Rescan(testDir / "b");
+    ASSERT_EQ(library.GetEntryCount(), 3u);
+
+    std::mutex generatedMutex;
+    std::vector<std::filesystem::path> generated;
+    ThumbnailQueue thumbnails([&](const std::filesystem::path& video, std::filesystem::path& thumbnail) {
+        thumbnail = video;
+        thumbnail.replace_extension(".jpg");
+        std::lock_guard<std::mutex> lock(generatedMutex);
+        generated.push_back(video);
+        return true;
+    }, &library);
+
+    // Sondaki ayırıcı kapsamı değiştirmez
+    thumbnails.Apply({ { MediaLibrary::Update::Kind::Rescanned, testDir / "a" / "", {} } });
+    ASSERT_TRUE(thumbnails.WaitUntilIdle(std::chrono::seconds(5)));
+
+    std::lock_guard<std::mutex> lock(generatedMutex);
+    ASSERT_EQ(generated.size(), 2u);
+    for (const auto& video : generated) EXPECT_EQ(video.parent_path(), testDir / "a");
+    MediaLibrary::Entry entry;
+    ASSERT_TRUE(library.GetEntry(testDir / "b" / "3.mp4", entry));
+    EXPECT_TRUE(entry.thumbnailPath.empty());
+}
+
+TEST_F(TestDirectoryWatcher, ReportsLostDirectoryAndStops) {
+    const auto watched = testDir / "klasor";
+    std::filesystem::create_directories(watched);
+    const auto mp4 = SyntheticMedia::BuildMp4(1280, 720, 250, 25, 1, 5, false);
+    SyntheticMedia::WriteFile(watched / "a.mp4", mp4);
+    SyntheticMedia::WriteFile(testDir / "outside.mp4", mp4);
+
+    MediaLibrary library;
+    library.Rescan(watched);
+    library.Rescan(testDir);
+    ASSERT_EQ(library.GetEntryCount(), 2u);
+
+    DirectoryWatcher watcher;
+    ASSERT_TRUE(watcher.Start(watched, [&](const std::vector<DirectoryWatcher::Change>& changes) {
+        library.ApplyChanges(changes);
+        Collector()(changes);
+    }, std::chrono::milliseconds(100)));
+
+    std::filesystem::remove_all(watched);
+    ASSERT_TRUE(WaitForBatches(1));
+    for (int i = 0; i < 100 && watcher.IsRunning(); ++i) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(watcher.IsRunning());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_FALSE(batches.empty());
+    const auto& last = batches.back().back();
+    EXPECT_EQ(last.type, ChangeType::Removed);
+    EXPECT_EQ(last.path, watched);
+    MediaLibrary::Entry entry;
+    EXPECT_FALSE(library.GetEntry(watched / "a.mp4", entry));
+    EXPECT_TRUE(library.GetEntry(testDir / "outside.mp4", entry));
+}
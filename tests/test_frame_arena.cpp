@@ -0,0 +1,93 @@
+// tests/test_frame_arena.cpp
+#include "../Headers/FrameArena.h"
+#include "../Headers/AllocationCounter.h"
+#include "../Headers/AnimatedPreview.h"
+#include <gtest/gtest.h>
+#include <cstring>
+
+class TestFrameArena : public ::testing::Test {
+protected:
+    static bool IsAligned(const void* pointer, size_t alignment) {
+        return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+    }
+};
+
+TEST_F(TestFrameArena, AllocatesAlignedAndRewindsAtScopeEnd) {
+    FrameArena arena(4096);
+    {
+        FrameArena::Scope frame(arena);
+        void* a = arena.Allocate(3, 1);
+        void* b = arena.Allocate(8, 64);
+        double* c = arena.AllocateArray<double>(4);
+        EXPECT_TRUE(IsAligned(b, 64));
+        EXPECT_TRUE(IsAligned(c, alignof(double)));
+        EXPECT_NE(a, b);
+        const size_t used = arena.GetUsedBytes();
+        EXPECT_GE(used, 3u + 8u + 32u);
+
+        {
+            // İç kapsam sadece kendi ayırmalarını geri alır
+            FrameArena::Scope inner(arena);
+            arena.Allocate(512);
+            EXPECT_GT(arena.GetUsedBytes(), used);
+        }
+        EXPECT_EQ(arena.GetUsedBytes(), used);
+    }
+    EXPECT_EQ(arena.GetUsedBytes(), 0u);
+    EXPECT_EQ(arena.GetCapacity(), 4096u);
+}
+
+TEST_F(TestFrameArena, OverflowBlocksCoalesceAtFrameBoundary) {
+    FrameArena arena(1024);
+    const size_t scratchBefore = MemoryAccounting::GetCurrent(MemoryCategory::Scratch);
+
+    // İlk kare bloğa sığmaz: taşma blokları eklenir
+    {
+        FrameArena::Scope frame(arena);
+        for (int i = 0; i < 10; ++i) std::memset(arena.Allocate(700), i, 700);
+    }
+    const uint64_t afterFirstFrame = arena.GetBlockAllocations();
+    EXPECT_GT(afterFirstFrame, 1u);
+    EXPECT_GE(arena.GetPeakBytes(), 7000u);
+
+    // Sonraki karelerde tek birleşik blok yeter, heap'e gidilmez
+    for (int frameIndex = 0; frameIndex < 100; ++frameIndex) {
+        FrameArena::Scope frame(arena);
+        for (int i = 0; i < 10; ++i) std::memset(arena.Allocate(700), i, 700);
+    }
+    EXPECT_EQ(arena.GetBlockAllocations(), afterFirstFrame + 1);
+    EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Scratch) - scratchBefore, arena.GetCapacity());
+}
+
+TEST_F(TestFrameArena, PmrContainersAllocateFromArena) {
+    FrameArena arena;
+    auto runFrame = [&arena](int seed) {
+        FrameArena::Scope frame(arena);
+        std::pmr::vector<uint16_t> row(&arena);
+        for (int i = 0; i < 1000; ++i) row.push_back(static_cast<uint16_t>(seed + i));
+        std::pmr::vector<std::pmr::vector<uint8_t>> tiles(&arena);
+        for (int i = 0; i < 50; ++i) tiles.emplace_back(64, static_cast<uint8_t>(i));
+        uint64_t sum = 0;
+        for (uint16_t value : row) sum += value;
+        for (const auto& tile : tiles) sum += tile[63];
+        return sum;
+    };
+
+    const uint64_t expected = runFrame(7);
+    AllocationCounter counter;
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(runFrame(7), expected);
+    EXPECT_EQ(counter.GetCount(), 0u) << counter.Describe();
+}
+
+TEST_F(TestFrameArena, PreviewScalerScratchDoesNotHitHeap) {
+    std::vector<uint8_t> source(640 * 360 * 4, 128);
+    const AnimatedPreview::Frame frame = { source.data(), 640, 360, 640 * 4, 0.0 };
+    std::vector<uint8_t> scaled;
+    AnimatedPreview::ScaleFrame(frame, 160, 90, scaled);   // Çıktı buffer'ı ve arena ısınır
+
+    AllocationCounter counter;
+    for (int i = 0; i < 50; ++i) AnimatedPreview::ScaleFrame(frame, 160, 90, scaled);
+    EXPECT_EQ(counter.GetCount(), 0u) << counter.Describe();
+    EXPECT_EQ(scaled[0], 128);
+    EXPECT_EQ(scaled[3], 255);
+}
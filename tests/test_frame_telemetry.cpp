@@ -0,0 +1,138 @@
+// tests/test_frame_telemetry.cpp
+#include "../Headers/FrameTelemetry.h"
+#include "../Headers/FramePipeline.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+class TestFrameTelemetry : public ::testing::Test {
+protected:
+    static constexpr double MAX_RELATIVE_ERROR = 1.0 / HdrHistogram::SUB_BUCKET_COUNT;
+
+    static uint64_t ExactPercentile(std::vector<uint64_t> values, double percentile) {
+        std::sort(values.begin(), values.end());
+        const size_t rank = std::max<size_t>(static_cast<size_t>(std::ceil(percentile / 100.0 * values.size())), 1);
+        return values[rank - 1];
+    }
+};
+
+TEST_F(TestFrameTelemetry, BucketsCoverEveryValueWithBoundedError) {
+    uint64_t previousIndex = 0;
+    for (uint64_t value = 0; value < 100000; value += 7) {
+        const size_t index = HdrHistogram::GetBucketIndex(value);
+        ASSERT_GE(index, previousIndex);
+        ASSERT_LE(HdrHistogram::GetBucketLowest(index), value);
+        ASSERT_GE(HdrHistogram::GetBucketHighest(index), value);
+        ASSERT_LE(HdrHistogram::GetBucketHighest(index) - HdrHistogram::GetBucketLowest(index),
+                  static_cast<uint64_t>(value * MAX_RELATIVE_ERROR));
+        previousIndex = index;
+    }
+    // Aralık dışı değerler son kovaya düşer
+    EXPECT_EQ(HdrHistogram::GetBucketIndex(HdrHistogram::MAX_VALUE), HdrHistogram::BUCKET_COUNT - 1);
+    EXPECT_EQ(HdrHistogram::GetBucketIndex(UINT64_MAX), HdrHistogram::BUCKET_COUNT - 1);
+}
+
+TEST_F(TestFrameTelemetry, PercentilesMatchExactWithinPrecision) {
+    // Decode süresine benzer: ~2 ms medyan, uzun kuyruk
+    std::mt19937_64 random(7);
+    std::lognormal_distribution<double> latency(std::log(2e6), 0.6);
+    std::vector<uint64_t> values;
+    HdrHistogram histogram;
+    for (int i = 0; i < 50000; ++i) {
+        values.push_back(static_cast<uint64_t>(latency(random)));
+        histogram.Record(values.back());
+    }
+
+    const HdrHistogram::Summary summary = histogram.Summarize();
+    EXPECT_EQ(summary.count, values.size());
+    EXPECT_EQ(summary.max, *std::max_element(values.begin(), values.end()));
+    for (const double percentile : { 50.0, 90.0, 99.0, 99.9 }) {
+        const double exact = static_cast<double>(ExactPercentile(values, percentile));
+        const double reported = static_cast<double>(histogram.GetValueAtPercentile(percentile));
+        EXPECT_GE(reported, exact) << percentile;
+        EXPECT_LE(reported, exact * (1.0 + MAX_RELATIVE_ERROR)) << percentile;
+    }
+    EXPECT_EQ(summary.p99, histogram.GetValueAtPercentile(99.0));
+
+    histogram.Reset();
+    EXPECT_EQ(histogram.Summarize().count, 0u);
+    EXPECT_EQ(histogram.GetValueAtPercentile(50.0), 0u);
+}
+
+TEST_F(TestFrameTelemetry, ConcurrentRecordersLoseNothing) {
+    constexpr int THREADS = 4;
+    constexpr int PER_THREAD = 100000;
+    FrameTelemetry telemetry;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&telemetry, t] {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                telemetry.RecordStage(FrameTelemetry::Stage::Decode, static_cast<uint64_t>(i + t));
+            }
+        });
+    }
+    // Okuyucu kayıt sırasında snapshot alabilir
+    const size_t decodeIndex = static_cast<size_t>(FrameTelemetry::Stage::Decode);
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_LE(telemetry.GetSnapshot().stages[decodeIndex].count, static_cast<uint64_t>(THREADS * PER_THREAD));
+    }
+    for (auto& thread : threads) thread.join();
+
+    const auto decode = telemetry.GetSnapshot().stages[decodeIndex];
+    EXPECT_EQ(decode.count, static_cast<uint64_t>(THREADS * PER_THREAD));
+    EXPECT_EQ(decode.max, static_cast<uint64_t>(PER_THREAD - 1 + THREADS - 1));
+}
+
+TEST_F(TestFrameTelemetry, PipelineRecordsStagesDepthAndDrops) {
+    constexpr double FRAME_INTERVAL = 5.0;
+    constexpr int FRAMES = 60;
+    constexpr int SLOW_EVERY = 10;
+    FramePipeline pipeline(FRAME_INTERVAL);
+    FrameTelemetry& telemetry = pipeline.GetTelemetry();
+
+    int decoded = 0;
+    uint32_t clockMs = 0;
+    pipeline.SetDecoder([&](FramePipeline::Frame& frame) {
+        FrameTelemetry::ScopedStage stage(&telemetry, FrameTelemetry::Stage::Decode);
+        // Her SLOW_EVERY karede bir decode kare aralığını aşar
+        if (++decoded % SLOW_EVERY == 0) {
+            std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(FRAME_INTERVAL * 2));
+        }
+        clockMs += static_cast<uint32_t>(FRAME_INTERVAL);
+        frame.timestampMs = clockMs;
+        return true;
+    });
+    pipeline.SetPresenter([](const FramePipeline::Frame&) {});
+
+    for (int i = 0; i < FRAMES; ++i) pipeline.Step();
+
+    FrameTelemetry::Snapshot snapshot = pipeline.GetTelemetry().GetSnapshot();
+    const auto& decode = snapshot.stages[static_cast<size_t>(FrameTelemetry::Stage::Decode)];
+    const auto& present = snapshot.stages[static_cast<size_t>(FrameTelemetry::Stage::Present)];
+    EXPECT_EQ(decode.count, static_cast<uint64_t>(FRAMES));
+    EXPECT_GE(decode.max, static_cast<uint64_t>(FRAME_INTERVAL * 2 * 1e6));
+    EXPECT_EQ(present.count, pipeline.GetPresentedCount());
+    EXPECT_EQ(snapshot.frame.count, static_cast<uint64_t>(FRAMES));
+    EXPECT_GE(snapshot.lateFrames, static_cast<uint64_t>(FRAMES / SLOW_EVERY));
+    EXPECT_EQ(snapshot.currentQueueDepth, static_cast<int>(pipeline.GetQueuedCount()));
+    EXPECT_EQ(snapshot.queueDepth.count, static_cast<uint64_t>(FRAMES));
+    EXPECT_LE(snapshot.queueDepth.max, static_cast<uint64_t>(FramePipeline::SLOT_COUNT));
+    EXPECT_EQ(snapshot.droppedFrames, 0u);
+
+    // Yaşlanan ve bütçeyle kırpılan kareler düşürülmüş sayılır
+    const size_t queued = pipeline.GetQueuedCount();
+    ASSERT_GT(queued, 1u);
+    pipeline.SetMemoryCap(1);
+    const size_t aged = pipeline.DropOlderThan(clockMs + 1000, 0);
+    EXPECT_EQ(pipeline.GetTelemetry().GetSnapshot().droppedFrames, static_cast<uint64_t>(queued));
+    EXPECT_EQ(aged, 1u);
+
+    pipeline.Reset(FRAME_INTERVAL);
+    snapshot = pipeline.GetTelemetry().GetSnapshot();
+    EXPECT_EQ(snapshot.frame.count, 0u);
+    EXPECT_EQ(snapshot.droppedFrames, 0u);
+}
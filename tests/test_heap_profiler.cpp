@@ -0,0 +1,162 @@
+// tests/test_heap_profiler.cpp
+#include "../Headers/HeapProfiler.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+// Çağrı yeri adıyla bulunabilsin diye global ve inline / klonlanmayan fonksiyonlar
+// (GCC'nin .constprop kopyaları dışa aktarılmaz, dladdr adını bulamaz)
+#if defined(_MSC_VER)
+#define TEST_NOINLINE __declspec(noinline)
+#elif defined(__clang__)
+#define TEST_NOINLINE __attribute__((noinline))
+#else
+#define TEST_NOINLINE __attribute__((noipa))
+#endif
+
+TEST_NOINLINE void HeapProfilerRetainingSite(char** blocks, int count, size_t size) {
+    for (int i = 0; i < count; ++i) blocks[i] = new char[size];
+}
+
+static char* volatile g_churnSink;   // new/delete çifti derleyici tarafından silinmesin
+
+TEST_NOINLINE void HeapProfilerChurningSite(int count, size_t size) {
+    for (int i = 0; i < count; ++i) {
+        char* block = new char[size];
+        g_churnSink = block;
+        delete[] block;
+    }
+}
+
+class TestHeapProfiler : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+#ifdef _WIN32
+        // Çağrı yerleri sembol adıyla doğrulanıyor; Windows çıktısı modül+offset verir
+        GTEST_SKIP() << "Sembol adları sadece Linux'ta (dladdr) çözülür";
+#endif
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_heap_test";
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        HeapProfiler::Stop();
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+
+    static const HeapProfiler::Site* FindSite(const std::vector<HeapProfiler::Site>& sites, const std::string& function) {
+        for (const auto& site : sites) {
+            if (!site.frames.empty() && site.frames.back().find(function) != std::string::npos) return &site;
+        }
+        return nullptr;
+    }
+    // Geçici vektöre işaretçi döndürmesin
+    static const HeapProfiler::Site* FindSite(std::vector<HeapProfiler::Site>&&, const std::string&) = delete;
+
+    static std::string ReadFile(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+};
+
+TEST_F(TestHeapProfiler, AttributesAllocationsToCallSites) {
+    char* blocks[100];
+    ASSERT_TRUE(HeapProfiler::Start(1));   // Her ayırma örneklenir
+    HeapProfilerRetainingSite(blocks, 100, 1000);
+    HeapProfilerChurningSite(50, 4000);
+    HeapProfiler::Stop();
+
+    const auto sites = HeapProfiler::GetTopSites(1000, HeapProfiler::Metric::AllocatedBytes);
+    // Yaprak çerçeve operator new değil, ayırmayı yapan fonksiyon olmalı
+    const auto* retaining = FindSite(sites, "HeapProfilerRetainingSite");
+    const auto* churning = FindSite(sites, "HeapProfilerChurningSite");
+    ASSERT_NE(retaining, nullptr);
+    ASSERT_NE(churning, nullptr);
+
+    EXPECT_EQ(retaining->allocCount, 100u);
+    EXPECT_EQ(retaining->allocBytes, 100000u);
+    EXPECT_EQ(retaining->inUseBytes, 100000u);
+    EXPECT_EQ(churning->allocBytes, 200000u);
+    EXPECT_EQ(churning->inUseBytes, 0u);
+    // Kök tarafında test fonksiyonu da görünür
+    bool hasCaller = false;
+    for (const auto& frame : retaining->frames) hasCaller |= frame.find("AttributesAllocationsToCallSites") != std::string::npos;
+    EXPECT_TRUE(hasCaller);
+
+    // Kullanımdaki bayta göre sıralamada churn eden yer geride kalır
+    const auto inUse = HeapProfiler::GetTopSites(1, HeapProfiler::Metric::InUseBytes);
+    ASSERT_EQ(inUse.size(), 1u);
+    EXPECT_NE(inUse[0].frames.back().find("HeapProfilerRetainingSite"), std::string::npos);
+
+    for (char* block : blocks) delete[] block;
+}
+
+TEST_F(TestHeapProfiler, SampledEstimatesMatchTotals) {
+    constexpr int COUNT = 20000;
+    constexpr size_t SIZE = 512;
+    auto blocks = std::make_unique<char*[]>(COUNT);
+
+    ASSERT_TRUE(HeapProfiler::Start(64 * 1024));
+    HeapProfilerRetainingSite(blocks.get(), COUNT, SIZE);
+    HeapProfiler::Stop();
+
+    // ~10 MB / 64 KB ≈ 160 örnek: tahmin %30 içinde olmalı
+    const auto sites = HeapProfiler::GetTopSites(1000);
+    const auto* site = FindSite(sites, "HeapProfilerRetainingSite");
+    ASSERT_NE(site, nullptr);
+    const double expected = static_cast<double>(COUNT) * SIZE;
+    EXPECT_NEAR(static_cast<double>(site->inUseBytes), expected, expected * 0.3);
+    EXPECT_LT(HeapProfiler::GetSampleCount(), 400u);
+
+    for (int i = 0; i < COUNT; ++i) delete[] blocks[i];
+}
+
+TEST_F(TestHeapProfiler, ExportsPprofAndCollapsedStacks) {
+    char* blocks[10];
+    ASSERT_TRUE(HeapProfiler::Start(1));
+    HeapProfilerRetainingSite(blocks, 10, 2048);
+    HeapProfiler::Stop();
+
+    const auto heapPath = testDir / "soak.heap";
+    const auto foldedPath = testDir / "soak.folded";
+    ASSERT_TRUE(HeapProfiler::WritePprof(heapPath.string()));
+    ASSERT_TRUE(HeapProfiler::WriteCollapsed(foldedPath.string()));
+
+    const std::string heap = ReadFile(heapPath);
+    EXPECT_EQ(heap.rfind("heap profile: ", 0), 0u);
+    EXPECT_NE(heap.find("@ heap_v2/1\n"), std::string::npos);
+    EXPECT_NE(heap.find("10: 20480 [10: 20480] @ 0x"), std::string::npos);
+    EXPECT_NE(heap.find("MAPPED_LIBRARIES:"), std::string::npos);
+
+    // "kök;...;yaprak değer"
+    const std::string folded = ReadFile(foldedPath);
+    const size_t leaf = folded.find(";HeapProfilerRetainingSite(");
+    ASSERT_NE(leaf, std::string::npos) << folded;
+    EXPECT_EQ(folded.substr(folded.find(") ", leaf), 8), ") 20480\n");
+
+    for (char* block : blocks) delete[] block;
+}
+
+TEST_F(TestHeapProfiler, StoppedProfilerDoesNotSample) {
+    char* blocks[20];
+    ASSERT_TRUE(HeapProfiler::Start(1));
+    EXPECT_TRUE(HeapProfiler::IsRunning());
+    HeapProfiler::Stop();
+    EXPECT_FALSE(HeapProfiler::IsRunning());
+
+    const uint64_t samples = HeapProfiler::GetSampleCount();
+    HeapProfilerRetainingSite(blocks, 20, 100);
+    EXPECT_EQ(HeapProfiler::GetSampleCount(), samples);
+    for (char* block : blocks) delete[] block;
+
+    // Yeniden başlatmak önceki ölçümleri siler
+    ASSERT_TRUE(HeapProfiler::Start(1));
+    HeapProfiler::Stop();
+    const auto sites = HeapProfiler::GetTopSites(1000);
+    EXPECT_EQ(FindSite(sites, "HeapProfilerRetainingSite"), nullptr);
+}
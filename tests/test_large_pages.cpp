@@ -0,0 +1,91 @@
+// tests/test_large_pages.cpp
+#include "../Headers/LargePages.h"
+#include "../Headers/AllocationCounter.h"
+#include "../Headers/FramePipeline.h"
+#include <gtest/gtest.h>
+#include <cstring>
+
+class TestLargePages : public ::testing::Test {
+protected:
+    static constexpr size_t FRAME_4K = static_cast<size_t>(3840) * 2160 * 4;
+
+    static size_t MappedBytes() {
+        return LargePages::GetBytes(LargePages::Backing::Regular) +
+               LargePages::GetBytes(LargePages::Backing::Transparent) +
+               LargePages::GetBytes(LargePages::Backing::Explicit);
+    }
+};
+
+TEST_F(TestLargePages, SmallBuffersStayOnHeap) {
+    LargePages::Backing backing = LargePages::Backing::Explicit;
+    void* pointer = LargePages::Allocate(4096, LargePages::Mode::Explicit, &backing);
+    ASSERT_NE(pointer, nullptr);
+    EXPECT_EQ(backing, LargePages::Backing::Heap);
+    LargePages::Free(pointer, 4096, LargePages::Mode::Explicit);
+
+    pointer = LargePages::Allocate(FRAME_4K, LargePages::Mode::Off, &backing);
+    ASSERT_NE(pointer, nullptr);
+    EXPECT_EQ(backing, LargePages::Backing::Heap);
+    LargePages::Free(pointer, FRAME_4K, LargePages::Mode::Off);
+}
+
+TEST_F(TestLargePages, LargeBufferFallsBackGracefully) {
+    if (LargePages::GetLargePageSize() == 0) GTEST_SKIP() << "Platform büyük sayfa desteklemiyor";
+
+    // Hangi tür alınırsa alınsın (havuz boş, yetki yok...) kullanılabilir bellek gelmeli
+    for (auto mode : { LargePages::Mode::Transparent, LargePages::Mode::Explicit }) {
+        const size_t before = MappedBytes();
+        LargePages::Backing backing = LargePages::Backing::Heap;
+        auto* pixels = static_cast<uint8_t*>(LargePages::Allocate(FRAME_4K, mode, &backing));
+        ASSERT_NE(pixels, nullptr);
+        EXPECT_NE(backing, LargePages::Backing::Heap) << LargePages::GetBackingName(backing);
+
+        std::memset(pixels, 0x5A, FRAME_4K);
+        EXPECT_EQ(pixels[FRAME_4K - 1], 0x5A);
+        // Büyük sayfa sınırına yuvarlanır ve hizalanır
+        EXPECT_GE(MappedBytes() - before, FRAME_4K);
+        EXPECT_EQ((MappedBytes() - before) % LargePages::GetLargePageSize(), 0u);
+#ifndef _WIN32
+        if (backing != LargePages::Backing::Regular) {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(pixels) % LargePages::GetLargePageSize(), 0u);
+        }
+#endif
+        LargePages::Free(pixels, FRAME_4K, mode);
+        EXPECT_EQ(MappedBytes(), before);
+    }
+}
+
+TEST_F(TestLargePages, FramePipelineBacksPixelsWithLargePages) {
+    if (LargePages::GetLargePageSize() == 0) GTEST_SKIP() << "Platform büyük sayfa desteklemiyor";
+
+    const size_t before = MappedBytes();
+    {
+        FramePipeline pipeline(1000.0 / 60.0);
+        pipeline.SetLargePages(LargePages::Mode::Transparent);
+        EXPECT_EQ(pipeline.GetLargePages(), LargePages::Mode::Transparent);
+        uint32_t clockMs = 0;
+        pipeline.SetDecoder([&clockMs](FramePipeline::Frame& frame) {
+            frame.width = 3840;
+            frame.height = 2160;
+            frame.stride = 3840 * 4;
+            frame.timestampMs = clockMs += 16;
+            frame.pixels.resize(FRAME_4K);
+            frame.pixels[frame.pixels.size() - 1] = static_cast<uint8_t>(clockMs);
+            return true;
+        });
+        for (int i = 0; i < 5; ++i) pipeline.Step();
+        // Başlangıç derinliği kadar slot, her biri sayfa eşlemesi
+        EXPECT_GE(MappedBytes() - before, static_cast<size_t>(pipeline.GetDepth()) * FRAME_4K);
+
+        // Slotlar yeniden kullanılır: ısınmış döngü eşleme yapmaz
+        AllocationCounter counter;
+        const size_t mapped = MappedBytes();
+        for (int i = 0; i < 20; ++i) pipeline.Step();
+        EXPECT_EQ(counter.GetCount(), 0u) << counter.Describe();
+        EXPECT_EQ(MappedBytes(), mapped);
+
+        pipeline.SetMemoryCap(1);
+        EXPECT_LT(MappedBytes(), mapped);
+    }
+    EXPECT_EQ(MappedBytes(), before);
+}
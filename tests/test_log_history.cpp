@@ -0,0 +1,128 @@
+// tests/test_log_history.cpp
+#include "../Headers/LogHistory.h"
+#include "../Headers/AllocationCounter.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TestLogHistory : public ::testing::Test {
+protected:
+    static LogHistory::Capacities Uniform(size_t capacity) {
+        LogHistory::Capacities capacities;
+        capacities.fill(capacity);
+        return capacities;
+    }
+};
+
+TEST_F(TestLogHistory, KeepsNewestEntriesPerLevelInOrder) {
+    auto capacities = Uniform(4);
+    capacities[static_cast<size_t>(LogSeverity::Debug)] = 0;   // Hiç tutulmaz
+    LogHistory history(capacities);
+
+    history.Append(LogSeverity::Error, "hata 0", 1);
+    for (int i = 0; i < 10; ++i) history.Append(LogSeverity::Info, "bilgi " + std::to_string(i), 10 + i);
+    history.Append(LogSeverity::Debug, "ayrıntı", 30);
+    history.Append(LogSeverity::Error, "hata 1", 40);
+
+    const auto entries = history.Snapshot();
+    // INFO seli hataları halkadan atmaz; INFO'nun sadece son 4'ü kalır
+    ASSERT_EQ(entries.size(), 6u);
+    EXPECT_EQ(entries[0].message, "hata 0");
+    EXPECT_EQ(entries[0].severity, LogSeverity::Error);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(entries[1 + i].message, "bilgi " + std::to_string(6 + i));
+        EXPECT_EQ(entries[1 + i].timestampMs, 16 + i);
+    }
+    EXPECT_EQ(entries[5].message, "hata 1");
+    for (size_t i = 1; i < entries.size(); ++i) EXPECT_LT(entries[i - 1].sequence, entries[i].sequence);
+    EXPECT_EQ(history.GetAppendedCount(), 13u);
+}
+
+TEST_F(TestLogHistory, ClearHidesOlderEntries) {
+    LogHistory history(Uniform(8));
+    history.Append(LogSeverity::Warning, "eski", 1);
+    history.Clear();
+    EXPECT_TRUE(history.Snapshot().empty());
+    history.Append(LogSeverity::Warning, "yeni", 2);
+    const auto entries = history.Snapshot();
+    ASSERT_EQ(entries.size(), 1u);
+    EXPECT_EQ(entries[0].message, "yeni");
+}
+
+TEST_F(TestLogHistory, TruncationKeepsUtf8CharactersWhole) {
+    LogHistory history(Uniform(4));
+    std::string message;
+    for (int i = 0; i < 200; ++i) message += "ş";   // 2 baytlık karakterler; sınır bir karakterin ortasına düşer
+    history.Append(LogSeverity::Info, message, 1);
+
+    const auto entries = history.Snapshot();
+    ASSERT_EQ(entries.size(), 1u);
+    const std::string& text = entries[0].message;
+    ASSERT_LE(text.size(), LogHistory::MAX_MESSAGE_BYTES);
+    ASSERT_GE(text.size(), 3u);
+    EXPECT_EQ(text.substr(text.size() - 3), "\xE2\x80\xA6");
+    const std::string kept = text.substr(0, text.size() - 3);
+    EXPECT_EQ(kept.size() % 2, 0u);
+    EXPECT_EQ(kept, message.substr(0, kept.size()));
+}
+
+TEST_F(TestLogHistory, SnapshotsStayConsistentUnderConcurrentWriters) {
+    constexpr int WRITERS = 4;
+    constexpr int RECORDS = 20000;
+    LogHistory history(Uniform(32));
+    std::atomic<bool> done{ false };
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < WRITERS; ++w) {
+        writers.emplace_back([&history, w] {
+            const std::string prefix = "yazıcı " + std::to_string(w) + " kayıt ";
+            for (int i = 0; i < RECORDS; ++i) {
+                history.Append(static_cast<LogSeverity>(w % 3 + 2), prefix + std::to_string(i), i);
+            }
+        });
+    }
+
+    int snapshots = 0;
+    std::thread reader([&] {
+        while (!done.load()) {
+            // Her kayıt tam (yarım yazılmış mesaj yok) ve her yazıcının kayıtları sıralı olmalı
+            std::vector<int> last(WRITERS, -1);
+            for (const auto& entry : history.Snapshot()) {
+                const int writer = entry.message[std::string("yazıcı ").size()] - '0';
+                const int index = std::stoi(entry.message.substr(entry.message.rfind(' ') + 1));
+                ASSERT_EQ(entry.message, "yazıcı " + std::to_string(writer) + " kayıt " + std::to_string(index));
+                ASSERT_EQ(entry.timestampMs, index);
+                ASSERT_GT(index, last[writer]);
+                last[writer] = index;
+            }
+            ++snapshots;
+        }
+    });
+
+    for (auto& writer : writers) writer.join();
+    done = true;
+    reader.join();
+    EXPECT_GT(snapshots, 0);
+    EXPECT_EQ(history.GetAppendedCount(), static_cast<uint64_t>(WRITERS * RECORDS));
+    EXPECT_LE(history.Snapshot().size(), 3u * 32u);
+}
+
+TEST_F(TestLogHistory, MemoryStaysFlatOverLongRun) {
+    LogHistory history;
+    const size_t before = MemoryAccounting::GetCurrent(MemoryCategory::Logging);
+    const std::string message = "Bellek kullanımı: 183 MB (Normal)";
+
+    // 24 saat boyunca saniyede ~10 kayıt
+    AllocationCounter counter;
+    for (int i = 0; i < 24 * 60 * 60 * 10; ++i) {
+        history.Append(static_cast<LogSeverity>(i % 4 + 1), message, i);
+    }
+    EXPECT_EQ(counter.GetCount(), 0u) << counter.Describe();
+    EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Logging), before);
+
+    size_t capacity = 0;
+    for (int level = 1; level <= 4; ++level) capacity += history.GetCapacity(static_cast<LogSeverity>(level));
+    EXPECT_EQ(history.Snapshot().size(), capacity);
+}
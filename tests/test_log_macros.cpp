@@ -0,0 +1,102 @@
+// tests/test_log_macros.cpp
+// Taban derleme seçeneğinden bağımsız olsun diye bu dosyada sabitlenir: Warning
+#undef LMWALLPAPER_LOG_FLOOR
+#define LMWALLPAPER_LOG_FLOOR 3
+#include "../Headers/LogMacros.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+int g_evaluations = 0;
+
+// Çağrıldığında sayan pahalı argüman yerine geçer
+std::string CountedArgument(const char* text) {
+    ++g_evaluations;
+    return text;
+}
+
+}  // namespace
+
+class TestLogMacros : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+        g_evaluations = 0;
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_log_macros_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+};
+
+TEST_F(TestLogMacros, CallsBelowFloorDoNotEvaluateArguments) {
+    static_assert(!LMW_LOG_COMPILED(Trace) && !LMW_LOG_COMPILED(Info));
+    static_assert(LMW_LOG_COMPILED(Warning) && LMW_LOG_COMPILED(Critical));
+
+    AsyncLog log;
+    for (int i = 0; i < 10; ++i) {
+        LMW_LOG_TRACE(log, "iz {}", CountedArgument("trace"));
+        LMW_LOG_DEBUG(log, "ayrıntı {}", CountedArgument("debug"));
+        LMW_LOG_INFO(log, "bilgi {}", CountedArgument("info"));
+    }
+    EXPECT_EQ(g_evaluations, 0);
+
+    LMW_LOG_WARNING(log, "uyarı {}", CountedArgument("warning"));
+    LMW_LOG_ERROR(log, "hata {}", CountedArgument("error"));
+    EXPECT_EQ(g_evaluations, 2);
+    log.Flush();
+    EXPECT_EQ(log.GetWrittenCount(), 2u);
+    EXPECT_EQ(log.GetDroppedCount(), 0u);
+}
+
+TEST_F(TestLogMacros, RuntimeFilterAboveFloorSkipsArguments) {
+    AsyncLog log;
+    log.SetMinimumSeverity(LogSeverity::Critical);
+    EXPECT_FALSE(LMW_LOG_IS_ON(log, Error));
+    EXPECT_TRUE(LMW_LOG_IS_ON(log, Critical));
+
+    LMW_LOG_ERROR(log, "hata {}", CountedArgument("error"));
+    EXPECT_EQ(g_evaluations, 0);
+    LMW_LOG_CRITICAL(log, "kritik {}", CountedArgument("critical"));
+    EXPECT_EQ(g_evaluations, 1);
+
+    // Çalışma zamanında süzülen kayıt düşürülmüş sayılmaz
+    EXPECT_FALSE(log.Push(LogSeverity::Warning, "doğrudan"));
+    log.Flush();
+    EXPECT_EQ(log.GetWrittenCount(), 1u);
+    EXPECT_EQ(log.GetDroppedCount(), 0u);
+
+    log.SetMinimumSeverity(LogSeverity::Trace);
+    EXPECT_TRUE(LMW_LOG_IS_ON(log, Warning));
+    // Taban çalışma zamanı ayarından bağımsızdır
+    EXPECT_FALSE(LMW_LOG_IS_ON(log, Debug));
+}
+
+TEST_F(TestLogMacros, WrittenLinesUseFormat) {
+    const auto path = testDir / "macros.txt";
+    {
+        AsyncLog log;
+        ASSERT_TRUE(log.SetFile(path.string()));
+        LMW_LOG_WARNING(log, "Kare buffer'ı: {}/{} frame ({})", 3, 8, "Moderate");
+        LMW_LOG_ERROR(log, "Argümansız hata");
+        LMW_LOG_DEBUG(log, "görünmez {}", 1);
+        log.Flush();
+    }
+    std::ifstream file(path);
+    std::string first;
+    std::string second;
+    std::string extra;
+    ASSERT_TRUE(std::getline(file, first));
+    ASSERT_TRUE(std::getline(file, second));
+    EXPECT_FALSE(std::getline(file, extra));
+    EXPECT_NE(first.find("[WARNING] Kare buffer'ı: 3/8 frame (Moderate)"), std::string::npos) << first;
+    EXPECT_NE(second.find("[ERROR] Argümansız hata"), std::string::npos) << second;
+}
@@ -0,0 +1,154 @@
+// tests/test_log_rate_limiter.cpp
+#include "../Headers/LogMacros.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TestLogRateLimiter : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_log_rate_limiter_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+
+    static std::vector<std::string> ReadLines(const std::filesystem::path& path) {
+        std::vector<std::string> lines;
+        std::ifstream file(path);
+        for (std::string line; std::getline(file, line);) lines.push_back(line.substr(line.find("] [") + 2));
+        return lines;
+    }
+};
+
+TEST_F(TestLogRateLimiter, RepeatsAreCountedAndSummarizedOnInterval) {
+    LogRateLimiter limiter(5.0, 1.0, 1000);
+    uint64_t summarized = 0;
+    int emitted = 0;
+    // 3 saniye boyunca her milisaniyede aynı mesaj
+    for (int64_t now = 0; now < 3000; ++now) {
+        const auto decision = limiter.Admit(42, now);
+        EXPECT_EQ(decision.suppressed, 0u);
+        summarized += decision.repeated;
+        emitted += decision.emit ? 1 : 0;
+    }
+    EXPECT_EQ(emitted, 1);
+    // Saniyede en fazla bir özet
+    EXPECT_EQ(summarized + limiter.GetPendingCount(), 2999u);
+    EXPECT_GE(summarized, 1999u);
+
+    // Farklı mesaj bekleyen tekrarları kendinden önce yazdırır
+    const auto decision = limiter.Admit(43, 3000);
+    EXPECT_TRUE(decision.emit);
+    EXPECT_EQ(summarized + decision.repeated, 2999u);
+    EXPECT_EQ(limiter.GetPendingCount(), 0u);
+    EXPECT_EQ(limiter.GetEmittedCount() + limiter.GetSuppressedCount(), 3001u);
+
+    // Uzun sessizlikten sonra aynı mesaj yeniden yazılır
+    EXPECT_TRUE(limiter.Admit(43, 10000).emit);
+}
+
+TEST_F(TestLogRateLimiter, DistinctMessagesAreTokenLimited) {
+    LogRateLimiter limiter(5.0, 2.0, 1000);
+    int emitted = 0;
+    for (uint64_t i = 0; i < 100; ++i) emitted += limiter.Admit(i, 0).emit ? 1 : 0;
+    EXPECT_EQ(emitted, 5);
+    EXPECT_EQ(limiter.GetSuppressedCount(), 95u);
+
+    // 2 token/s: yarım saniye sonra bir mesaj daha geçer, bastırılanların sayısıyla
+    auto decision = limiter.Admit(1000, 499);
+    EXPECT_FALSE(decision.emit);
+    decision = limiter.Admit(1001, 500);
+    EXPECT_TRUE(decision.emit);
+    EXPECT_EQ(decision.suppressed, 96u);
+    EXPECT_EQ(decision.repeated, 0u);
+    EXPECT_EQ(limiter.GetEmittedCount() + limiter.GetSuppressedCount(), 102u);
+}
+
+TEST_F(TestLogRateLimiter, FloodedCallSiteKeepsOutputSmallAndCountsExact) {
+    const auto path = testDir / "flood.txt";
+    constexpr int FLOOD = 100000;
+    {
+        AsyncLog log;
+        ASSERT_TRUE(log.SetFile(path.string()));
+        const auto failingLoop = [&log](const char* error) {
+            LMW_LOG_LIMITED(log, Error, "Video işleme hatası: {}", error);
+        };
+        for (int i = 0; i < FLOOD; ++i) failingLoop("IMFSourceReader::ReadSample başarısız");
+        failingLoop("bad_alloc");
+        log.Flush();
+        EXPECT_EQ(log.GetDroppedCount(), 0u);
+    }
+
+    const auto lines = ReadLines(path);
+    ASSERT_GE(lines.size(), 3u);
+    // Test 10 s'den uzun sürmedikçe: mesaj, özet, yeni mesaj
+    EXPECT_LE(lines.size(), 4u);
+    EXPECT_EQ(lines.front(), "[ERROR] Video işleme hatası: IMFSourceReader::ReadSample başarısız");
+    EXPECT_EQ(lines.back(), "[ERROR] Video işleme hatası: bad_alloc");
+
+    const std::string prefix = "[ERROR] Son mesaj ";
+    uint64_t repeated = 0;
+    for (size_t i = 1; i + 1 < lines.size(); ++i) {
+        ASSERT_EQ(lines[i].compare(0, prefix.size(), prefix), 0) << lines[i];
+        repeated += std::stoull(lines[i].substr(prefix.size()));
+    }
+    EXPECT_EQ(repeated, static_cast<uint64_t>(FLOOD - 1));
+}
+
+TEST_F(TestLogRateLimiter, QuietCallSiteStillGetsItsSummary) {
+    const auto path = testDir / "quiet.txt";
+    static const BinaryLog::Format format("Çözme hatası: {}");
+    BinaryLog::Encoder message;
+    message.Put("E_FAIL");
+    {
+        AsyncLog log;
+        ASSERT_TRUE(log.SetFile(path.string()));
+        LogRateLimiter limiter(5.0, 1.0, 100);
+        for (int i = 0; i < 50; ++i) LogWriteLimited(log, LogSeverity::Error, format, limiter, message);
+        EXPECT_EQ(limiter.GetPendingCount(), 49u);
+
+        // Çağrı yeri susar: özeti yazıcı thread'i aralık dolunca kendisi yazar
+        for (int i = 0; i < 100 && limiter.GetPendingCount() > 0; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        EXPECT_EQ(limiter.GetPendingCount(), 0u);
+        log.Flush();
+    }
+
+    const auto lines = ReadLines(path);
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "[ERROR] Çözme hatası: E_FAIL");
+    EXPECT_EQ(lines[1], "[ERROR] Son mesaj 49 kez tekrarlandı");
+}
+
+TEST_F(TestLogRateLimiter, PendingSummariesAreWrittenAtShutdown) {
+    const auto path = testDir / "shutdown.txt";
+    static const BinaryLog::Format format("Kare {} düşürüldü");
+    LogRateLimiter limiter(3.0, 0.0, 60000);   // Aralık test süresince dolmaz
+    {
+        AsyncLog log;
+        ASSERT_TRUE(log.SetFile(path.string()));
+        for (int i = 0; i < 10; ++i) {
+            BinaryLog::Encoder message;
+            message.Put(i);
+            LogWriteLimited(log, LogSeverity::Warning, format, limiter, message);
+        }
+        EXPECT_EQ(limiter.GetPendingCount(), 7u);
+    }
+    EXPECT_EQ(limiter.GetPendingCount(), 0u);
+
+    const auto lines = ReadLines(path);
+    ASSERT_EQ(lines.size(), 4u);
+    EXPECT_EQ(lines[2], "[WARNING] Kare 2 düşürüldü");
+    EXPECT_EQ(lines[3], "[WARNING] 7 mesaj hız sınırıyla bastırıldı");
+}
@@ -0,0 +1,152 @@
+// tests/test_log_rotation.cpp
+#include "../Headers/AsyncLog.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TestLogRotation : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_log_rotation_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+
+    static std::string ReadFile(const std::filesystem::path& path) {
+        if (path.extension() == LogRotation::COMPRESSED_EXTENSION) {
+            std::ostringstream out;
+            EXPECT_TRUE(LogRotation::DecompressFile(path, out)) << path;
+            return out.str();
+        }
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    // Arşivler eskiden yeniye, ardından etkin dosya; zaman damgası atılmış satırlar
+    static std::vector<std::string> ReadAllLines(const std::filesystem::path& active) {
+        std::vector<std::filesystem::path> files = LogRotation::ListArchives(active.string());
+        files.push_back(active);
+        std::vector<std::string> lines;
+        for (const auto& path : files) {
+            std::istringstream stream(ReadFile(path));
+            for (std::string line; std::getline(stream, line);) lines.push_back(line.substr(line.find("] [") + 2));
+        }
+        return lines;
+    }
+};
+
+TEST_F(TestLogRotation, ConcurrentLoadRotatesWithoutLosingRecords) {
+    constexpr int PRODUCERS = 4;
+    constexpr int RECORDS = 25000;
+    constexpr uint64_t MAX_BYTES = 64 * 1024;
+    const auto path = testDir / "error_log.txt";
+
+    AsyncLog log;
+    LogRotation::Policy policy;
+    policy.maxBytes = MAX_BYTES;
+    policy.retainCount = 1000000;
+    log.SetRotation(policy);
+    ASSERT_TRUE(log.SetFile(path.string()));
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < PRODUCERS; ++producer) {
+        producers.emplace_back([&log, producer] {
+            const std::string padding(40, 'x');
+            for (int i = 0; i < RECORDS; ++i) {
+                std::string message("t");
+                message.append(std::to_string(producer)).append(" ").append(std::to_string(i)).append(" ").append(padding);
+                // Kuyruk doluysa tekrar dene: kayıp sayılmaz, geri basınç
+                while (!log.Push(LogSeverity::Warning, message)) std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& producer : producers) producer.join();
+    log.Flush();
+    log.GetRotation().WaitIdle();
+
+    const auto archives = LogRotation::ListArchives(path.string());
+    EXPECT_GE(archives.size(), 10u);
+    EXPECT_EQ(archives.size(), log.GetRotation().GetRotatedCount());
+    EXPECT_EQ(log.GetRotation().GetCompressedCount(), archives.size());
+    for (const auto& archive : archives) {
+        EXPECT_EQ(archive.extension(), LogRotation::COMPRESSED_EXTENSION) << archive;
+        // Sınır en fazla bir kayıt aşılır
+        EXPECT_LE(ReadFile(archive).size(), MAX_BYTES + 512) << archive;
+        EXPECT_LT(std::filesystem::file_size(archive), MAX_BYTES);
+    }
+
+    // Her üreticinin kayıtları eksiksiz ve sırasıyla
+    std::vector<int> next(PRODUCERS, 0);
+    for (const auto& line : ReadAllLines(path)) {
+        if (line.find("düşürüldü") != std::string::npos) continue;
+        ASSERT_EQ(line.compare(0, 11, "[WARNING] t"), 0) << line;
+        const int producer = line[11] - '0';
+        const int index = std::stoi(line.substr(13));
+        ASSERT_EQ(index, next[producer]) << "üretici " << producer;
+        ++next[producer];
+    }
+    for (int producer = 0; producer < PRODUCERS; ++producer) EXPECT_EQ(next[producer], RECORDS);
+}
+
+TEST_F(TestLogRotation, RetentionKeepsNewestArchives) {
+    const auto path = testDir / "retained.txt";
+    AsyncLog log;
+    LogRotation::Policy policy;
+    policy.maxBytes = 1024;
+    policy.retainCount = 3;
+    log.SetRotation(policy);
+    ASSERT_TRUE(log.SetFile(path.string()));
+
+    for (int i = 0; i < 400; ++i) {
+        log.Push(LogSeverity::Info, "kayıt " + std::to_string(i));
+        if (i % 20 == 19) log.Flush();
+    }
+    log.Flush();
+    log.GetRotation().WaitIdle();
+
+    EXPECT_GT(log.GetRotation().GetRotatedCount(), 3u);
+    const auto archives = LogRotation::ListArchives(path.string());
+    ASSERT_EQ(archives.size(), 3u);
+
+    // Kalan arşivler ve etkin dosya en yeni kayıtlarla kesintisiz biter
+    const auto lines = ReadAllLines(path);
+    ASSERT_FALSE(lines.empty());
+    EXPECT_EQ(lines.back(), "[INFO] kayıt 399");
+    const int first = std::stoi(lines.front().substr(std::string("[INFO] kayıt ").size()));
+    EXPECT_EQ(static_cast<int>(lines.size()), 400 - first);
+}
+
+TEST_F(TestLogRotation, AgeLimitRotatesUncompressed) {
+    const auto path = testDir / "aged.txt";
+    AsyncLog log;
+    LogRotation::Policy policy;
+    policy.maxBytes = 0;
+    policy.maxAgeMs = 50;
+    policy.compress = false;
+    log.SetRotation(policy);
+    ASSERT_TRUE(log.SetFile(path.string()));
+
+    log.Push(LogSeverity::Info, "eski");
+    log.Flush();
+    std::this_thread::sleep_for(std::chrono::milliseconds(80));
+    log.Push(LogSeverity::Info, "yeni");
+    log.Flush();
+    log.GetRotation().WaitIdle();
+
+    const auto archives = LogRotation::ListArchives(path.string());
+    ASSERT_EQ(archives.size(), 1u);
+    EXPECT_EQ(archives[0].extension(), ".txt");
+    EXPECT_EQ(log.GetRotation().GetCompressedCount(), 0u);
+    EXPECT_EQ(ReadAllLines(path), (std::vector<std::string>{ "[INFO] eski", "[INFO] yeni" }));
+}
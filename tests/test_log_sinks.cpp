@@ -0,0 +1,139 @@
+// tests/test_log_sinks.cpp
+#include "../Headers/BinaryLog.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class TestLogSinks : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_log_sinks_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+
+    // Zaman damgası atılmış satırlar: "[SEVİYE] mesaj"
+    static std::vector<std::string> ReadLines(const std::filesystem::path& path) {
+        std::vector<std::string> lines;
+        std::ifstream file(path);
+        for (std::string line; std::getline(file, line);) lines.push_back(line.substr(line.find("] [") + 2));
+        return lines;
+    }
+
+    static void WriteMixedLevels(AsyncLog& log) {
+        static const BinaryLog::Format frameFormat("Kare {} gecikti ({} ms)");
+        log.Push(LogSeverity::Trace, "iz");
+        log.Push(LogSeverity::Debug, "ayrıntı");
+        log.Push(LogSeverity::Info, "video yüklendi");
+        BinaryLog::Write(log, LogSeverity::Warning, frameFormat, 42, 18.5);
+        log.Push(LogSeverity::Error, "çözme hatası");
+        log.Push(LogSeverity::Critical, "cihaz kayboldu");
+    }
+};
+
+TEST_F(TestLogSinks, OneQueueFeedsEverySinkThroughItsOwnFilter) {
+    const auto filePath = testDir / "app.txt";
+    const auto debuggerPath = testDir / "debugger.txt";
+    std::FILE* debuggerStream = std::fopen(debuggerPath.string().c_str(), "wb");
+    ASSERT_NE(debuggerStream, nullptr);
+
+    auto history = std::make_shared<LogHistorySink>(LogSeverity::Info);
+    auto debugger = std::make_shared<LogDebuggerSink>(LogSeverity::Warning, debuggerStream);
+    auto metrics = std::make_shared<LogMetricsSink>();
+    {
+        AsyncLog log;
+        ASSERT_TRUE(log.SetFile(filePath.string()));
+        log.AddSink(history);
+        log.AddSink(debugger);
+        log.AddSink(metrics);
+        WriteMixedLevels(log);
+        log.Flush();
+    }
+    std::fclose(debuggerStream);
+
+    EXPECT_EQ(ReadLines(filePath).size(), 6u);
+    EXPECT_EQ(ReadLines(debuggerPath), (std::vector<std::string>{
+        "[WARNING] Kare 42 gecikti (18.5 ms)", "[ERROR] çözme hatası", "[CRITICAL] cihaz kayboldu" }));
+
+    // Geçmiş biçimlendirilmiş metni tutar; Info altı süzülür
+    const auto entries = history->GetHistory().Snapshot();
+    ASSERT_EQ(entries.size(), 4u);
+    EXPECT_EQ(entries[0].message, "video yüklendi");
+    EXPECT_EQ(entries[1].message, "Kare 42 gecikti (18.5 ms)");
+    EXPECT_EQ(entries[1].severity, LogSeverity::Warning);
+
+    EXPECT_EQ(metrics->GetTotalCount(), 6u);
+    EXPECT_EQ(metrics->GetCount(LogSeverity::Trace), 1u);
+    EXPECT_EQ(metrics->GetCount(LogSeverity::Critical), 1u);
+}
+
+TEST_F(TestLogSinks, FileFilterDoesNotHideRecordsFromOtherSinks) {
+    const auto filePath = testDir / "errors.txt";
+    auto metrics = std::make_shared<LogMetricsSink>(LogSeverity::Debug);
+    AsyncLog log;
+    ASSERT_TRUE(log.SetFile(filePath.string()));
+    log.GetFileSink().SetMinimumSeverity(LogSeverity::Error);
+    log.AddSink(metrics);
+
+    WriteMixedLevels(log);
+    log.Flush();
+    EXPECT_EQ(ReadLines(filePath), (std::vector<std::string>{ "[ERROR] çözme hatası", "[CRITICAL] cihaz kayboldu" }));
+    EXPECT_EQ(metrics->GetTotalCount(), 5u);
+
+    // Çıkarılan sink bir sonraki döngüden itibaren beslenmez
+    log.RemoveSink(metrics.get());
+    log.Push(LogSeverity::Error, "sonra");
+    log.Flush();
+    EXPECT_EQ(metrics->GetTotalCount(), 5u);
+    EXPECT_EQ(ReadLines(filePath).size(), 3u);
+}
+
+TEST_F(TestLogSinks, QueueDropsReachEverySink) {
+    auto history = std::make_shared<LogHistorySink>(LogSeverity::Trace);
+    auto metrics = std::make_shared<LogMetricsSink>();
+    AsyncLog log(16);
+    log.AddSink(history);
+    log.AddSink(metrics);
+
+    // Yazıcı uyanmadan kuyruğu taşır: düşük öncelikliler düşer
+    int accepted = 0;
+    for (int i = 0; i < 2000; ++i) accepted += log.Push(LogSeverity::Debug, "gürültü") ? 1 : 0;
+    log.Flush();
+    ASSERT_GT(log.GetDroppedCount(), 0u);
+
+    EXPECT_EQ(metrics->GetCount(LogSeverity::Debug), static_cast<uint64_t>(accepted));
+    // Düşme notları da aynı kayıt yolundan geçer
+    uint64_t notes = 0;
+    uint64_t reported = 0;
+    for (const auto& entry : history->GetHistory().Snapshot()) {
+        if (entry.message.find("düşürüldü") == std::string::npos) continue;
+        EXPECT_EQ(entry.severity, LogSeverity::Warning);
+        ++notes;
+        reported += std::stoull(entry.message);
+    }
+    EXPECT_EQ(reported, log.GetDroppedCount());
+    EXPECT_EQ(metrics->GetCount(LogSeverity::Warning), notes);
+}
+
+TEST_F(TestLogSinks, PrefixFloorsNegativeTimestamps) {
+    // 1970 öncesi milisaniye: -1 ms, -1000 ms ile aynı saniyenin son milisaniyesidir
+    LogLinePrefix prefix;
+    std::string last, first;
+    prefix.Append(last, -1, LogSeverity::Info);
+    prefix.Append(first, -1000, LogSeverity::Info);
+    EXPECT_NE(last.find(".999] [INFO] "), std::string::npos) << last;
+    EXPECT_NE(first.find(".000] [INFO] "), std::string::npos) << first;
+    EXPECT_EQ(last.substr(0, last.find('.')), first.substr(0, first.find('.')));
+}
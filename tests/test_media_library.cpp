@@ -0,0 +1,130 @@
+// tests/test_media_library.cpp
+#include "SyntheticMedia.h"
+#include "../Headers/MediaLibrary.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+class TestMediaLibrary : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+    std::filesystem::path videoDir;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_library_test";
+        videoDir = testDir / "videos";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(videoDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+
+    void CreateVideos(int count) {
+        const auto mp4 = SyntheticMedia::BuildMp4(1920, 1080, 250, 25, 1, 5, false);
+        for (int i = 0; i < count; ++i) {
+            SyntheticMedia::WriteFile(videoDir / ("clip" + std::to_string(i) + ".mp4"), mp4);
+        }
+    }
+};
+
+TEST_F(TestMediaLibrary, InitialScanProbesEverything) {
+    CreateVideos(5);
+    SyntheticMedia::WriteFile(videoDir / "notes.txt", { 'x' });
+
+    MediaLibrary library;
+    auto stats = library.Rescan(videoDir);
+    EXPECT_EQ(stats.total, 5u);
+    EXPECT_EQ(stats.added, 5u);
+    EXPECT_EQ(library.GetEntryCount(), 5u);
+
+    MediaLibrary::Entry entry;
+    ASSERT_TRUE(library.GetEntry(videoDir / "clip3.mp4", entry));
+    EXPECT_TRUE(entry.probed);
+    EXPECT_EQ(entry.info.codec, "H.264");
+    EXPECT_EQ(entry.info.width, 1920);
+}
+
+TEST_F(TestMediaLibrary, UnchangedRescanDoesNotReprobe) {
+    CreateVideos(5);
+    MediaLibrary library;
+    library.Rescan(videoDir);
+
+    auto stats = library.Rescan(videoDir);
+    EXPECT_EQ(stats.unchanged, 5u);
+    EXPECT_EQ(stats.added + stats.changed + stats.removed, 0u);
+}
+
+TEST_F(TestMediaLibrary, DetectsChangedAndRemovedFiles) {
+    CreateVideos(4);
+    MediaLibrary library;
+    library.Rescan(videoDir);
+
+    // Boyut değişikliği kimliği değiştirir
+    SyntheticMedia::WriteFile(videoDir / "clip1.mp4", SyntheticMedia::BuildMp4(3840, 2160, 300, 60000, 1001, 10, true));
+    std::filesystem::remove(videoDir / "clip2.mp4");
+
+    auto stats = library.Rescan(videoDir);
+    EXPECT_EQ(stats.changed, 1u);
+    EXPECT_EQ(stats.removed, 1u);
+    EXPECT_EQ(stats.unchanged, 2u);
+
+    ContainerProbe::Result info;
+    ASSERT_TRUE(library.GetVideoInfo(videoDir / "clip1.mp4", info));
+    EXPECT_EQ(info.codec, "HEVC");
+    EXPECT_FALSE(library.GetVideoInfo(videoDir / "clip2.mp4", info));
+}
+
+TEST_F(TestMediaLibrary, StoreRoundTrip) {
+    CreateVideos(3);
+    SyntheticMedia::WriteFile(videoDir / "legacy.wmv", SyntheticMedia::Bytes(64, 0));
+
+    const auto storePath = testDir / "library.bin";
+    {
+        MediaLibrary library;
+        library.Rescan(videoDir);
+        ASSERT_TRUE(library.SetThumbnail(videoDir / "clip0.mp4", testDir / "thumb0.jpg"));
+        ASSERT_TRUE(library.Save(storePath));
+    }
+
+    MediaLibrary library;
+    ASSERT_TRUE(library.Load(storePath));
+    EXPECT_EQ(library.GetEntryCount(), 4u);
+
+    MediaLibrary::Entry entry;
+    ASSERT_TRUE(library.GetEntry(videoDir / "clip0.mp4", entry));
+    EXPECT_EQ(entry.thumbnailPath, testDir / "thumb0.jpg");
+    EXPECT_EQ(entry.info.keyframeCount, 5u);
+    ASSERT_TRUE(library.GetEntry(videoDir / "legacy.wmv", entry));
+    EXPECT_FALSE(entry.probed);
+
+    // Yüklenen depo ile tarama hiçbir şeyi yeniden probe etmemeli
+    auto stats = library.Rescan(videoDir);
+    EXPECT_EQ(stats.unchanged, 4u);
+}
+
+TEST_F(TestMediaLibrary, RejectsCorruptStore) {
+    const auto storePath = testDir / "library.bin";
+    SyntheticMedia::WriteFile(storePath, { 'L', 'M', 'W', 'L', 1, 0, 0, 0, 5, 0, 0, 0, 3 });
+
+    MediaLibrary library;
+    EXPECT_FALSE(library.Load(storePath));
+    EXPECT_EQ(library.GetEntryCount(), 0u);
+
+    // Kayıt sayısı dosyadan büyük: ayırma yapılmadan reddedilir
+    SyntheticMedia::WriteFile(storePath, { 'L', 'M', 'W', 'L', 3, 0, 0, 0, 0xFF, 0xFF, 0xFF, 0xFF });
+    EXPECT_FALSE(library.Load(storePath));
+    EXPECT_EQ(library.GetEntryCount(), 0u);
+}
+
+TEST_F(TestMediaLibrary, TrailingSeparatorKeepsRemovalScope) {
+    CreateVideos(3);
+    MediaLibrary library;
+    library.Rescan(videoDir / "");
+
+    std::filesystem::remove(videoDir / "clip1.mp4");
+    auto stats = library.Rescan(videoDir / "");
+    EXPECT_EQ(stats.removed, 1u);
+    EXPECT_EQ(library.GetEntryCount(), 2u);
+}
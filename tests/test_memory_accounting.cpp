@@ -0,0 +1,112 @@
+// tests/test_memory_accounting.cpp
+#include "../Headers/MemoryAccounting.h"
+#include "../Headers/AnimatedPreview.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+class TestMemoryAccounting : public ::testing::Test {
+protected:
+    void SetUp() override {
+        MemoryAccounting::ResetPeaks();
+    }
+};
+
+TEST_F(TestMemoryAccounting, TracksCurrentAndPeakPerCategory) {
+    const size_t frames = MemoryAccounting::GetCurrent(MemoryCategory::Frames);
+    const size_t logging = MemoryAccounting::GetCurrent(MemoryCategory::Logging);
+
+    MemoryAccounting::Add(MemoryCategory::Frames, 8 * 1024 * 1024);
+    MemoryAccounting::Add(MemoryCategory::Frames, 8 * 1024 * 1024);
+    MemoryAccounting::Subtract(MemoryCategory::Frames, 8 * 1024 * 1024);
+
+    const auto usage = MemoryAccounting::GetUsage(MemoryCategory::Frames);
+    EXPECT_EQ(usage.currentBytes, frames + 8 * 1024 * 1024);
+    EXPECT_EQ(usage.peakBytes, frames + 16 * 1024 * 1024);
+    EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Logging), logging);
+
+    const auto snapshot = MemoryAccounting::TakeSnapshot();
+    EXPECT_EQ(snapshot[MemoryCategory::Frames].currentBytes, usage.currentBytes);
+    EXPECT_GE(snapshot.trackedBytes, usage.currentBytes);
+
+    MemoryAccounting::Subtract(MemoryCategory::Frames, 8 * 1024 * 1024);
+    EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Frames), frames);
+    EXPECT_STREQ(MemoryAccounting::GetCategoryName(MemoryCategory::Decoder), "Decoder");
+}
+
+TEST_F(TestMemoryAccounting, TrackerFollowsBufferLifetime) {
+    const size_t before = MemoryAccounting::GetCurrent(MemoryCategory::Decoder);
+    {
+        MemoryAccounting::Tracker tracker(MemoryCategory::Decoder);
+        tracker.Set(4096);
+        EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Decoder), before + 4096);
+        tracker.Set(1024);
+        EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Decoder), before + 1024);
+
+        // Taşıma sayacı iki kez saymaz
+        MemoryAccounting::Tracker moved(std::move(tracker));
+        EXPECT_EQ(moved.Get(), 1024u);
+        EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Decoder), before + 1024);
+    }
+    EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Decoder), before);
+
+    // Yüklenen önizleme Thumbnails kategorisine yazılır
+    const size_t thumbnails = MemoryAccounting::GetCurrent(MemoryCategory::Thumbnails);
+    {
+        std::vector<uint8_t> frame(160 * 90 * 4, 128);
+        AnimatedPreview::Encoder encoder(160, 90, 125);
+        encoder.AddFrame(frame.data(), 160 * 4);
+        AnimatedPreview::Player player;
+        ASSERT_TRUE(player.Load(encoder.Finish()));
+        EXPECT_GE(MemoryAccounting::GetCurrent(MemoryCategory::Thumbnails), thumbnails + 160 * 90 * 4);
+    }
+    EXPECT_EQ(MemoryAccounting::GetCurrent(MemoryCategory::Thumbnails), thumbnails);
+}
+
+TEST_F(TestMemoryAccounting, ConcurrentUpdatesBalance) {
+    const size_t before = MemoryAccounting::GetCurrent(MemoryCategory::ImageCache);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 100000; ++i) {
+                MemoryAccounting::Add(MemoryCategory::ImageCache, 64);
+                MemoryAccounting::Subtract(MemoryCategory::ImageCache, 64);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    const auto usage = MemoryAccounting::GetUsage(MemoryCategory::ImageCache);
+    EXPECT_EQ(usage.currentBytes, before);
+    EXPECT_LE(usage.peakBytes, before + 4 * 64);
+    EXPECT_GE(usage.allocations, 400000u);
+}
+
+TEST_F(TestMemoryAccounting, ParsesSmapsRollup) {
+    const std::string text =
+        "55d0c0a00000-7ffd4b9f1000 ---p 00000000 00:00 0                          [rollup]\n"
+        "Rss:               52340 kB\n"
+        "Pss:               40211 kB\n"
+        "Pss_Anon:          30100 kB\n"
+        "Shared_Clean:       9800 kB\n"
+        "Private_Clean:      2400 kB\n"
+        "Private_Dirty:     31000 kB\n"
+        "Anonymous:         30100 kB\n"
+        "Swap:                128 kB\n";
+
+    MemoryAccounting::ProcessMemory memory;
+    ASSERT_TRUE(MemoryAccounting::ParseSmapsRollup(text, memory));
+    EXPECT_EQ(memory.residentBytes, 52340u * 1024);
+    EXPECT_EQ(memory.privateBytes, (2400u + 31000u) * 1024);
+    EXPECT_EQ(memory.anonymousBytes, 30100u * 1024);
+    EXPECT_EQ(memory.swapBytes, 128u * 1024);
+
+    EXPECT_FALSE(MemoryAccounting::ParseSmapsRollup("garbage\n", memory));
+
+#ifdef __linux__
+    MemoryAccounting::ProcessMemory self;
+    ASSERT_TRUE(MemoryAccounting::QueryProcessMemory(self));
+    EXPECT_GT(self.residentBytes, 0u);
+    EXPECT_GT(self.privateBytes, 0u);
+#endif
+}
@@ -0,0 +1,153 @@
+// tests/test_memory_budget_broker.cpp
+#include "../Headers/MemoryBudgetBroker.h"
+#include <gtest/gtest.h>
+
+static constexpr size_t MB = 1024 * 1024;
+
+class TestMemoryBudgetBroker : public ::testing::Test {
+protected:
+    struct Recorder {
+        size_t budget = 0;
+        MemoryPressure pressure = MemoryPressure::Normal;
+        int calls = 0;
+    };
+
+    static MemoryBudgetBroker::Consumer MakeConsumer(const char* name, int priority, size_t minimum,
+                                                     size_t desired, Recorder& recorder) {
+        MemoryBudgetBroker::Consumer consumer;
+        consumer.name = name;
+        consumer.priority = priority;
+        consumer.minimumBytes = minimum;
+        consumer.desiredBytes = desired;
+        consumer.onBudget = [&recorder](size_t budget, MemoryPressure pressure) {
+            recorder.budget = budget;
+            recorder.pressure = pressure;
+            ++recorder.calls;
+        };
+        return consumer;
+    }
+};
+
+TEST_F(TestMemoryBudgetBroker, HigherPriorityIsSatisfiedFirst) {
+    MemoryBudgetBroker broker(100 * MB);
+    Recorder frames, thumbnails;
+    const auto framesId = broker.Register(MakeConsumer("Frames", 10, 20 * MB, 80 * MB, frames));
+    const auto thumbsId = broker.Register(MakeConsumer("Thumbnails", 1, 5 * MB, 40 * MB, thumbnails));
+
+    // 100 MB: minimumlar (25) + Frames'in eksiği (60) + kalan 15 Thumbnails'a
+    EXPECT_EQ(frames.budget, 80 * MB);
+    EXPECT_EQ(thumbnails.budget, 20 * MB);
+    EXPECT_EQ(broker.GetGrant(framesId), 80 * MB);
+    EXPECT_EQ(broker.GetGrant(thumbsId), 20 * MB);
+
+    // Frames kaydını silmek bütçeyi serbest bırakır
+    broker.Unregister(framesId);
+    EXPECT_EQ(thumbnails.budget, 40 * MB);
+
+    // Silinen tüketiciye bir daha bildirim gitmez
+    const int callsBefore = frames.calls;
+    broker.SetTotalBudget(10 * MB);
+    EXPECT_EQ(frames.calls, callsBefore);
+    EXPECT_EQ(thumbnails.budget, 10 * MB);
+}
+
+TEST_F(TestMemoryBudgetBroker, EqualPrioritySharesProportionally) {
+    // İki monitör: 4K oynatıcı 1080p'nin dört katı ister
+    MemoryBudgetBroker broker(60 * MB);
+    Recorder monitor4k, monitor1080;
+    broker.Register(MakeConsumer("4K", 10, 0, 80 * MB, monitor4k));
+    broker.Register(MakeConsumer("1080p", 10, 0, 20 * MB, monitor1080));
+
+    EXPECT_EQ(monitor4k.budget, 48 * MB);
+    EXPECT_EQ(monitor1080.budget, 12 * MB);
+}
+
+TEST_F(TestMemoryBudgetBroker, PressureLevelsUseHysteresis) {
+    MemoryBudgetBroker broker(100 * MB);
+    Recorder frames, thumbnails;
+    broker.Register(MakeConsumer("Frames", 10, 10 * MB, 50 * MB, frames));
+    broker.Register(MakeConsumer("Thumbnails", 1, 2 * MB, 40 * MB, thumbnails));
+    EXPECT_EQ(thumbnails.budget, 40 * MB);
+
+    broker.UpdateUsage(82 * MB);
+    EXPECT_EQ(broker.GetPressure(), MemoryPressure::Moderate);
+    // Orta baskıda dağıtılan 75 MB; her iki tüketiciye de bildirilir
+    EXPECT_EQ(frames.pressure, MemoryPressure::Moderate);
+    EXPECT_EQ(thumbnails.pressure, MemoryPressure::Moderate);
+    EXPECT_EQ(frames.budget, 50 * MB);
+    EXPECT_EQ(thumbnails.budget, 25 * MB);
+
+    // Giriş eşiğinin hemen altı seviyeyi düşürmez
+    broker.UpdateUsage(75 * MB);
+    EXPECT_EQ(broker.GetPressure(), MemoryPressure::Moderate);
+
+    broker.UpdateUsage(96 * MB);
+    EXPECT_EQ(broker.GetPressure(), MemoryPressure::Critical);
+    EXPECT_EQ(frames.budget, 10 * MB);
+    EXPECT_EQ(thumbnails.budget, 2 * MB);
+
+    broker.UpdateUsage(90 * MB);
+    EXPECT_EQ(broker.GetPressure(), MemoryPressure::Critical);
+    broker.UpdateUsage(80 * MB);
+    EXPECT_EQ(broker.GetPressure(), MemoryPressure::Moderate);
+    broker.UpdateUsage(60 * MB);
+    EXPECT_EQ(broker.GetPressure(), MemoryPressure::Normal);
+    EXPECT_EQ(thumbnails.budget, 40 * MB);
+    EXPECT_EQ(thumbnails.pressure, MemoryPressure::Normal);
+
+    // Dış baskı (işletim sistemi) iç seviyeyi geçersiz kılar
+    broker.SetExternalPressure(MemoryPressure::Critical);
+    EXPECT_EQ(frames.pressure, MemoryPressure::Critical);
+    EXPECT_EQ(frames.budget, 10 * MB);
+}
+
+TEST_F(TestMemoryBudgetBroker, SmallIncreasesAreNotNotified) {
+    MemoryBudgetBroker broker(50 * MB);
+    Recorder cache;
+    broker.Register(MakeConsumer("Cache", 1, 0, 100 * MB, cache));
+    EXPECT_EQ(cache.budget, 50 * MB);
+    const int calls = cache.calls;
+
+    // %10'dan küçük artış bildirilmez, küçülme her zaman bildirilir
+    broker.SetTotalBudget(52 * MB);
+    EXPECT_EQ(cache.calls, calls);
+    EXPECT_EQ(cache.budget, 50 * MB);
+
+    broker.SetTotalBudget(49 * MB);
+    EXPECT_EQ(cache.calls, calls + 1);
+    EXPECT_EQ(cache.budget, 49 * MB);
+
+    broker.SetTotalBudget(60 * MB);
+    EXPECT_EQ(cache.budget, 60 * MB);
+
+    // Callback içinden talep güncellemek kilitlenmez
+    MemoryBudgetBroker::ConsumerId selfId = 0;
+    Recorder self;
+    auto consumer = MakeConsumer("Self", 5, 0, 10 * MB, self);
+    consumer.onBudget = [&](size_t budget, MemoryPressure) {
+        ++self.calls;
+        self.budget = budget;
+        if (selfId != 0 && budget > 4 * MB) broker.UpdateDemand(selfId, 0, 4 * MB);
+    };
+    selfId = broker.Register(std::move(consumer));
+    EXPECT_EQ(self.budget, 10 * MB);
+
+    // Baskı değişimi herkese bildirilir; Self talebini callback içinde düşürür
+    broker.SetExternalPressure(MemoryPressure::Moderate);
+    EXPECT_EQ(broker.GetGrant(selfId), 4 * MB);
+    EXPECT_EQ(self.budget, 4 * MB);
+}
+
+TEST_F(TestMemoryBudgetBroker, AvailableForExcludesOthersReservations) {
+    MemoryBudgetBroker broker(100 * MB);
+    Recorder frames, thumbnails, cache;
+    const auto framesId = broker.Register(MakeConsumer("Frames", 10, 10 * MB, 10 * MB, frames));
+    broker.Register(MakeConsumer("Thumbnails", 1, 5 * MB, 40 * MB, thumbnails));
+    broker.Register(MakeConsumer("Cache", 20, 0, 30 * MB, cache));
+
+    // Düşük öncelikli tüketicinin sadece minimumu, yüksek önceliklinin isteğinin tamamı düşülür
+    EXPECT_EQ(broker.GetAvailableFor(framesId), 65 * MB);
+
+    broker.SetExternalPressure(MemoryPressure::Critical);
+    EXPECT_EQ(broker.GetAvailableFor(framesId), 10 * MB);
+}
@@ -0,0 +1,82 @@
+// tests/test_memory_pressure_monitor.cpp
+#include "../Headers/MemoryPressureMonitor.h"
+#include <gtest/gtest.h>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+class TestMemoryPressureMonitor : public ::testing::Test {
+protected:
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<MemoryPressure> levels;
+
+    MemoryPressureMonitor::PressureCallback Recorder() {
+        return [this](MemoryPressure pressure) {
+            std::lock_guard<std::mutex> lock(mutex);
+            levels.push_back(pressure);
+            condition.notify_all();
+        };
+    }
+
+    bool WaitForLevels(size_t count, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return condition.wait_for(lock, timeout, [&] { return levels.size() >= count; });
+    }
+
+    static MemoryPressureMonitor::Options InjectOnly() {
+        MemoryPressureMonitor::Options options;
+        options.debounceMs = 20;
+        options.recoveryMs = 150;
+        options.useSystemSource = false;
+        return options;
+    }
+};
+
+TEST_F(TestMemoryPressureMonitor, BurstIsDebouncedToHighestLevel) {
+    MemoryPressureMonitor monitor;
+    ASSERT_TRUE(monitor.Start(Recorder(), InjectOnly()));
+
+    const auto start = std::chrono::steady_clock::now();
+    monitor.Inject(MemoryPressure::Moderate);
+    monitor.Inject(MemoryPressure::Critical);
+    monitor.Inject(MemoryPressure::Moderate);
+
+    ASSERT_TRUE(WaitForLevels(1, std::chrono::seconds(2)));
+    const auto latency = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(latency, std::chrono::milliseconds(100));
+    EXPECT_EQ(monitor.GetLevel(), MemoryPressure::Critical);
+
+    // Olay kesilince iyileşme süresi sonunda Normal bildirilir
+    ASSERT_TRUE(WaitForLevels(2, std::chrono::seconds(2)));
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(levels.size(), 2u);
+    EXPECT_EQ(levels[0], MemoryPressure::Critical);
+    EXPECT_EQ(levels[1], MemoryPressure::Normal);
+}
+
+TEST_F(TestMemoryPressureMonitor, IdleMonitorNeverWakes) {
+    MemoryPressureMonitor monitor;
+    ASSERT_TRUE(monitor.Start(Recorder(), InjectOnly()));
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(monitor.GetWakeupCount(), 0u);
+
+    // Durdurma beklemeden döner
+    const auto start = std::chrono::steady_clock::now();
+    monitor.Stop();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+    EXPECT_FALSE(monitor.IsRunning());
+}
+
+TEST_F(TestMemoryPressureMonitor, SystemSourceWhenAvailable) {
+    MemoryPressureMonitor monitor;
+    if (!monitor.Start(Recorder())) {
+        GTEST_SKIP() << "Bellek baskısı bildirimi yok (PSI kapalı)";
+    }
+
+    // Baskı yokken PSI tetikleyicileri sessiz; enjekte edilen olay aynı yoldan geçer
+    monitor.Inject(MemoryPressure::Moderate);
+    ASSERT_TRUE(WaitForLevels(1, std::chrono::seconds(2)));
+    EXPECT_EQ(monitor.GetLevel(), MemoryPressure::Moderate);
+    monitor.Stop();
+}
@@ -0,0 +1,153 @@
+// tests/test_perceptual_hash.cpp
+#include "SyntheticMedia.h"
+#include "../Headers/PerceptualHash.h"
+#include "../Headers/MediaLibrary.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+class TestPerceptualHash : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_phash_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+
+    // Çözünürlükten bağımsız, yumuşak geçişli bir sahne (BGRA)
+    static std::vector<uint8_t> RenderScene(int width, int height, int seed, int noise = 0) {
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+        std::mt19937 random(static_cast<unsigned>(seed * 7919 + width));
+        std::uniform_int_distribution<int> jitter(-noise, noise);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                const double u = static_cast<double>(x) / width;
+                const double v = static_cast<double>(y) / height;
+                const double value = 128 + 60 * std::sin(6.0 * u + seed) + 50 * std::cos(5.0 * v * (seed + 1)) +
+                                     15 * std::sin(11.0 * (u + v) * seed);
+                const int luma = std::clamp(static_cast<int>(value) + (noise ? jitter(random) : 0), 0, 255);
+                uint8_t* pixel = &pixels[(static_cast<size_t>(y) * width + x) * 4];
+                pixel[0] = static_cast<uint8_t>(luma);
+                pixel[1] = static_cast<uint8_t>(luma);
+                pixel[2] = static_cast<uint8_t>(luma);
+                pixel[3] = 255;
+            }
+        }
+        return pixels;
+    }
+
+    static PerceptualHash::Image MakeImage(const std::vector<uint8_t>& pixels, int width, int height) {
+        return { pixels.data(), width, height, width * 4, 4 };
+    }
+};
+
+TEST_F(TestPerceptualHash, ScaledAndNoisyCopiesStayClose) {
+    const auto original = RenderScene(1920, 1080, 3);
+    const auto scaled = RenderScene(640, 360, 3, 6);   // Düşük çözünürlük + yeniden kodlama gürültüsü
+    const auto other = RenderScene(1920, 1080, 8);
+
+    const auto originalImage = MakeImage(original, 1920, 1080);
+    const auto scaledImage = MakeImage(scaled, 640, 360);
+    const auto otherImage = MakeImage(other, 1920, 1080);
+
+    EXPECT_LE(PerceptualHash::Distance(PerceptualHash::PHash(originalImage), PerceptualHash::PHash(scaledImage)),
+              PerceptualHash::DUPLICATE_DISTANCE);
+    EXPECT_LE(PerceptualHash::Distance(PerceptualHash::DHash(originalImage), PerceptualHash::DHash(scaledImage)),
+              PerceptualHash::DUPLICATE_DISTANCE);
+    EXPECT_GT(PerceptualHash::Distance(PerceptualHash::PHash(originalImage), PerceptualHash::PHash(otherImage)),
+              PerceptualHash::DUPLICATE_DISTANCE);
+
+    // Alttan yukarı yerleşim aynı hash'i vermeli
+    PerceptualHash::Image bottomUp = originalImage;
+    std::vector<uint8_t> flipped(original.size());
+    for (int y = 0; y < 1080; ++y) {
+        std::copy_n(&original[static_cast<size_t>(y) * 1920 * 4], 1920 * 4, &flipped[static_cast<size_t>(1079 - y) * 1920 * 4]);
+    }
+    bottomUp.pixels = flipped.data() + static_cast<size_t>(1079) * 1920 * 4;
+    bottomUp.stride = -1920 * 4;
+    EXPECT_EQ(PerceptualHash::PHash(bottomUp), PerceptualHash::PHash(originalImage));
+}
+
+TEST_F(TestPerceptualHash, IndexMatchesLinearScan) {
+    std::mt19937_64 random(42);
+    std::vector<uint64_t> hashes(20000);
+    for (auto& hash : hashes) hash = random();
+    // Birkaç yakın komşu ekle
+    for (int i = 0; i < 50; ++i) hashes[i * 300] = hashes[7] ^ (1ull << (i % 64)) ^ (1ull << ((i * 7) % 64));
+
+    HashIndex index;
+    for (size_t i = 0; i < hashes.size(); ++i) index.Insert(hashes[i], static_cast<uint32_t>(i));
+    EXPECT_EQ(index.Size(), hashes.size());
+
+    for (int query = 0; query < 20; ++query) {
+        const uint64_t target = hashes[query * 991] ^ (query % 3 ? 0x11ull : 0);
+        std::vector<uint32_t> expected;
+        PerceptualHash::FindWithin(target, hashes.data(), hashes.size(), 8, expected);
+
+        std::vector<HashIndex::Match> matches;
+        index.Query(target, 8, matches);
+        std::vector<uint32_t> actual;
+        for (const auto& match : matches) {
+            EXPECT_EQ(match.distance, PerceptualHash::Distance(target, hashes[match.id]));
+            actual.push_back(match.id);
+        }
+        std::sort(actual.begin(), actual.end());
+        EXPECT_EQ(actual, expected);
+
+        HashIndex::Match nearest;
+        ASSERT_TRUE(index.Nearest(target, nearest));
+        int best = 64;
+        for (uint64_t hash : hashes) best = std::min(best, PerceptualHash::Distance(target, hash));
+        EXPECT_EQ(nearest.distance, best);
+    }
+}
+
+TEST_F(TestPerceptualHash, LibraryGroupsDuplicatesAndPersistsHashes) {
+    const auto mp4 = SyntheticMedia::BuildMp4(1920, 1080, 250, 25, 1, 5, false);
+    for (const char* name : { "a.mp4", "a_720p.mp4", "b.mp4" }) {
+        SyntheticMedia::WriteFile(testDir / name, mp4);
+    }
+
+    MediaLibrary library;
+    library.Rescan(testDir);
+    const std::vector<uint64_t> a = { 0x0123456789ABCDEFull, 0x1122334455667788ull, 0x0F0F0F0F0F0F0F0Full };
+    const std::vector<uint64_t> a720 = { a[0] ^ 0x7, a[1] ^ 0x300, 0xFFFF0000FFFF0000ull };   // 2/3 kare eşleşir
+    const std::vector<uint64_t> b = { 0xDEADBEEFCAFEBABEull, 0x8BADF00DFEEDFACEull, 0xC0FFEE0011223344ull };
+    ASSERT_TRUE(library.SetFrameHashes(testDir / "a.mp4", a));
+    ASSERT_TRUE(library.SetFrameHashes(testDir / "a_720p.mp4", a720));
+    ASSERT_TRUE(library.SetFrameHashes(testDir / "b.mp4", b));
+
+    auto groups = library.FindDuplicateGroups();
+    ASSERT_EQ(groups.size(), 1u);
+    ASSERT_EQ(groups[0].size(), 2u);
+    EXPECT_EQ(groups[0][0].filename(), "a.mp4");
+    EXPECT_EQ(groups[0][1].filename(), "a_720p.mp4");
+
+    // Hash'ler depoya yazılır; silinen kayıt gruptan düşer
+    const auto store = testDir / "library.bin";
+    ASSERT_TRUE(library.Save(store));
+    MediaLibrary reloaded;
+    ASSERT_TRUE(reloaded.Load(store));
+    MediaLibrary::Entry entry;
+    ASSERT_TRUE(reloaded.GetEntry(testDir / "a_720p.mp4", entry));
+    EXPECT_EQ(entry.frameHashes, a720);
+
+    std::filesystem::remove(testDir / "a.mp4");
+    reloaded.Rescan(testDir);
+    EXPECT_TRUE(reloaded.FindDuplicateGroups().empty());
+}
+
+TEST_F(TestPerceptualHash, SamplePositionsAvoidEdges) {
+    const auto positions = PerceptualHash::SamplePositions(100.0, 4);
+    ASSERT_EQ(positions.size(), 4u);
+    EXPECT_DOUBLE_EQ(positions.front(), 10.0);
+    EXPECT_DOUBLE_EQ(positions.back(), 90.0);
+    EXPECT_EQ(PerceptualHash::SamplePositions(0.0).size(), 1u);
+}
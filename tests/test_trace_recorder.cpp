@@ -0,0 +1,216 @@
+// tests/test_trace_recorder.cpp
+#include "../Headers/TraceRecorder.h"
+#include "../Headers/FramePipeline.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TestTraceRecorder : public ::testing::Test {
+protected:
+    std::filesystem::path testDir;
+
+    void SetUp() override {
+        testDir = std::filesystem::temp_directory_path() / "lmwallpaper_trace_recorder_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(testDir, ec);
+    }
+
+    struct ParsedEvent {
+        std::string name;
+        std::string phase;
+        double ts;
+        int tid;
+        long long value;
+    };
+
+    // WriteJson olay başına bir satır yazar
+    static std::string Field(const std::string& line, const std::string& key) {
+        const std::string marker = "\"" + key + "\":";
+        const size_t start = line.find(marker);
+        if (start == std::string::npos) return std::string();
+        size_t begin = start + marker.size();
+        if (line[begin] == '"') {
+            return line.substr(begin + 1, line.find('"', begin + 1) - begin - 1);
+        }
+        return line.substr(begin, line.find_first_of(",}", begin) - begin);
+    }
+
+    static std::vector<ParsedEvent> Parse(const std::string& json) {
+        std::vector<ParsedEvent> events;
+        std::istringstream lines(json);
+        for (std::string line; std::getline(lines, line);) {
+            const std::string phase = Field(line, "ph");
+            if (phase.empty() || phase == "M") continue;
+            const std::string value = Field(line, "value");
+            events.push_back(ParsedEvent{ Field(line, "name"), phase, std::stod(Field(line, "ts")),
+                                          std::stoi(Field(line, "tid")), value.empty() ? 0 : std::stoll(value) });
+        }
+        return events;
+    }
+
+    static std::string Dump(const TraceRecorder& recorder) {
+        std::ostringstream out;
+        recorder.WriteJson(out);
+        return out.str();
+    }
+};
+
+TEST_F(TestTraceRecorder, DisabledRecorderRecordsNothing) {
+    TraceRecorder recorder(64);
+    {
+        TraceRecorder::Span span("kapalı", recorder);
+        recorder.Counter("sayaç", 3);
+        recorder.Instant("işaret");
+    }
+    recorder.OnMissedDeadline("kaçtı");
+    const std::string json = Dump(recorder);
+    EXPECT_TRUE(Parse(json).empty());
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+
+    // Açıkken başlayan span kapatıldıktan sonra da biter
+    recorder.SetEnabled(true);
+    {
+        TraceRecorder::Span span("açık", recorder);
+        recorder.SetEnabled(false);
+    }
+    const auto events = Parse(Dump(recorder));
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0].phase, "B");
+    EXPECT_EQ(events[1].phase, "E");
+    EXPECT_EQ(events[1].name, "açık");
+}
+
+TEST_F(TestTraceRecorder, ThreadsGetOwnTimelinesAndRingsKeepNewest) {
+    constexpr int THREADS = 4;
+    constexpr int SPANS = 1000;
+    constexpr size_t CAPACITY = 256;
+    TraceRecorder recorder(CAPACITY);
+    recorder.SetEnabled(true);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&recorder, t] {
+            recorder.SetThreadName("işçi \"" + std::to_string(t) + "\"");
+            for (int i = 0; i < SPANS; ++i) {
+                TraceRecorder::Span span("decode", recorder);
+                recorder.Counter("kuyruk", i);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    const std::string json = Dump(recorder);
+    EXPECT_NE(json.find("\"name\":\"işçi \\\"2\\\"\""), std::string::npos);
+
+    std::map<int, std::vector<ParsedEvent>> byThread;
+    for (const auto& event : Parse(json)) byThread[event.tid].push_back(event);
+    ASSERT_EQ(byThread.size(), static_cast<size_t>(THREADS));
+    for (const auto& [tid, events] : byThread) {
+        // En yeni olaylar kalır, sırayla (yazılmakta olabilecek bir hücre hariç)
+        ASSERT_EQ(events.size(), CAPACITY - 1) << tid;
+        EXPECT_EQ(events.back().phase, "E");
+        EXPECT_EQ(events[events.size() - 2].value, SPANS - 1);
+        for (size_t i = 1; i < events.size(); ++i) EXPECT_GE(events[i].ts, events[i - 1].ts);
+    }
+
+    recorder.Clear();
+    EXPECT_TRUE(Parse(Dump(recorder)).empty());
+}
+
+TEST_F(TestTraceRecorder, DumpWhileWritingNeverTearsEvents) {
+    constexpr size_t CAPACITY = 128;
+    TraceRecorder recorder(CAPACITY);
+    recorder.SetEnabled(true);
+    std::atomic<bool> stop(false);
+
+    // Sayaç değeri zaman damgasıyla birlikte artar: yarım kopyalanan olay sırayı bozar
+    std::thread writer([&] {
+        for (int64_t i = 0; !stop.load(std::memory_order_relaxed); ++i) recorder.Counter("sıra", i);
+    });
+    for (int dump = 0; dump < 200; ++dump) {
+        const auto events = Parse(Dump(recorder));
+        EXPECT_LE(events.size(), CAPACITY);
+        for (size_t i = 1; i < events.size(); ++i) {
+            ASSERT_EQ(events[i].value, events[i - 1].value + 1) << "döküm " << dump;
+            ASSERT_GE(events[i].ts, events[i - 1].ts);
+        }
+    }
+    stop = true;
+    writer.join();
+}
+
+TEST_F(TestTraceRecorder, MissedDeadlineDumpsTimelineInBackground) {
+    TraceRecorder recorder(1024);
+    recorder.SetDeadlineDumpDirectory(testDir, 60000);
+    recorder.SetEnabled(true);
+
+    {
+        TraceRecorder::Span span("yavaş decode", recorder);
+        recorder.OnMissedDeadline("Kare süresi aşıldı");
+    }
+    // Aralık dolmadan gelen ikinci kaçırma sadece işaret bırakır
+    recorder.OnMissedDeadline("Kare süresi aşıldı");
+    recorder.WaitIdle();
+
+    ASSERT_EQ(recorder.GetDumpCount(), 1u);
+    const std::filesystem::path path = recorder.GetLastDumpPath();
+    EXPECT_EQ(path.parent_path(), testDir);
+    std::ifstream file(path, std::ios::binary);
+    const std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_NE(json.find("\"name\":\"yavaş decode\",\"cat\":\"lmw\",\"ph\":\"B\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Kare süresi aşıldı\",\"cat\":\"lmw\",\"ph\":\"i\""), std::string::npos);
+
+    const auto events = Parse(Dump(recorder));
+    size_t marks = 0;
+    for (const auto& event : events) marks += event.phase == "i" ? 1 : 0;
+    EXPECT_EQ(marks, 2u);
+}
+
+TEST_F(TestTraceRecorder, FramePipelineTracesStepsAndMissedDeadlines) {
+    TraceRecorder& recorder = TraceRecorder::GetInstance();
+    recorder.Clear();
+    recorder.SetDeadlineDumpDirectory(testDir, 60000);
+    recorder.SetEnabled(true);
+
+    constexpr double FRAME_INTERVAL = 2.0;
+    FramePipeline pipeline(FRAME_INTERVAL);
+    int decoded = 0;
+    pipeline.SetDecoder([&](FramePipeline::Frame& frame) {
+        FrameTelemetry::ScopedStage stage(&pipeline.GetTelemetry(), FrameTelemetry::Stage::Decode);
+        if (++decoded == 5) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        frame.timestampMs = static_cast<uint32_t>(decoded);
+        return true;
+    });
+    for (int i = 0; i < 10; ++i) pipeline.Step();
+    recorder.SetEnabled(false);
+    recorder.WaitIdle();
+
+    const auto events = Parse(Dump(recorder));
+    size_t frames = 0;
+    size_t decodes = 0;
+    size_t depthSamples = 0;
+    for (const auto& event : events) {
+        frames += event.name == "Kare" && event.phase == "B" ? 1 : 0;
+        decodes += event.name == "Decode" && event.phase == "E" ? 1 : 0;
+        depthSamples += event.name == "Kuyruk derinliği" ? 1 : 0;
+    }
+    EXPECT_EQ(frames, 10u);
+    EXPECT_EQ(decodes, 10u);
+    EXPECT_EQ(depthSamples, 10u);
+    EXPECT_GE(recorder.GetDumpCount(), 1u);
+
+    recorder.SetDeadlineDumpDirectory({});
+    recorder.Clear();
+}
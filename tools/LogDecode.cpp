@@ -0,0 +1,58 @@
+// tools/LogDecode.cpp
+// İkili log dosyasını (AsyncLog::Encoding::Binary) okunabilir metne çevirir:
+//     LMWallpaperLogDecode lmwallpaper.lmlog > lmwallpaper.txt
+// Döndürülüp sıkıştırılmış arşivler (.lmz) önce açılır; metin arşivi olduğu gibi yazılır.
+#include "../Headers/BinaryLog.h"
+#include "../Headers/LogRotation.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Kullanım: " << argv[0] << " <log.lmlog | arşiv.lmz> [çıktı.txt]" << std::endl;
+        return 2;
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    if (!input) {
+        std::cerr << "Açılamadı: " << argv[1] << std::endl;
+        return 1;
+    }
+    char magic[sizeof(LogRotation::FILE_MAGIC)] = {};
+    input.read(magic, sizeof(magic));
+    input.seekg(0);
+    input.clear();
+
+    std::stringstream unpacked;
+    const bool compressed = std::memcmp(magic, LogRotation::FILE_MAGIC, sizeof(magic)) == 0;
+    if (compressed && !LogRotation::DecompressFile(argv[1], unpacked)) {
+        std::cerr << "Arşiv bozuk: " << argv[1] << std::endl;
+        return 1;
+    }
+    std::istream& in = compressed ? static_cast<std::istream&>(unpacked) : input;
+
+    std::ofstream file;
+    if (argc > 2) {
+        file.open(argv[2], std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "Yazılamadı: " << argv[2] << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = argc > 2 ? static_cast<std::ostream&>(file) : std::cout;
+
+    // Metin arşivi: çözülecek bir şey yok
+    if (compressed && unpacked.str().compare(0, sizeof(BinaryLog::FILE_MAGIC),
+                                            std::string(BinaryLog::FILE_MAGIC, sizeof(BinaryLog::FILE_MAGIC))) != 0) {
+        out << unpacked.rdbuf();
+        return 0;
+    }
+    if (!BinaryLog::Decode(in, out)) {
+        std::cerr << "Dosya bozuk veya yarım (okunabilen kısım yazıldı): " << argv[1] << std::endl;
+        return 1;
+    }
+    return 0;
+}